@@ -0,0 +1,81 @@
+/**
+ * @file cancellation_token.h
+ * @brief A thread safe flag used to cancel ongoing planning
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_CANCELLATION_TOKEN_H
+#define TESSERACT_MOTION_PLANNERS_CANCELLATION_TOKEN_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <memory>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::CancellationToken)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A thread safe flag used to request that ongoing planning stops as soon as possible
+ * @details Planners poll the token from inside their search or optimization loops, so cancelling it returns the
+ * worker running the planner within a single iteration.
+ */
+class CancellationToken
+{
+public:
+  using Ptr = std::shared_ptr<CancellationToken>;
+  using ConstPtr = std::shared_ptr<const CancellationToken>;
+
+  CancellationToken() = default;
+
+  /**
+   * @brief Create a token which is also cancelled when its parent is cancelled
+   * @details Cancelling or resetting this token does not affect the parent
+   * @param parent The parent token
+   */
+  explicit CancellationToken(ConstPtr parent) : parent_(std::move(parent)) {}
+
+  /** @brief Request cancellation */
+  void cancel() { cancelled_ = true; }
+
+  /** @brief Clear the cancellation request so the token may be reused */
+  void reset() { cancelled_ = false; }
+
+  /**
+   * @brief Check if cancellation was requested for this token or its parent
+   * @return True if cancelled, otherwise false
+   */
+  bool isCancelled() const { return cancelled_ || (parent_ != nullptr && parent_->isCancelled()); }
+
+private:
+  std::atomic<bool> cancelled_{ false };
+  ConstPtr parent_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_CANCELLATION_TOKEN_H
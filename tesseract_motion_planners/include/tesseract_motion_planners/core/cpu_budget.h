@@ -0,0 +1,130 @@
+/**
+ * @file cpu_budget.h
+ * @brief A process wide budget of the threads used by the planners
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_CPU_BUDGET_H
+#define TESSERACT_MOTION_PLANNERS_CPU_BUDGET_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <memory>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe budget of the threads which may run concurrently
+ * @details The planners run on the workers of the ProcessPlanningServer executor and some of them start their own
+ * threads (Descartes graph building, OMPL parallel planning and parallel contact checking). Without coordination
+ * every concurrent request starts its own threads and the process is oversubscribed. The workers of the executor
+ * count against the budget while they run a task, and the planners borrow the additional threads they would like to
+ * use from the budget, falling back to fewer threads when the budget is exhausted. The number of running threads is
+ * therefore bounded by the capacity, or by the number of executor workers if that is larger.
+ */
+class CPUBudget
+{
+public:
+  using Ptr = std::shared_ptr<CPUBudget>;
+  using ConstPtr = std::shared_ptr<const CPUBudget>;
+
+  /** @brief Threads borrowed from a budget, they are returned when the lease is destroyed */
+  class Lease
+  {
+  public:
+    Lease() = default;
+    Lease(CPUBudget* budget, std::size_t count);
+    ~Lease();
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease&& other) noexcept;
+
+    /** @brief The number of borrowed threads */
+    std::size_t size() const;
+
+    /** @brief Return the borrowed threads to the budget */
+    void release();
+
+  private:
+    CPUBudget* budget_{ nullptr };
+    std::size_t count_{ 0 };
+  };
+
+  /**
+   * @brief Constructor
+   * @param capacity The number of threads which may run concurrently
+   */
+  CPUBudget(std::size_t capacity = std::thread::hardware_concurrency());
+
+  /**
+   * @brief Get the budget shared by the planners and the ProcessPlanningServer
+   * @details Its capacity defaults to the number of cores
+   */
+  static CPUBudget& getGlobal();
+
+  /**
+   * @brief Set the number of threads which may run concurrently
+   * @details Threads already borrowed are not returned if the capacity is reduced
+   * @param capacity The capacity, at least one
+   */
+  void setCapacity(std::size_t capacity);
+
+  /** @brief Get the number of threads which may run concurrently */
+  std::size_t getCapacity() const;
+
+  /** @brief Get the number of threads currently counted against the budget */
+  std::size_t getUsed() const;
+
+  /**
+   * @brief Borrow threads without blocking
+   * @details A parallel section which runs on the calling thread should borrow one less than the number of threads it
+   * would like to use, since the calling thread is already counted.
+   * @param count The number of threads requested
+   * @return The lease of the threads granted, which may be fewer than requested
+   */
+  Lease borrow(std::size_t count);
+
+  /**
+   * @brief Count threads which run regardless of the budget against it
+   * @details This is used for the workers of an executor while they run a task, it may exceed the capacity
+   * @param count The number of threads
+   */
+  void acquire(std::size_t count);
+
+  /**
+   * @brief Return threads counted by acquire
+   * @param count The number of threads
+   */
+  void release(std::size_t count);
+
+protected:
+  std::atomic<std::size_t> capacity_;
+  std::atomic<std::size_t> used_{ 0 };
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_CPU_BUDGET_H
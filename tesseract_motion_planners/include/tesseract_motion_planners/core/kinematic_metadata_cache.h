@@ -0,0 +1,132 @@
+/**
+ * @file kinematic_metadata_cache.h
+ * @brief A cache of the kinematic information of manipulators derived from the scene graph
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_KINEMATIC_METADATA_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_KINEMATIC_METADATA_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/core/environment.h>
+
+namespace tesseract_planning
+{
+/** @brief The kinematic information of a manipulator for a revision of an environment */
+struct KinematicMetadata
+{
+  using Ptr = std::shared_ptr<KinematicMetadata>;
+  using ConstPtr = std::shared_ptr<const KinematicMetadata>;
+
+  /** @brief The name of the manipulator */
+  std::string manipulator;
+
+  /** @brief The joint names of the manipulator */
+  std::vector<std::string> joint_names;
+
+  /** @brief The joint limits of the manipulator, a row per joint with the lower and upper limit */
+  Eigen::MatrixX2d joint_limits;
+
+  /**
+   * @brief Every link moved by the manipulator
+   * @details The kinematics objects do not know of the links attached to their links, so this is computed with an
+   * AdjacencyMap of the scene graph
+   */
+  std::vector<std::string> active_link_names;
+};
+
+/**
+ * @brief A process wide threadsafe cache of the KinematicMetadata of manipulators
+ * @details Computing the active links walks the scene graph, which used to be repeated by every planner and contact
+ * check of every segment. The metadata only depends on the structure of the scene graph, so it is cached by scene
+ * graph, environment revision and manipulator name. Every clone of an environment has its own scene graph, so each one
+ * computes the metadata once per revision. Entries of destroyed scene graphs and previous revisions are removed when
+ * new entries are added.
+ */
+class KinematicMetadataCache
+{
+public:
+  /**
+   * @brief Get the metadata of a manipulator
+   * @param env The environment
+   * @param kin The forward or inverse kinematics of the manipulator in the environment
+   * @return The metadata
+   */
+  template <typename Kinematics>
+  static KinematicMetadata::ConstPtr get(const tesseract_environment::Environment& env, const Kinematics& kin)
+  {
+    return get(env, kin.getName(), [&kin]() {
+      auto metadata = std::make_shared<KinematicMetadata>();
+      metadata->manipulator = kin.getName();
+      metadata->joint_names = kin.getJointNames();
+      metadata->joint_limits = kin.getLimits().joint_limits;
+      metadata->active_link_names = kin.getActiveLinkNames();
+      return metadata;
+    });
+  }
+
+  /**
+   * @brief Get the metadata of a manipulator
+   * @param env The environment
+   * @param manipulator The name of the manipulator
+   * @param create Creates the metadata of the manipulator, the active links are only the links of its kinematics
+   * @return The metadata
+   */
+  static KinematicMetadata::ConstPtr get(const tesseract_environment::Environment& env,
+                                         const std::string& manipulator,
+                                         const std::function<KinematicMetadata::Ptr()>& create);
+
+  /** @brief Get the number of cached entries */
+  static std::size_t size();
+
+  /** @brief Remove every cached entry */
+  static void clear();
+
+private:
+  /** @brief The address of the scene graph, the environment revision and the manipulator name */
+  using Key = std::tuple<const void*, int, std::string>;
+
+  struct Entry
+  {
+    /** @brief Used to detect the address of the scene graph being reused by another scene graph */
+    std::weak_ptr<const void> scene_graph;
+    KinematicMetadata::ConstPtr metadata;
+  };
+
+  static std::map<Key, Entry>& getEntries();
+  static std::shared_mutex& getMutex();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_KINEMATIC_METADATA_CACHE_H
@@ -0,0 +1,146 @@
+/**
+ * @file link_transform_batch.h
+ * @brief A reusable buffer of link transforms for a batch of joint states
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_LINK_TRANSFORM_BATCH_H
+#define TESSERACT_MOTION_PLANNERS_LINK_TRANSFORM_BATCH_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_environment/core/state_solver.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Computes the transforms of a fixed set of links for a batch of joint states
+ *
+ * Calling StateSolver::getState for every interpolated state allocates a new EnvState and copies every link transform
+ * of the environment. This instead drives a state solver owned by the caller with setState, which updates its current
+ * state in place, and copies only the requested links into a buffer that is reused between batches. The location of
+ * each link transform in the solver's state is resolved when the batch is built, so computing a state does no name
+ * lookups. They are only resolved again if the solver replaces its state object.
+ *
+ * The buffer is stored state major, so the transforms of state i are link_names.size() contiguous elements.
+ */
+class LinkTransformBatch
+{
+public:
+  using Ptr = std::shared_ptr<LinkTransformBatch>;
+  using ConstPtr = std::shared_ptr<const LinkTransformBatch>;
+
+  /**
+   * @brief Constructor
+   * @param state_solver The state solver used to compute the transforms, its current state is modified. It must
+   * outlive the batch.
+   * @param joint_names The joint names associated with the rows of a batch
+   * @param link_names The links to compute transforms for, they must exist in the state solver
+   */
+  LinkTransformBatch(tesseract_environment::StateSolver& state_solver,
+                     std::vector<std::string> joint_names,
+                     std::vector<std::string> link_names);
+
+  /**
+   * @brief Compute the link transforms for each row of states
+   * @param states The joint states, one per row
+   */
+  void compute(const Eigen::Ref<const tesseract_common::TrajArray>& states);
+
+  /**
+   * @brief Compute the link transforms of count states linearly interpolated from start to end inclusive
+   * @param start The first joint state
+   * @param end The last joint state
+   * @param count The number of states, must be at least two
+   */
+  void interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
+                   const Eigen::Ref<const Eigen::VectorXd>& end,
+                   long count);
+
+  /** @brief The number of states in the current batch */
+  long size() const;
+
+  /** @brief The joint states of the current batch */
+  const tesseract_common::TrajArray& states() const;
+
+  /** @brief The joint names associated with the rows of a batch */
+  const std::vector<std::string>& getJointNames() const;
+
+  /** @brief The links the transforms are computed for */
+  const std::vector<std::string>& getLinkNames() const;
+
+  /** @brief The transform of link index link_idx at state index state_idx */
+  const Eigen::Isometry3d& getTransform(long state_idx, std::size_t link_idx) const;
+
+  /**
+   * @brief Set the transforms of state state_idx on a discrete contact manager
+   * @details The link names must be a subset of the contact manager's collision objects
+   */
+  void setCollisionObjectsTransform(tesseract_collision::DiscreteContactManager& manager, long state_idx) const;
+
+  /**
+   * @brief Set the motion from state state0_idx to state1_idx on a continuous contact manager
+   * @details The link names must be a subset of the contact manager's collision objects
+   */
+  void setCollisionObjectsTransform(tesseract_collision::ContinuousContactManager& manager,
+                                    long state0_idx,
+                                    long state1_idx) const;
+
+private:
+  tesseract_environment::StateSolver* state_solver_;
+  std::vector<std::string> joint_names_;
+  std::vector<std::string> link_names_;
+
+  /** @brief The joint states of the current batch */
+  tesseract_common::TrajArray states_;
+
+  /** @brief The link transforms, state major */
+  tesseract_common::VectorIsometry3d transforms_;
+
+  /**
+   * @brief The solver state the link transform locations belong to
+   * @details It is usually updated in place by setState, if the solver replaces it the locations are resolved again
+   */
+  tesseract_environment::EnvState::ConstPtr solver_state_;
+
+  /** @brief The location of each link transform in solver_state_ */
+  std::vector<const Eigen::Isometry3d*> solver_transforms_;
+
+  /** @brief Compute the link transforms of the rows in states_ */
+  void computeStates();
+
+  /** @brief Resolve the location of each link transform in the current state of the solver */
+  void resolveTransforms();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_LINK_TRANSFORM_BATCH_H
@@ -28,6 +28,8 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <functional>
 #include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -79,6 +81,48 @@ public:
 
   /** @brief Clone the motion planner */
   virtual MotionPlanner::Ptr clone() const = 0;
+
+protected:
+  /**
+   * @brief Get a check used by solve() to determine if it should stop
+   * @details The check returns true once the request's cancellation token is cancelled or terminate() is called on
+   * this planner after this function was called. It references this planner, so it must not outlive it.
+   * @param request The request being solved
+   * @return A function returning true if solve() should stop
+   */
+  std::function<bool()> getCancellationCheck(const PlannerRequest& request) const
+  {
+    CancellationToken::ConstPtr request_token = request.cancellation_token;
+    const std::size_t terminate_count = terminate_count_.load();
+    return [this, request_token, terminate_count]() {
+      return terminate_count_.load() != terminate_count || (request_token && request_token->isCancelled());
+    };
+  }
+
+  /**
+   * @brief Check if the request's deadline has passed
+   * @param request The request being solved
+   * @return True if the request has a deadline and it has passed, otherwise false
+   */
+  static bool isDeadlineExceeded(const PlannerRequest& request)
+  {
+    return (request.deadline != std::chrono::steady_clock::time_point::max() &&
+            std::chrono::steady_clock::now() >= request.deadline);
+  }
+
+  /**
+   * @brief Cancel every solve() currently running on this planner, solves started afterwards are not affected
+   * @details Used to implement terminate()
+   */
+  void cancelRunningSolves() { ++terminate_count_; }
+
+private:
+  /**
+   * @brief The number of times terminate() was called on this planner
+   * @details A solve is cancelled once the count differs from the one it started with. The count belongs to this
+   * planner instance, so clones are not terminated along with it.
+   */
+  std::atomic<std::size_t> terminate_count_{ 0 };
 };
 }  // namespace tesseract_planning
 #endif  // TESSERACT_PLANNING_PLANNER_H
@@ -33,7 +33,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <typeindex>
 #include <unordered_map>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #ifdef SWIG
@@ -49,6 +52,11 @@ namespace tesseract_planning
  *      - The key is the profile name
  *      - Where std::shared_ptr<const T> is the profile
  *    The ProfleEntry<T> is also stored in std::unordered_map where the key here is the std::type_index(typeid(T))
+ *
+ * The profiles are stored in an immutable versioned snapshot. Reading only takes a reference to the current snapshot,
+ * so lookups do not lock or copy the profile entries. Each update copies the snapshot, sharing the profile entries
+ * which were not modified, and publishes it atomically, so updates never block requests in flight. A request should
+ * use getSnapshot() so its profiles do not change while it is running.
  * @note When adding a profile entry the T should be the base class type.
  */
 class ProfileDictionary
@@ -64,8 +72,7 @@ public:
   template <typename ProfileType>
   bool hasProfileEntry() const
   {
-    std::shared_lock lock(mutex_);
-    return (profiles_.find(std::type_index(typeid(ProfileType))) != profiles_.end());
+    return (getProfileEntryPtr<ProfileType>() != nullptr);
   }
 
   /** @brief Remove a profile entry */
@@ -73,25 +80,38 @@ public:
   void removeProfileEntry()
   {
     std::unique_lock lock(mutex_);
-    profiles_.erase(std::type_index(typeid(ProfileType)));
+    auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+    snapshot->entries.erase(std::type_index(typeid(ProfileType)));
+    publish(std::move(snapshot));
   }
 
   /**
    * @brief Get a profile entry
+   * @details This copies the profile map, use getProfileEntryPtr to reference it instead
    * @return The profile map associated with the profile entry
    */
   template <typename ProfileType>
   std::unordered_map<std::string, std::shared_ptr<const ProfileType>> getProfileEntry() const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.find(std::type_index(typeid(ProfileType)));
-    if (it != profiles_.end())
-      return std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it->second);
+    auto entry = getProfileEntryPtr<ProfileType>();
+    if (entry != nullptr)
+      return *entry;
 
     throw std::runtime_error("Profile entry does not exist for type name " +
                              std::string(std::type_index(typeid(ProfileType)).name()));
   }
 
+  /**
+   * @brief Get a reference to a profile entry without copying it
+   * @details The profile map is immutable, updates of the dictionary replace it
+   * @return The profile map associated with the profile entry, nullptr if it does not exist
+   */
+  template <typename ProfileType>
+  std::shared_ptr<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>> getProfileEntryPtr() const
+  {
+    return getEntry<ProfileType>(*std::atomic_load(&snapshot_));
+  }
+
   /**
    * @brief Add a profile
    * @details If the profile entry does not exist it will create one
@@ -107,19 +127,15 @@ public:
     if (profile == nullptr)
       throw std::runtime_error("Adding profile that is a nullptr");
 
+    using ProfileMap = std::unordered_map<std::string, std::shared_ptr<const ProfileType>>;
+
     std::unique_lock lock(mutex_);
-    auto it = profiles_.find(std::type_index(typeid(ProfileType)));
-    if (it != profiles_.end())
-    {
-      std::any_cast<std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it->second)[profile_name] =
-          profile;
-    }
-    else
-    {
-      std::unordered_map<std::string, std::shared_ptr<const ProfileType>> new_entry;
-      new_entry[profile_name] = profile;
-      profiles_[std::type_index(typeid(ProfileType))] = new_entry;
-    }
+    auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+    auto entry = getEntry<ProfileType>(*snapshot);
+    auto new_entry = (entry != nullptr) ? std::make_shared<ProfileMap>(*entry) : std::make_shared<ProfileMap>();
+    (*new_entry)[profile_name] = profile;
+    snapshot->entries[std::type_index(typeid(ProfileType))] = std::shared_ptr<const ProfileMap>(std::move(new_entry));
+    publish(std::move(snapshot));
   }
 
   /**
@@ -130,17 +146,8 @@ public:
   template <typename ProfileType>
   bool hasProfile(const std::string& profile_name) const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.find(std::type_index(typeid(ProfileType)));
-    if (it != profiles_.end())
-    {
-      const auto& profile_map =
-          std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it->second);
-      auto it2 = profile_map.find(profile_name);
-      if (it2 != profile_map.end())
-        return true;
-    }
-    return false;
+    auto entry = getProfileEntryPtr<ProfileType>();
+    return (entry != nullptr && entry->find(profile_name) != entry->end());
   }
 
   /**
@@ -152,11 +159,12 @@ public:
   template <typename ProfileType>
   std::shared_ptr<const ProfileType> getProfile(const std::string& profile_name) const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.at(std::type_index(typeid(ProfileType)));
-    const auto& profile_map =
-        std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it);
-    return profile_map.at(profile_name);
+    auto entry = getProfileEntryPtr<ProfileType>();
+    if (entry == nullptr)
+      throw std::out_of_range("Profile entry does not exist for type name " +
+                              std::string(std::type_index(typeid(ProfileType)).name()));
+
+    return entry->at(profile_name);
   }
 
   /**
@@ -166,16 +174,95 @@ public:
   template <typename ProfileType>
   void removeProfile(const std::string& profile_name)
   {
+    using ProfileMap = std::unordered_map<std::string, std::shared_ptr<const ProfileType>>;
+
     std::unique_lock lock(mutex_);
-    auto it = profiles_.find(std::type_index(typeid(ProfileType)));
-    if (it != profiles_.end())
-      std::any_cast<std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it->second)
-          .erase(profile_name);
+    auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+    auto entry = getEntry<ProfileType>(*snapshot);
+    if (entry != nullptr)
+    {
+      auto new_entry = std::make_shared<ProfileMap>(*entry);
+      new_entry->erase(profile_name);
+      snapshot->entries[std::type_index(typeid(ProfileType))] = std::shared_ptr<const ProfileMap>(std::move(new_entry));
+    }
+    publish(std::move(snapshot));
+  }
+
+  /**
+   * @brief Get the types of the profile entries
+   * @return The std::type_index of the ProfileType of each profile entry
+   */
+  std::vector<std::type_index> getProfileEntryTypes() const
+  {
+    auto snapshot = std::atomic_load(&snapshot_);
+    std::vector<std::type_index> types;
+    types.reserve(snapshot->entries.size());
+    for (const auto& entry : snapshot->entries)
+      types.push_back(entry.first);
+
+    return types;
+  }
+
+  /**
+   * @brief Get the revision of the profile dictionary
+   * @details This is incremented every time a profile or profile entry is added or removed
+   * @return The revision
+   */
+  std::size_t getRevision() const { return std::atomic_load(&snapshot_)->revision; }
+
+  /**
+   * @brief Get an identifier of the current profiles, used to remember values computed from them
+   * @details Dictionaries only return the same pointer if they hold the same profiles, which is a dictionary and the
+   * snapshots taken from it at the same revision. The pointer keeps the profiles alive, so hold a std::weak_ptr to it.
+   * @return The identifier
+   */
+  std::shared_ptr<const void> getSnapshotId() const { return std::atomic_load(&snapshot_); }
+
+  /**
+   * @brief Get an immutable snapshot of the current profiles
+   * @details This does not copy the profiles and is not affected by later updates of this dictionary
+   * @return The snapshot which has the revision of this dictionary when it was taken
+   */
+  ProfileDictionary::ConstPtr getSnapshot() const
+  {
+    auto dictionary = std::make_shared<ProfileDictionary>();
+    dictionary->snapshot_ = std::atomic_load(&snapshot_);
+    return dictionary;
   }
 
 protected:
-  std::unordered_map<std::type_index, std::any> profiles_;
-  mutable std::shared_mutex mutex_;
+  /** @brief The profile entries of a revision, each stored as a std::shared_ptr to an immutable profile map */
+  struct Snapshot
+  {
+    std::unordered_map<std::type_index, std::any> entries;
+    std::size_t revision{ 0 };
+  };
+
+  /** @brief The current snapshot, only accessed through std::atomic_load and std::atomic_store */
+  std::shared_ptr<const Snapshot> snapshot_{ std::make_shared<const Snapshot>() };
+
+  /** @brief Serializes the updates */
+  mutable std::mutex mutex_;
+
+  /** @brief Get a profile entry of a snapshot, nullptr if it does not exist */
+  template <typename ProfileType>
+  static std::shared_ptr<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>>
+  getEntry(const Snapshot& snapshot)
+  {
+    using ProfileMap = std::unordered_map<std::string, std::shared_ptr<const ProfileType>>;
+    auto it = snapshot.entries.find(std::type_index(typeid(ProfileType)));
+    if (it == snapshot.entries.end())
+      return nullptr;
+
+    return std::any_cast<const std::shared_ptr<const ProfileMap>&>(it->second);
+  }
+
+  /** @brief Publish a new snapshot with the next revision, the caller must hold the lock */
+  void publish(std::shared_ptr<Snapshot> snapshot)
+  {
+    ++snapshot->revision;
+    std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+  }
 };
 }  // namespace tesseract_planning
 
@@ -0,0 +1,133 @@
+/**
+ * @file thread_local_cache.h
+ * @brief A cache providing each thread its own instance of an object
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief Provides each thread its own instance of an object created by a factory on first use
+ *
+ * This is used to give every planner thread its own contact manager and state solver since they are not thread safe.
+ * The first call to get() from a thread creates the instance while holding a lock. Every following call from that
+ * thread is a lookup in a thread local table and does not lock.
+ *
+ * The instances are owned by the cache and destroyed along with it. Entries in the thread local tables that belong to
+ * destroyed caches are removed the next time the thread accesses a cache for the first time.
+ */
+template <typename T>
+class ThreadLocalCache
+{
+public:
+  using Ptr = std::shared_ptr<ThreadLocalCache<T>>;
+  using ConstPtr = std::shared_ptr<const ThreadLocalCache<T>>;
+  using Factory = std::function<std::shared_ptr<T>()>;
+
+  /** @param factory Called once per thread to create the thread's instance */
+  explicit ThreadLocalCache(Factory factory) : factory_(std::move(factory)) {}
+  ~ThreadLocalCache() = default;
+  ThreadLocalCache(const ThreadLocalCache&) = delete;
+  ThreadLocalCache& operator=(const ThreadLocalCache&) = delete;
+  ThreadLocalCache(ThreadLocalCache&&) = delete;
+  ThreadLocalCache& operator=(ThreadLocalCache&&) = delete;
+
+  /**
+   * @brief Get the instance owned by the calling thread
+   * @return A reference valid for the lifetime of the cache
+   */
+  T& get() const
+  {
+    std::vector<Entry>& entries = localEntries();
+    for (const auto& entry : entries)
+      if (entry.id == id_)
+        return *entry.instance;
+
+    std::shared_ptr<T> instance;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      instance = factory_();
+      instances_.push_back(instance);
+    }
+
+    // Drop entries of caches that no longer exist
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& e) { return e.alive.expired(); }),
+                  entries.end());
+    entries.push_back(Entry{ id_, instance.get(), alive_ });
+    return *instance;
+  }
+
+  /** @brief The number of threads that have an instance */
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return instances_.size();
+  }
+
+private:
+  struct Entry
+  {
+    std::size_t id;
+    T* instance;
+    std::weak_ptr<const void> alive;
+  };
+
+  /** @brief Unique id, never reused so a stale thread local entry can not match a new cache */
+  const std::size_t id_{ nextId() };
+
+  /** @brief Expires when the cache is destroyed */
+  std::shared_ptr<const void> alive_{ std::make_shared<char>() };
+
+  Factory factory_;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<std::shared_ptr<T>> instances_;
+
+  static std::size_t nextId()
+  {
+    static std::atomic<std::size_t> next_id{ 0 };
+    return next_id++;
+  }
+
+  static std::vector<Entry>& localEntries()
+  {
+    static thread_local std::vector<Entry> entries;
+    return entries;
+  }
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
@@ -26,10 +26,16 @@
 #ifndef TESSERACT_MOTION_PLANNERS_PLANNER_TYPES_H
 #define TESSERACT_MOTION_PLANNERS_PLANNER_TYPES_H
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_environment/core/environment.h>
 #include <tesseract_common/status_code.h>
 #include <tesseract_common/types.h>
 #include <tesseract_command_language/command_language.h>
+#include <tesseract_motion_planners/core/cancellation_token.h>
 
 namespace tesseract_planning
 {
@@ -76,6 +82,18 @@ struct PlannerRequest
    * will be used if it is not null
    */
   std::shared_ptr<void> data;
+
+  /**
+   * @brief If set, the planner stops as soon as possible once it is cancelled and returns a failed status
+   */
+  CancellationToken::ConstPtr cancellation_token;
+
+  /**
+   * @brief The wall clock time the planner must return by (Optional)
+   * @details Planners shorten their planning time or stop iterating so they return by this time. A planner that found a
+   * valid solution by then returns it, otherwise it fails.
+   */
+  std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::time_point::max() };
 };
 
 struct PlannerResponse
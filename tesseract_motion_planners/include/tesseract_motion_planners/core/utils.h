@@ -144,33 +144,41 @@ flattenProgramToPattern(const CompositeInstruction& composite_instruction, const
 
 /**
  * @brief Should perform a continuous collision check over the trajectory.
+ * @details If num_threads is greater than one the trajectory is split into chunks which are checked in parallel. The
+ * provided manager is used by the calling thread and every other thread uses its own clone of the manager and state
+ * solver. The results are identical to checking the trajectory on a single thread.
  * @param contacts A vector of vector of ContactMap where each index corresponds to a timestep
  * @param manager A continuous contact manager
  * @param state_solver The environment state solver
  * @param program The program to check for contacts
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The maximum number of threads used to check the trajectory
  * @return True if collision was found, otherwise false.
  */
 bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
                          tesseract_collision::ContinuousContactManager& manager,
                          const tesseract_environment::StateSolver& state_solver,
                          const CompositeInstruction& program,
-                         const tesseract_collision::CollisionCheckConfig& config);
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         std::size_t num_threads = 1);
 
 /**
  * @brief Should perform a discrete collision check over the trajectory
+ * @details See the continuous overload for how num_threads is used.
  * @param contacts A vector of vector of ContactMap where each index corresponds to a timestep
- * @param manager A continuous contact manager
+ * @param manager A discrete contact manager
  * @param state_solver The environment state solver
  * @param program The program to check for contacts
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The maximum number of threads used to check the trajectory
  * @return True if collision was found, otherwise false.
  */
 bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
                          tesseract_collision::DiscreteContactManager& manager,
                          const tesseract_environment::StateSolver& state_solver,
                          const CompositeInstruction& program,
-                         const tesseract_collision::CollisionCheckConfig& config);
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         std::size_t num_threads = 1);
 
 /**
  * @brief This generates a naive seed for the provided program
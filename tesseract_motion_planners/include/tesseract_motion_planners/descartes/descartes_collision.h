@@ -29,14 +29,24 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
+#include <string>
+#include <vector>
 #include <descartes_light/interface/collision_interface.h>
 #include <tesseract_environment/core/environment.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+
 namespace tesseract_planning
 {
+/**
+ * @brief Descartes vertex collision checker
+ *
+ * A single instance may be shared by every sampler of a problem and called from multiple threads, each thread is
+ * given its own contact manager and state solver cloned from the ones created on construction.
+ */
 template <typename FloatType>
 class DescartesCollision : public descartes_light::CollisionInterface<FloatType>
 {
@@ -60,7 +70,7 @@ public:
   ~DescartesCollision() override = default;
 
   /**
-   * @brief Copy constructor that clones the object
+   * @brief Copy constructor that clones the object, the copy does not share its per thread objects
    * @param collision_interface Object to copy/clone
    */
   DescartesCollision(const DescartesCollision& collision_interface);
@@ -99,6 +109,9 @@ private:
    */
   bool isContactAllowed(const std::string& a, const std::string& b) const;
 
+  /** @brief Configure the contact manager the per thread contact managers are cloned from */
+  void configureContactManager();
+
   tesseract_environment::StateSolver::Ptr state_solver_;             /**< @brief The tesseract state solver */
   tesseract_scene_graph::AllowedCollisionMatrix acm_;                /**< @brief The allowed collision matrix */
   std::vector<std::string> active_link_names_;                       /**< @brief A vector of active link names */
@@ -106,11 +119,32 @@ private:
   tesseract_collision::DiscreteContactManager::Ptr contact_manager_; /**< @brief The discrete contact manager */
   tesseract_collision::CollisionCheckConfig collision_check_config_;
   bool debug_; /**< @brief Enable debug information to be printed to the terminal */
+
+  /** @brief The discrete contact manager per thread */
+  ThreadLocalCache<tesseract_collision::DiscreteContactManager> contact_managers_;
+
+  /** @brief The state solver per thread */
+  ThreadLocalCache<tesseract_environment::StateSolver> state_solvers_;
 };
 
 using DescartesCollisionF = DescartesCollision<float>;
 using DescartesCollisionD = DescartesCollision<double>;
 
+/**
+ * @brief Get a key identifying the vertex collision checks performed for the provided arguments
+ * @details Two DescartesCollision objects created with arguments sharing a key produce the same results, so a single
+ * instance may be shared
+ * @param active_links The list of active links
+ * @param joint_names The list of joint names
+ * @param collision_check_config Config used to set up collision checking
+ * @param debug If true, this print debug information to the terminal
+ * @return The key
+ */
+std::string getDescartesCollisionKey(const std::vector<std::string>& active_links,
+                                     const std::vector<std::string>& joint_names,
+                                     const tesseract_collision::CollisionCheckConfig& collision_check_config,
+                                     bool debug);
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_DESCARTES_COLLISION_H
@@ -37,6 +37,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tesseract_collision/core/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+#include <tesseract_motion_planners/core/link_transform_batch.h>
+
 namespace tesseract_planning
 {
 template <typename FloatType>
@@ -80,22 +83,27 @@ protected:
    */
   bool isContactAllowed(const std::string& a, const std::string& b) const;
 
-  // The member variables below are to cache the contact manager based on thread ID. Currently descartes is multi
-  // threaded but the methods used to implement collision checking are not thread safe. To prevent
-  // reconstructing the collision environment for every check this will cache a contact manager
-  // based on its thread ID.
+  // Currently descartes is multi threaded but the methods used to implement collision checking are not thread safe. To
+  // prevent reconstructing the collision environment for every check each thread is given its own clone.
+
+  /** @brief The continuous contact manager per thread */
+  ThreadLocalCache<tesseract_collision::ContinuousContactManager> continuous_contact_managers_;
 
-  /** @brief Contact manager caching mutex */
-  mutable std::mutex mutex_;
+  /** @brief The discrete contact manager per thread */
+  ThreadLocalCache<tesseract_collision::DiscreteContactManager> discrete_contact_managers_;
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::ContinuousContactManager::Ptr> continuous_contact_managers_;
+  /** @brief The state solver per thread */
+  ThreadLocalCache<tesseract_environment::StateSolver> state_solvers_;
 
-  /** @brief The discrete contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::DiscreteContactManager::Ptr> discrete_contact_managers_;
+  /** @brief The buffer used to compute the interpolated link transforms per thread */
+  ThreadLocalCache<LinkTransformBatch> link_transform_batches_;
 
-  /** @brief The state solver manager cache */
-  mutable std::map<unsigned long int, tesseract_environment::StateSolver::Ptr> state_solver_managers_;
+  /**
+   * @brief The number of interpolated states, including both ends, checked for a segment
+   * @param segment Trajectory containing two states
+   * @return Two if the segment is not subdivided, otherwise the number of longest valid segment sub-states
+   */
+  long getStateCount(const tesseract_common::TrajArray& segment) const;
 
   /**
    * @brief Perform a continuous collision check between two states
@@ -0,0 +1,116 @@
+/**
+ * @file descartes_edge_evaluators.h
+ * @brief Cheap Descartes edge evaluators used to reject edges before collision checking
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_DESCARTES_EDGE_EVALUATORS_H
+#define TESSERACT_MOTION_PLANNERS_DESCARTES_EDGE_EVALUATORS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <descartes_light/interface/edge_evaluator.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/forward_kinematics.h>
+#include <tesseract_motion_planners/robot_config.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Rejects edges where any joint moves further than its maximum delta
+ * @details This has no cost, it is intended to be placed before more expensive evaluators in a compound evaluator
+ */
+template <typename FloatType>
+class DescartesJointDeltaEdgeEvaluator : public descartes_light::EdgeEvaluator<FloatType>
+{
+public:
+  /** @param max_joint_delta The maximum absolute change of each joint along an edge */
+  DescartesJointDeltaEdgeEvaluator(const Eigen::Ref<const Eigen::VectorXd>& max_joint_delta)
+    : descartes_light::EdgeEvaluator<FloatType>(static_cast<std::size_t>(max_joint_delta.size()))
+    , max_joint_delta_(max_joint_delta)
+  {
+  }
+
+  std::pair<bool, FloatType> considerEdge(const FloatType* start, const FloatType* end) override
+  {
+    for (long i = 0; i < max_joint_delta_.size(); ++i)
+      if (std::abs(static_cast<double>(end[i] - start[i])) > max_joint_delta_(i))
+        return std::make_pair(false, FloatType(0));
+
+    return std::make_pair(true, FloatType(0));
+  }
+
+protected:
+  Eigen::VectorXd max_joint_delta_;
+};
+
+/**
+ * @brief Rejects edges where the configuration of a six axis robot changes, see getRobotConfig
+ * @details This has no cost and requires a forward kinematics solve for each end of the edge, which is still much
+ * cheaper than a collision check
+ */
+template <typename FloatType>
+class DescartesRobotConfigEdgeEvaluator : public descartes_light::EdgeEvaluator<FloatType>
+{
+public:
+  /**
+   * @param robot_kin The kinematics object of the robot
+   * @param sign_correction Correct the sign for Joint 3 and Joint 5 based on the robot manufacturer
+   */
+  DescartesRobotConfigEdgeEvaluator(tesseract_kinematics::ForwardKinematics::ConstPtr robot_kin,
+                                    const Eigen::Ref<const Eigen::Vector2i>& sign_correction = Eigen::Vector2i::Ones())
+    : descartes_light::EdgeEvaluator<FloatType>(robot_kin->numJoints())
+    , robot_kin_(std::move(robot_kin))
+    , sign_correction_(sign_correction)
+  {
+  }
+
+  std::pair<bool, FloatType> considerEdge(const FloatType* start, const FloatType* end) override
+  {
+    // Forward kinematics is only provided in double precision
+    using VectorX = Eigen::Matrix<FloatType, Eigen::Dynamic, 1>;
+    const auto dof = static_cast<long>(this->dof_);
+    Eigen::VectorXd start_joints = Eigen::Map<const VectorX>(start, dof).template cast<double>();
+    Eigen::VectorXd end_joints = Eigen::Map<const VectorX>(end, dof).template cast<double>();
+    RobotConfig start_config = getRobotConfig<double>(robot_kin_, start_joints, sign_correction_);
+    RobotConfig end_config = getRobotConfig<double>(robot_kin_, end_joints, sign_correction_);
+    return std::make_pair(start_config == end_config, FloatType(0));
+  }
+
+protected:
+  tesseract_kinematics::ForwardKinematics::ConstPtr robot_kin_;
+  Eigen::Vector2i sign_correction_;
+};
+
+using DescartesJointDeltaEdgeEvaluatorF = DescartesJointDeltaEdgeEvaluator<float>;
+using DescartesJointDeltaEdgeEvaluatorD = DescartesJointDeltaEdgeEvaluator<double>;
+using DescartesRobotConfigEdgeEvaluatorF = DescartesRobotConfigEdgeEvaluator<float>;
+using DescartesRobotConfigEdgeEvaluatorD = DescartesRobotConfigEdgeEvaluator<double>;
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_DESCARTES_EDGE_EVALUATORS_H
@@ -69,6 +69,14 @@ public:
   DescartesPlanProfileMapD plan_profiles;
 #endif
 
+#ifndef SWIG
+  /**
+   * @brief Plan profiles used instead of plan_profiles if set
+   * @details This allows referencing the immutable profile entries of a ProfileDictionary without copying them
+   */
+  std::shared_ptr<const DescartesPlanProfileMap<FloatType>> shared_plan_profiles;
+#endif
+
   /**
    * @brief Sets up the opimizer and solves a SQP problem read from json with no callbacks and dafault parameterss
    * @param response The results of the optimization. Primary output is the optimized joint trajectory
@@ -58,6 +58,7 @@ public:
     ErrorInvalidInput = -1,
     ErrorFailedToBuildGraph = -3,
     ErrorFailedToFindValidSolution = -4,
+    Cancelled = -5,
   };
 
 private:
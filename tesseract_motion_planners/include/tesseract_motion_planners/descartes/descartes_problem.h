@@ -28,10 +28,13 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <descartes_light/interface/collision_interface.h>
 #include <descartes_light/interface/edge_evaluator.h>
 #include <descartes_light/interface/position_sampler.h>
 #include <descartes_light/ladder_graph.h>
 #include <descartes_light/descartes_light.h>
+#include <map>
+#include <string>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -59,6 +62,13 @@ struct DescartesProblem
   std::vector<typename descartes_light::EdgeEvaluator<FloatType>::Ptr> edge_evaluators;
   std::vector<typename descartes_light::PositionSampler<FloatType>::Ptr> samplers;
   int num_threads = descartes_light::Solver<double>::getMaxThreads();
+
+  /**
+   * @brief The vertex collision interfaces shared by the samplers while the problem is built
+   * @details These are keyed by getDescartesCollisionKey so waypoints with the same active links and collision check
+   * config share a single contact manager instead of creating one per waypoint
+   */
+  std::map<std::string, typename descartes_light::CollisionInterface<FloatType>::Ptr> vertex_collision_interfaces;
 };
 using DescartesProblemF = DescartesProblem<float>;
 using DescartesProblemD = DescartesProblem<double>;
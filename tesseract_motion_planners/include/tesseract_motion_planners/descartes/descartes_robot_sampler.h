@@ -72,11 +72,13 @@ private:
   tesseract_kinematics::InverseKinematics::ConstPtr robot_kinematics_;     /**< @brief The robot inverse kinematics */
   typename descartes_light::CollisionInterface<FloatType>::Ptr collision_; /**< @brief The collision interface */
   Eigen::Isometry3d tcp_;                                                  /**< @brief The robot tool center point */
+  Eigen::Isometry3d tcp_inverse_;                                          /**< @brief The inverse of the tcp */
   bool allow_collision_;    /**< @brief If true and no valid solution was found it will return the best of the worst */
   int dof_;                 /**< @brief The number of joints in the robot */
   Eigen::VectorXd ik_seed_; /**< @brief The seed for inverse kinematics which is zeros */
   typename DescartesVertexEvaluator<FloatType>::Ptr is_valid_; /**< @brief This is the vertex evaluator to filter out
                                                                   solution */
+  Eigen::VectorXd ik_solutions_; /**< @brief The inverse kinematics solutions of a single pose, reused between poses */
 
   /**
    * @brief Check if a solution is passes collision test
@@ -86,25 +88,28 @@ private:
   bool isCollisionFree(const FloatType* vertex);
 
   /**
-   * @brief This will return the best of the worst solution
-   * @param solution_set The solution to populate
-   * @param target_poses The target pose to sample
-   * @return True if a solution was found, otherwise false
+   * @brief Solve inverse kinematics for every target pose, appending the solutions accepted by the vertex evaluator
+   * @details Solutions are written directly to the end of the solution set and removed again if rejected
+   * @param solution_set The solution set to append to
+   * @param target_poses The tool poses to solve inverse kinematics for
    */
-  bool getBestSolution(std::vector<FloatType>& solution_set, const tesseract_common::VectorIsometry3d& target_poses);
+  void appendIKSolutions(std::vector<FloatType>& solution_set, const tesseract_common::VectorIsometry3d& target_poses);
 
   /**
-   * @brief Solve inverse kinematics for the target pose
-   * @param target_pose The target pose to solve inverse kinematics
-   * @param solution_set The soltuion to return
-   * @param get_best_solution Enable if best solution should be returned
-   * @param distance The current best distance
-   * @return True if a solution was found, otherwise false
+   * @brief Remove the solutions in collision, preserving the order of the remaining solutions
+   * @param solution_set The solution set to filter in place
+   * @param begin The index of the first element to filter, earlier elements are kept
+   * @return The end of the collision free solutions, the solution set is not resized
    */
-  bool ikAt(std::vector<FloatType>& solution_set,
-            const Eigen::Isometry3d& target_pose,
-            bool get_best_solution,
-            double& distance);
+  std::size_t removeSolutionsInCollision(std::vector<FloatType>& solution_set, std::size_t begin);
+
+  /**
+   * @brief Move the solution furthest from collision to begin
+   * @param solution_set The solution set containing the candidate solutions
+   * @param begin The index of the first candidate solution
+   * @return True if there was a candidate solution, otherwise false
+   */
+  bool moveBestSolution(std::vector<FloatType>& solution_set, std::size_t begin);
 };
 
 using DescartesRobotSamplerF = DescartesRobotSampler<float>;
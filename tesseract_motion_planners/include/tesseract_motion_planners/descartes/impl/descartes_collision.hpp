@@ -50,11 +50,10 @@ DescartesCollision<FloatType>::DescartesCollision(const tesseract_environment::E
   , contact_manager_(collision_env->getDiscreteContactManager())
   , collision_check_config_(std::move(collision_check_config))
   , debug_(debug)
+  , contact_managers_([this]() { return contact_manager_->clone(); })
+  , state_solvers_([this]() { return state_solver_->clone(); })
 {
-  contact_manager_->setActiveCollisionObjects(active_link_names_);
-  contact_manager_->setCollisionMarginData(collision_check_config_.collision_margin_data);
-  contact_manager_->setIsContactAllowedFn(
-      [this](const std::string& a, const std::string& b) { return isContactAllowed(a, b); });
+  configureContactManager();
 }
 
 template <typename FloatType>
@@ -66,6 +65,14 @@ DescartesCollision<FloatType>::DescartesCollision(const DescartesCollision& coll
   , contact_manager_(collision_interface.contact_manager_->clone())
   , collision_check_config_(collision_interface.collision_check_config_)
   , debug_(collision_interface.debug_)
+  , contact_managers_([this]() { return contact_manager_->clone(); })
+  , state_solvers_([this]() { return state_solver_->clone(); })
+{
+  configureContactManager();
+}
+
+template <typename FloatType>
+void DescartesCollision<FloatType>::configureContactManager()
 {
   contact_manager_->setActiveCollisionObjects(active_link_names_);
   contact_manager_->setCollisionMarginData(collision_check_config_.collision_margin_data);
@@ -82,12 +89,12 @@ bool DescartesCollision<FloatType>::validate(const FloatType* pos, std::size_t s
   for (int i = 0; i < static_cast<int>(size); ++i)
     joint_angles(i) = pos[i];
 
-  tesseract_environment::EnvState::Ptr env_state = state_solver_->getState(joint_names_, joint_angles);
+  tesseract_environment::EnvState::Ptr env_state = state_solvers_.get().getState(joint_names_, joint_angles);
 
   std::vector<tesseract_collision::ContactResultMap> results;
   tesseract_collision::CollisionCheckConfig config(collision_check_config_);
   config.contact_request.type = tesseract_collision::ContactTestType::FIRST;
-  bool in_contact = checkTrajectoryState(results, *contact_manager_, env_state, config);
+  bool in_contact = checkTrajectoryState(results, contact_managers_.get(), env_state, config);
   return (!in_contact);
 }
 
@@ -99,15 +106,15 @@ FloatType DescartesCollision<FloatType>::distance(const FloatType* pos, std::siz
   Eigen::VectorXd joint_angles(size);
   for (int i = 0; i < static_cast<int>(size); ++i)
     joint_angles(i) = pos[i];
-  tesseract_environment::EnvState::Ptr env_state = state_solver_->getState(joint_names_, joint_angles);
+  tesseract_environment::EnvState::Ptr env_state = state_solvers_.get().getState(joint_names_, joint_angles);
 
   std::vector<tesseract_collision::ContactResultMap> results;
   tesseract_collision::CollisionCheckConfig config(collision_check_config_);
   config.contact_request.type = tesseract_collision::ContactTestType::CLOSEST;
-  bool in_contact = checkTrajectoryState(results, *contact_manager_, env_state, config);
+  bool in_contact = checkTrajectoryState(results, contact_managers_.get(), env_state, config);
 
   if (!in_contact)
-    return static_cast<FloatType>(contact_manager_->getCollisionMarginData().getMaxCollisionMargin());
+    return static_cast<FloatType>(collision_check_config_.collision_margin_data.getMaxCollisionMargin());
 
   return static_cast<FloatType>(results.begin()->begin()->second[0].distance);
 }
@@ -28,8 +28,8 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
 #include <numeric>
-#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
@@ -55,6 +55,12 @@ DescartesCollisionEdgeEvaluator<FloatType>::DescartesCollisionEdgeEvaluator(
   , collision_check_config_(std::move(config))
   , allow_collision_(allow_collision)
   , debug_(debug)
+  , continuous_contact_managers_([this]() { return continuous_contact_manager_->clone(); })
+  , discrete_contact_managers_([this]() { return discrete_contact_manager_->clone(); })
+  , state_solvers_([this]() { return state_solver_->clone(); })
+  , link_transform_batches_([this]() {
+    return std::make_shared<LinkTransformBatch>(state_solvers_.get(), joint_names_, active_link_names_);
+  })
 {
   discrete_contact_manager_->setActiveCollisionObjects(active_link_names_);
   discrete_contact_manager_->setCollisionMarginData(collision_check_config_.collision_margin_data);
@@ -83,6 +89,11 @@ std::pair<bool, FloatType> DescartesCollisionEdgeEvaluator<FloatType>::considerE
   std::vector<tesseract_collision::ContactResultMap> discrete_results;
   std::vector<tesseract_collision::ContactResultMap> continuous_results;
   bool discrete_in_contact = discreteCollisionCheck(discrete_results, segment, allow_collision_);
+
+  // The edge is rejected regardless of the continuous check so it is skipped
+  if (discrete_in_contact && !allow_collision_)
+    return std::make_pair(false, 0);
+
   bool continuous_in_contact = continuousCollisionCheck(continuous_results, segment, allow_collision_);
 
   if (!discrete_in_contact && !continuous_in_contact)
@@ -114,42 +125,48 @@ bool DescartesCollisionEdgeEvaluator<FloatType>::isContactAllowed(const std::str
   return acm_.isCollisionAllowed(a, b);
 }
 
+template <typename FloatType>
+long DescartesCollisionEdgeEvaluator<FloatType>::getStateCount(const tesseract_common::TrajArray& segment) const
+{
+  if (collision_check_config_.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE &&
+      collision_check_config_.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+    return 2;
+
+  double dist = (segment.row(1) - segment.row(0)).norm();
+  if (dist <= collision_check_config_.longest_valid_segment_length)
+    return 2;
+
+  return static_cast<long>(std::ceil(dist / collision_check_config_.longest_valid_segment_length)) + 1;
+}
+
 template <typename FloatType>
 bool DescartesCollisionEdgeEvaluator<FloatType>::continuousCollisionCheck(
     std::vector<tesseract_collision::ContactResultMap>& results,
     const tesseract_common::TrajArray& segment,
     bool find_best)
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::ContinuousContactManager::Ptr cm;
-  tesseract_environment::StateSolver::Ptr ss;
-  mutex_.lock();
-  auto it = continuous_contact_managers_.find(hash);
-  if (it == continuous_contact_managers_.end())
-  {
-    cm = continuous_contact_manager_->clone();
-    continuous_contact_managers_[hash] = cm;
+  tesseract_collision::ContinuousContactManager& cm = continuous_contact_managers_.get();
+  LinkTransformBatch& batch = link_transform_batches_.get();
 
-    ss = state_solver_->clone();
-    state_solver_managers_[hash] = ss;
-  }
-  else
+  tesseract_collision::ContactRequest request = collision_check_config_.contact_request;
+  request.type =
+      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
+
+  batch.interpolate(segment.row(0).transpose(), segment.row(1).transpose(), getStateCount(segment));
+  for (long i = 0; i < batch.size() - 1; ++i)
   {
-    cm = it->second;
-    ss = state_solver_managers_[hash];
+    batch.setCollisionObjectsTransform(cm, i, i + 1);
+
+    tesseract_collision::ContactResultMap collisions;
+    cm.contactTest(collisions, request);
+    if (!collisions.empty())
+    {
+      results.push_back(std::move(collisions));
+      return true;
+    }
   }
-  mutex_.unlock();
-  tesseract_collision::CollisionCheckConfig config = collision_check_config_;
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE ||
-      config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-    config.type = tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS;
-  else
-    config.type = tesseract_collision::CollisionEvaluatorType::CONTINUOUS;
-  config.contact_request.type =
-      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
 
-  return tesseract_environment::checkTrajectory(results, *cm, *ss, joint_names_, segment, config);
+  return false;
 }
 
 template <typename FloatType>
@@ -158,37 +175,28 @@ bool DescartesCollisionEdgeEvaluator<FloatType>::discreteCollisionCheck(
     const tesseract_common::TrajArray& segment,
     bool find_best)
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::DiscreteContactManager::Ptr cm;
-  tesseract_environment::StateSolver::Ptr ss;
-  mutex_.lock();
-  auto it = discrete_contact_managers_.find(hash);
-  if (it == discrete_contact_managers_.end())
-  {
-    cm = discrete_contact_manager_->clone();
-    discrete_contact_managers_[hash] = cm;
+  tesseract_collision::DiscreteContactManager& cm = discrete_contact_managers_.get();
+  LinkTransformBatch& batch = link_transform_batches_.get();
 
-    ss = state_solver_->clone();
-    state_solver_managers_[hash] = ss;
-  }
-  else
+  tesseract_collision::ContactRequest request = collision_check_config_.contact_request;
+  request.type =
+      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
+
+  batch.interpolate(segment.row(0).transpose(), segment.row(1).transpose(), getStateCount(segment));
+  for (long i = 0; i < batch.size(); ++i)
   {
-    cm = it->second;
-    ss = state_solver_managers_[hash];
+    batch.setCollisionObjectsTransform(cm, i);
+
+    tesseract_collision::ContactResultMap collisions;
+    cm.contactTest(collisions, request);
+    if (!collisions.empty())
+    {
+      results.push_back(std::move(collisions));
+      return true;
+    }
   }
-  mutex_.unlock();
-
-  tesseract_collision::CollisionCheckConfig config = collision_check_config_;
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE ||
-      config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-    config.type = tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE;
-  else
-    config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
-  config.contact_request.type =
-      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
 
-  return tesseract_environment::checkTrajectory(results, *cm, *ss, joint_names_, segment, config);
+  return false;
 }
 
 }  // namespace tesseract_planning
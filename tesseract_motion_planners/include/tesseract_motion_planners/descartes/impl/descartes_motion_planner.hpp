@@ -40,18 +40,71 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <descartes_samplers/samplers/fixed_joint_pose_sampler.h>
 #include <descartes_samplers/evaluators/timing_edge_evaluator.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <functional>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/descartes/descartes_motion_planner.h>
 #include <tesseract_motion_planners/descartes/profile/descartes_default_plan_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/cpu_budget.h>
 
 #include <tesseract_command_language/command_language.h>
 #include <tesseract_command_language/utils/utils.h>
 
 namespace tesseract_planning
 {
+/** @brief Forwards to a position sampler and fails once the solve is cancelled so the graph build stops early */
+template <typename FloatType>
+class DescartesCancellableSampler : public descartes_light::PositionSampler<FloatType>
+{
+public:
+  DescartesCancellableSampler(typename descartes_light::PositionSampler<FloatType>::Ptr sampler,
+                              std::function<bool()> cancelled)
+    : sampler_(std::move(sampler)), cancelled_(std::move(cancelled))
+  {
+  }
+
+  bool sample(std::vector<FloatType>& solution_set) override
+  {
+    if (cancelled_())
+      return false;
+
+    return sampler_->sample(solution_set);
+  }
+
+private:
+  typename descartes_light::PositionSampler<FloatType>::Ptr sampler_;
+  std::function<bool()> cancelled_;
+};
+
+/** @brief Forwards to an edge evaluator and rejects every edge once the solve is cancelled */
+template <typename FloatType>
+class DescartesCancellableEdgeEvaluator : public descartes_light::EdgeEvaluator<FloatType>
+{
+public:
+  DescartesCancellableEdgeEvaluator(typename descartes_light::EdgeEvaluator<FloatType>::Ptr evaluator,
+                                    std::size_t dof,
+                                    std::function<bool()> cancelled)
+    : descartes_light::EdgeEvaluator<FloatType>(dof)
+    , evaluator_(std::move(evaluator))
+    , cancelled_(std::move(cancelled))
+  {
+  }
+
+  std::pair<bool, FloatType> considerEdge(const FloatType* start, const FloatType* end) override
+  {
+    if (cancelled_())
+      return std::make_pair(false, FloatType(0));
+
+    return evaluator_->considerEdge(start, end);
+  }
+
+private:
+  typename descartes_light::EdgeEvaluator<FloatType>::Ptr evaluator_;
+  std::function<bool()> cancelled_;
+};
+
 template <typename FloatType>
 DescartesMotionPlanner<FloatType>::DescartesMotionPlanner()
   : status_category_(std::make_shared<const DescartesMotionPlannerStatusCategory>(name_))
@@ -87,7 +140,8 @@ tesseract_common::StatusCode DescartesMotionPlanner<FloatType>::solve(const Plan
 
     try
     {
-      problem = problem_generator(name_, request, plan_profiles);
+      problem = problem_generator(
+          name_, request, (shared_plan_profiles != nullptr) ? *shared_plan_profiles : plan_profiles);
     }
     catch (std::exception& e)
     {
@@ -100,9 +154,48 @@ tesseract_common::StatusCode DescartesMotionPlanner<FloatType>::solve(const Plan
     response.data = problem;
   }
 
-  descartes_light::Solver<FloatType> graph_builder(problem->manip_inv_kin->numJoints());
-  if (!graph_builder.build(problem->samplers, problem->edge_evaluators, problem->num_threads))
+  std::function<bool()> cancelled = getCancellationCheck(request);
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("DescartesMotionPlanner was cancelled");
+    response.status = tesseract_common::StatusCode(DescartesMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
+  // Wrap the samplers and evaluators so a cancelled solve stops building the graph, the graph can not be searched
+  // until it is complete so reaching the request deadline is treated the same
+  std::function<bool()> stop = [&cancelled, &request]() { return cancelled() || isDeadlineExceeded(request); };
+  const std::size_t num_joints = problem->manip_inv_kin->numJoints();
+  std::vector<typename descartes_light::PositionSampler<FloatType>::Ptr> samplers;
+  samplers.reserve(problem->samplers.size());
+  for (const auto& sampler : problem->samplers)
+    samplers.push_back(std::make_shared<DescartesCancellableSampler<FloatType>>(sampler, stop));
+
+  std::vector<typename descartes_light::EdgeEvaluator<FloatType>::Ptr> edge_evaluators;
+  edge_evaluators.reserve(problem->edge_evaluators.size());
+  for (const auto& evaluator : problem->edge_evaluators)
+    edge_evaluators.push_back(
+        std::make_shared<DescartesCancellableEdgeEvaluator<FloatType>>(evaluator, num_joints, stop));
+
+  // The graph builder runs on the calling thread, only the additional threads are borrowed from the budget
+  CPUBudget::Lease lease =
+      CPUBudget::getGlobal().borrow(static_cast<std::size_t>(std::max(problem->num_threads, 1) - 1));
+  const int num_threads = 1 + static_cast<int>(lease.size());
+
+  descartes_light::Solver<FloatType> graph_builder(num_joints);
+  if (!graph_builder.build(samplers, edge_evaluators, num_threads) || stop())
   {
+    if (cancelled())
+    {
+      CONSOLE_BRIDGE_logInform("DescartesMotionPlanner was cancelled");
+      response.status =
+          tesseract_common::StatusCode(DescartesMotionPlannerStatusCategory::Cancelled, status_category_);
+      return response.status;
+    }
+
+    if (isDeadlineExceeded(request))
+      CONSOLE_BRIDGE_logError("DescartesMotionPlanner reached the request deadline");
+
     //    CONSOLE_BRIDGE_logError("Failed to build vertices");
     //    for (const auto& i : graph_builder.getFailedVertices())
     //      response.failed_waypoints.push_back(config_->waypoints[i]);
@@ -126,7 +219,14 @@ tesseract_common::StatusCode DescartesMotionPlanner<FloatType>::solve(const Plan
 
   // Search for edges
   std::vector<FloatType> solution;
-  if (!graph_builder.search(solution))
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("DescartesMotionPlanner was cancelled");
+    response.status = tesseract_common::StatusCode(DescartesMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
+  if (stop() || !graph_builder.search(solution))
   {
     CONSOLE_BRIDGE_logError("Search for graph completion failed");
     response.status = tesseract_common::StatusCode(DescartesMotionPlannerStatusCategory::ErrorFailedToFindValidSolution,
@@ -236,8 +336,8 @@ bool DescartesMotionPlanner<FloatType>::checkUserInput(const PlannerRequest& req
 template <typename FloatType>
 bool DescartesMotionPlanner<FloatType>::terminate()
 {
-  CONSOLE_BRIDGE_logWarn("Termination of ongoing optimization is not implemented yet");
-  return false;
+  cancelRunningSolves();
+  return true;
 }
 
 template <typename FloatType>
@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <descartes_light/utils.h>
 #include <console_bridge/console.h>
 #include <Eigen/Geometry>
+#include <algorithm>
+#include <limits>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -52,6 +54,7 @@ DescartesRobotSampler<FloatType>::DescartesRobotSampler(
   , robot_kinematics_(std::move(robot_kinematics))
   , collision_(std::move(collision))
   , tcp_(tcp)
+  , tcp_inverse_(tcp.inverse())
   , allow_collision_(allow_collision)
   , dof_(static_cast<int>(robot_kinematics_->numJoints()))
   , ik_seed_(Eigen::VectorXd::Zero(dof_))
@@ -62,18 +65,16 @@ DescartesRobotSampler<FloatType>::DescartesRobotSampler(
 template <typename FloatType>
 bool DescartesRobotSampler<FloatType>::sample(std::vector<FloatType>& solution_set)
 {
-  double distance = std::numeric_limits<double>::min();
-  tesseract_common::VectorIsometry3d target_poses = target_pose_sampler_(target_pose_);
-  for (const auto& sp : target_poses)
-  {
-    // Tool pose in rail coordinate system
-    Eigen::Isometry3d target_pose = sp * tcp_.inverse();
-    ikAt(solution_set, target_pose, false, distance);
-  }
+  // All sampled tool poses are solved into the solution set first, then filtered in place so no solution is copied
+  // into a temporary container
+  std::size_t begin = solution_set.size();
+  appendIKSolutions(solution_set, target_pose_sampler_(target_pose_));
 
-  if (solution_set.empty() && allow_collision_)
-    getBestSolution(solution_set, target_poses);
+  std::size_t end = removeSolutionsInCollision(solution_set, begin);
+  if (end == begin && allow_collision_ && moveBestSolution(solution_set, begin))
+    end = begin + static_cast<std::size_t>(dof_);
 
+  solution_set.resize(end);
   return !solution_set.empty();
 }
 
@@ -87,62 +88,83 @@ bool DescartesRobotSampler<FloatType>::isCollisionFree(const FloatType* vertex)
 }
 
 template <typename FloatType>
-bool DescartesRobotSampler<FloatType>::ikAt(std::vector<FloatType>& solution_set,
-                                            const Eigen::Isometry3d& target_pose,
-                                            bool get_best_solution,
-                                            double& distance)
+void DescartesRobotSampler<FloatType>::appendIKSolutions(std::vector<FloatType>& solution_set,
+                                                         const tesseract_common::VectorIsometry3d& target_poses)
 {
-  Eigen::VectorXd robot_solution_set;
-  auto robot_dof = static_cast<int>(robot_kinematics_->numJoints());
-  if (!robot_kinematics_->calcInvKin(robot_solution_set, target_pose, ik_seed_))
-    return false;
-
-  long num_sols = robot_solution_set.size() / robot_dof;
-  for (long i = 0; i < num_sols; i++)
+  const auto dof = static_cast<std::size_t>(dof_);
+  bool reserved = false;
+  for (const auto& sp : target_poses)
   {
-    double* sol = robot_solution_set.data() + robot_dof * i;
-
-    std::vector<FloatType> full_sol;
-    full_sol.insert(end(full_sol), std::make_move_iterator(sol), std::make_move_iterator(sol + robot_dof));
-
-    if ((is_valid_ != nullptr) && !(*is_valid_)(Eigen::Map<Eigen::Matrix<FloatType, Eigen::Dynamic, 1>>(
-                                      full_sol.data(), static_cast<long>(full_sol.size()))))
+    // Tool pose in rail coordinate system
+    Eigen::Isometry3d target_pose = sp * tcp_inverse_;
+    if (!robot_kinematics_->calcInvKin(ik_solutions_, target_pose, ik_seed_))
       continue;
 
-    if (!get_best_solution)
+    // Assume every pose has as many solutions as the first one solved
+    if (!reserved)
     {
-      if (isCollisionFree(full_sol.data()))
-        solution_set.insert(
-            end(solution_set), std::make_move_iterator(full_sol.begin()), std::make_move_iterator(full_sol.end()));
+      solution_set.reserve(solution_set.size() + static_cast<std::size_t>(ik_solutions_.size()) * target_poses.size());
+      reserved = true;
     }
-    else
+
+    const std::size_t num_sols = static_cast<std::size_t>(ik_solutions_.size()) / dof;
+    for (std::size_t i = 0; i < num_sols; ++i)
     {
-      double cur_distance = collision_->distance(full_sol.data(), full_sol.size());
-      if (cur_distance > distance)
-      {
-        distance = cur_distance;
-        solution_set.insert(
-            begin(solution_set), std::make_move_iterator(full_sol.begin()), std::make_move_iterator(full_sol.end()));
-      }
+      const double* sol = ik_solutions_.data() + dof * i;
+      const std::size_t offset = solution_set.size();
+      solution_set.resize(offset + dof);
+      std::copy(sol, sol + dof, solution_set.begin() + static_cast<long>(offset));
+
+      if ((is_valid_ != nullptr) && !(*is_valid_)(Eigen::Map<const Eigen::Matrix<FloatType, Eigen::Dynamic, 1>>(
+                                        solution_set.data() + offset, static_cast<long>(dof))))
+        solution_set.resize(offset);
     }
   }
+}
 
-  return !solution_set.empty();
+template <typename FloatType>
+std::size_t DescartesRobotSampler<FloatType>::removeSolutionsInCollision(std::vector<FloatType>& solution_set,
+                                                                         std::size_t begin)
+{
+  const auto dof = static_cast<std::size_t>(dof_);
+  std::size_t end = begin;
+  for (std::size_t i = begin; i < solution_set.size(); i += dof)
+  {
+    if (!isCollisionFree(solution_set.data() + i))
+      continue;
+
+    if (end != i)
+      std::copy_n(solution_set.begin() + static_cast<long>(i), dof, solution_set.begin() + static_cast<long>(end));
+
+    end += dof;
+  }
+
+  return end;
 }
 
 template <typename FloatType>
-bool DescartesRobotSampler<FloatType>::getBestSolution(std::vector<FloatType>& solution_set,
-                                                       const tesseract_common::VectorIsometry3d& target_poses)
+bool DescartesRobotSampler<FloatType>::moveBestSolution(std::vector<FloatType>& solution_set, std::size_t begin)
 {
-  double distance = std::numeric_limits<double>::min();
-  for (const auto& sp : target_poses)
+  if (collision_ == nullptr || solution_set.size() == begin)
+    return false;
+
+  const auto dof = static_cast<std::size_t>(dof_);
+  std::size_t best = begin;
+  double best_distance = std::numeric_limits<double>::lowest();
+  for (std::size_t i = begin; i < solution_set.size(); i += dof)
   {
-    // Tool pose in rail coordinate system
-    Eigen::Isometry3d target_pose = sp * tcp_.inverse();
-    ikAt(solution_set, target_pose, false, distance);
+    double distance = static_cast<double>(collision_->distance(solution_set.data() + i, dof));
+    if (distance > best_distance)
+    {
+      best_distance = distance;
+      best = i;
+    }
   }
 
-  return !solution_set.empty();
+  if (best != begin)
+    std::copy_n(solution_set.begin() + static_cast<long>(best), dof, solution_set.begin() + static_cast<long>(begin));
+
+  return true;
 }
 
 }  // namespace tesseract_planning
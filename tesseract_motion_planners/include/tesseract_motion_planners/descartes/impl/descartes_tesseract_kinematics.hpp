@@ -30,6 +30,7 @@
 #include <tesseract_motion_planners/descartes/descartes_tesseract_kinematics.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Eigen>
+#include <algorithm>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -60,62 +61,39 @@ bool DescartesTesseractKinematics<FloatType>::ik(
   if (!tesseract_ik_->calcInvKin(solution_eigen, p_double, ik_seed_))
     return false;
 
-  // Convert back to a float array
-  Eigen::Matrix<FloatType, Eigen::Dynamic, 1> solution_float_type;
-  solution_float_type = solution_eigen.template cast<FloatType>();
-  FloatType* sol = solution_float_type.data();
+  // Convert the solution directly into the end of the solution set, it is removed again if rejected
+  const std::size_t offset = solution_set.size();
+  solution_set.resize(offset + static_cast<std::size_t>(dof));
+  std::copy(solution_eigen.data(), solution_eigen.data() + dof, solution_set.begin() + static_cast<long>(offset));
+
+  FloatType* sol = solution_set.data() + offset;
 
   // Apply is_valid_fn and redundant_sol_fn
-  if (is_valid_fn && redundant_sol_fn)
+  if (redundant_sol_fn)
   {
-    if (is_valid_fn_(sol))
-      solution_set.insert(end(solution_set), sol, sol + dof);  // If good then add to solution set
-
+    // Get the redundant solutions before the solution can be removed
     std::vector<FloatType> redundant_sols = redundant_sol_fn(sol);
-    if (!redundant_sols.empty())
-    {
-      int num_sol = static_cast<int>(redundant_sols.size()) / dof;
-      for (int s = 0; s < num_sol; ++s)
-      {
-        FloatType* redundant_sol = redundant_sols.data() + dof * s;
-        if (is_valid_fn_(redundant_sol))
-          solution_set.insert(end(solution_set), redundant_sol, redundant_sol + dof);  // If good then add to solution
-                                                                                       // set
-      }
-    }
-  }
-  else if (is_valid_fn && !redundant_sol_fn)
-  {
-    if (is_valid_fn(sol))
-      solution_set.insert(end(solution_set), sol, sol + dof);  // If good then add to solution set
-    else
-    {
-      // If it failed the is_valid_fn get solution that is +/-pi and retry
-      descartes_light::harmonizeTowardZero<FloatType>(sol, dof);
-      if (is_valid_fn(sol))
-        solution_set.insert(end(solution_set), sol, sol + dof);
-    }
-  }
-  else if (!is_valid_fn && redundant_sol_fn)
-  {
-    solution_set.insert(end(solution_set), sol, sol + dof);  // If good then add to solution set
+    if (is_valid_fn && !is_valid_fn(sol))
+      solution_set.resize(offset);
 
-    std::vector<FloatType> redundant_sols = redundant_sol_fn(sol);
-    if (!redundant_sols.empty())
+    std::size_t num_sol = redundant_sols.size() / static_cast<std::size_t>(dof);
+    solution_set.reserve(solution_set.size() + redundant_sols.size());
+    for (std::size_t s = 0; s < num_sol; ++s)
     {
-      long num_sol = static_cast<long>(redundant_sols.size()) / dof;
-      for (long s = 0; s < num_sol; ++s)
-      {
-        FloatType* redundant_sol = redundant_sols.data() + dof * s;
+      FloatType* redundant_sol = redundant_sols.data() + static_cast<std::size_t>(dof) * s;
+      if (!is_valid_fn || is_valid_fn(redundant_sol))
         solution_set.insert(end(solution_set), redundant_sol, redundant_sol + dof);  // If good then add to solution
                                                                                      // set
-      }
     }
   }
-  else
+  else if (is_valid_fn && !is_valid_fn(sol))
   {
-    solution_set.insert(end(solution_set), sol, sol + dof);
+    // If it failed the is_valid_fn get solution that is +/-pi and retry
+    descartes_light::harmonizeTowardZero<FloatType>(sol, dof);
+    if (!is_valid_fn(sol))
+      solution_set.resize(offset);
   }
+
   return !solution_set.empty();
 }
 
@@ -26,6 +26,12 @@
 #ifndef TESSERACT_MOTION_PLANNERS_DESCARTES_IMPL_DESCARTES_DEFAULT_PLAN_PROFILE_HPP
 #define TESSERACT_MOTION_PLANNERS_DESCARTES_IMPL_DESCARTES_DEFAULT_PLAN_PROFILE_HPP
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/algorithm/string.hpp>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_command_language/move_instruction.h>
 #include <tesseract_command_language/plan_instruction.h>
 
@@ -33,6 +39,7 @@
 #include <tesseract_motion_planners/descartes/descartes_robot_sampler.h>
 #include <tesseract_motion_planners/descartes/descartes_collision.h>
 #include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
+#include <tesseract_motion_planners/descartes/descartes_edge_evaluators.h>
 
 #include <descartes_light/interface/collision_interface.h>
 #include <descartes_samplers/evaluators/euclidean_distance_edge_evaluator.h>
@@ -51,6 +58,11 @@ DescartesDefaultPlanProfile<FloatType>::DescartesDefaultPlanProfile(const tinyxm
   const tinyxml2::XMLElement* num_threads_element = xml_element.FirstChildElement("NumberThreads");
   const tinyxml2::XMLElement* allow_collisions_element = xml_element.FirstChildElement("AllowCollisions");
   const tinyxml2::XMLElement* debug_element = xml_element.FirstChildElement("Debug");
+  const tinyxml2::XMLElement* edge_max_joint_delta_element = xml_element.FirstChildElement("EdgeMaxJointDelta");
+  const tinyxml2::XMLElement* edge_reject_config_change_element =
+      xml_element.FirstChildElement("EdgeRejectConfigChange");
+  const tinyxml2::XMLElement* edge_config_sign_correction_element =
+      xml_element.FirstChildElement("EdgeConfigSignCorrection");
 
   tinyxml2::XMLError status;
 
@@ -159,6 +171,54 @@ DescartesDefaultPlanProfile<FloatType>::DescartesDefaultPlanProfile(const tinyxm
     if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
       throw std::runtime_error("DescartesPlanProfile: Error parsing Debug string");
   }
+
+  if (edge_max_joint_delta_element)
+  {
+    std::vector<std::string> delta_tokens;
+    std::string delta_string;
+    status = tesseract_common::QueryStringText(edge_max_joint_delta_element, delta_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("DescartesPlanProfile: Error parsing EdgeMaxJointDelta string");
+
+    // An empty element disables the check like a missing one
+    boost::trim(delta_string);
+    if (!delta_string.empty())
+    {
+      boost::split(delta_tokens, delta_string, boost::is_any_of(" "), boost::token_compress_on);
+
+      if (!tesseract_common::isNumeric(delta_tokens))
+        throw std::runtime_error("DescartesPlanProfile: EdgeMaxJointDelta are not all numeric values.");
+
+      edge_max_joint_delta.resize(static_cast<long>(delta_tokens.size()));
+      for (std::size_t i = 0; i < delta_tokens.size(); ++i)
+        tesseract_common::toNumeric<double>(delta_tokens[i], edge_max_joint_delta[static_cast<long>(i)]);
+    }
+  }
+
+  if (edge_reject_config_change_element)
+  {
+    status = edge_reject_config_change_element->QueryBoolText(&edge_reject_config_change);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("DescartesPlanProfile: Error parsing EdgeRejectConfigChange string");
+  }
+
+  if (edge_config_sign_correction_element)
+  {
+    std::vector<std::string> sign_tokens;
+    std::string sign_string;
+    status = tesseract_common::QueryStringText(edge_config_sign_correction_element, sign_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("DescartesPlanProfile: Error parsing EdgeConfigSignCorrection string");
+
+    boost::trim(sign_string);
+    boost::split(sign_tokens, sign_string, boost::is_any_of(" "), boost::token_compress_on);
+
+    if (sign_tokens.size() != 2 || !tesseract_common::isNumeric(sign_tokens))
+      throw std::runtime_error("DescartesPlanProfile: EdgeConfigSignCorrection must be two numeric values.");
+
+    for (std::size_t i = 0; i < sign_tokens.size(); ++i)
+      tesseract_common::toNumeric<int>(sign_tokens[i], edge_config_sign_correction[static_cast<long>(i)]);
+  }
 }
 
 template <typename FloatType>
@@ -184,8 +244,17 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
 
   typename descartes_light::CollisionInterface<FloatType>::Ptr ci = nullptr;
   if (enable_collision)
-    ci = std::make_shared<DescartesCollision<FloatType>>(
-        prob.env, active_links, prob.manip_inv_kin->getJointNames(), vertex_collision_check_config, debug);
+  {
+    // Every waypoint with the same active links and config shares one collision interface
+    const std::vector<std::string>& joint_names = prob.manip_inv_kin->getJointNames();
+    std::string key = getDescartesCollisionKey(active_links, joint_names, vertex_collision_check_config, debug);
+    auto& shared_ci = prob.vertex_collision_interfaces[key];
+    if (shared_ci == nullptr)
+      shared_ci = std::make_shared<DescartesCollision<FloatType>>(
+          prob.env, active_links, joint_names, vertex_collision_check_config, debug);
+
+    ci = shared_ci;
+  }
 
   Eigen::Isometry3d manip_baselink_to_waypoint = Eigen::Isometry3d::Identity();
   if (it == active_links.end())
@@ -220,38 +289,9 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
   }
   prob.samplers.push_back(std::move(sampler));
 
+  // Add edge Evaluator
   if (index != 0)
-  {
-    // Add edge Evaluator
-    if (edge_evaluator == nullptr)
-    {
-      if (enable_edge_collision)
-      {
-        auto compound_evaluator =
-            std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints());
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(
-                prob.manip_inv_kin->numJoints()));
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(prob.env,
-                                                                         active_links,
-                                                                         prob.manip_inv_kin->getJointNames(),
-                                                                         edge_collision_check_config,
-                                                                         allow_collision,
-                                                                         debug));
-        prob.edge_evaluators.push_back(compound_evaluator);
-      }
-      else
-      {
-        prob.edge_evaluators.push_back(std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(
-            prob.manip_inv_kin->numJoints()));
-      }
-    }
-    else
-    {
-      prob.edge_evaluators.push_back(edge_evaluator(prob));
-    }
-  }
+    prob.edge_evaluators.push_back(createEdgeEvaluator(prob, active_links));
 
   prob.num_threads = num_threads;
 }
@@ -269,40 +309,63 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
   auto sampler = std::make_shared<descartes_light::FixedJointPoseSampler<FloatType>>(joint_pose);
   prob.samplers.push_back(std::move(sampler));
 
+  // Add edge Evaluator
   if (index != 0)
+    prob.edge_evaluators.push_back(createEdgeEvaluator(prob, active_links));
+
+  prob.num_threads = num_threads;
+}
+
+template <typename FloatType>
+typename descartes_light::EdgeEvaluator<FloatType>::Ptr
+DescartesDefaultPlanProfile<FloatType>::createEdgeEvaluator(const DescartesProblem<FloatType>& prob,
+                                                            const std::vector<std::string>& active_links) const
+{
+  typename descartes_light::EdgeEvaluator<FloatType>::Ptr evaluator;
+  if (edge_evaluator != nullptr)
   {
-    // Add edge Evaluator
-    if (edge_evaluator == nullptr)
-    {
-      if (enable_edge_collision)
-      {
-        auto compound_evaluator =
-            std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints());
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(
-                prob.manip_inv_kin->numJoints()));
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(prob.env,
-                                                                         active_links,
-                                                                         prob.manip_inv_kin->getJointNames(),
-                                                                         edge_collision_check_config,
-                                                                         allow_collision,
-                                                                         debug));
-        prob.edge_evaluators.push_back(compound_evaluator);
-      }
-      else
-      {
-        prob.edge_evaluators.push_back(std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(
-            prob.manip_inv_kin->numJoints()));
-      }
-    }
-    else
-    {
-      prob.edge_evaluators.push_back(edge_evaluator(prob));
-    }
+    evaluator = edge_evaluator(prob);
+  }
+  else if (enable_edge_collision)
+  {
+    auto compound_evaluator =
+        std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints());
+    compound_evaluator->evaluators.push_back(
+        std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints()));
+    compound_evaluator->evaluators.push_back(
+        std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(prob.env,
+                                                                     active_links,
+                                                                     prob.manip_inv_kin->getJointNames(),
+                                                                     edge_collision_check_config,
+                                                                     allow_collision,
+                                                                     debug));
+    evaluator = compound_evaluator;
+  }
+  else
+  {
+    evaluator =
+        std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints());
   }
 
-  prob.num_threads = num_threads;
+  if (edge_max_joint_delta.size() == 0 && !edge_reject_config_change)
+    return evaluator;
+
+  // The compound evaluator stops at the first evaluator rejecting an edge so the cheap checks are placed first
+  auto pipeline = std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>(prob.manip_inv_kin->numJoints());
+  if (edge_max_joint_delta.size() != 0)
+  {
+    if (edge_max_joint_delta.size() != static_cast<long>(prob.manip_inv_kin->numJoints()))
+      throw std::runtime_error("DescartesDefaultPlanProfile: edge_max_joint_delta must have one element per joint!");
+
+    pipeline->evaluators.push_back(std::make_shared<DescartesJointDeltaEdgeEvaluator<FloatType>>(edge_max_joint_delta));
+  }
+
+  if (edge_reject_config_change)
+    pipeline->evaluators.push_back(std::make_shared<DescartesRobotConfigEdgeEvaluator<FloatType>>(
+        prob.manip_fwd_kin, edge_config_sign_correction));
+
+  pipeline->evaluators.push_back(evaluator);
+  return pipeline;
 }
 
 template <typename FloatType>
@@ -352,6 +415,28 @@ tinyxml2::XMLElement* DescartesDefaultPlanProfile<FloatType>::toXML(tinyxml2::XM
   debug_element->SetText(debug);
   xml_descartes->InsertEndChild(debug_element);
 
+  Eigen::IOFormat eigen_format(Eigen::StreamPrecision, Eigen::DontAlignCols, " ", " ");
+
+  // The joint delta check is disabled by leaving out the element
+  if (edge_max_joint_delta.size() != 0)
+  {
+    tinyxml2::XMLElement* edge_max_joint_delta_element = doc.NewElement("EdgeMaxJointDelta");
+    std::stringstream edge_max_joint_delta_string;
+    edge_max_joint_delta_string << edge_max_joint_delta.format(eigen_format);
+    edge_max_joint_delta_element->SetText(edge_max_joint_delta_string.str().c_str());
+    xml_descartes->InsertEndChild(edge_max_joint_delta_element);
+  }
+
+  tinyxml2::XMLElement* edge_reject_config_change_element = doc.NewElement("EdgeRejectConfigChange");
+  edge_reject_config_change_element->SetText(edge_reject_config_change);
+  xml_descartes->InsertEndChild(edge_reject_config_change_element);
+
+  tinyxml2::XMLElement* edge_config_sign_correction_element = doc.NewElement("EdgeConfigSignCorrection");
+  std::stringstream edge_config_sign_correction_string;
+  edge_config_sign_correction_string << edge_config_sign_correction.format(eigen_format);
+  edge_config_sign_correction_element->SetText(edge_config_sign_correction_string.str().c_str());
+  xml_descartes->InsertEndChild(edge_config_sign_correction_element);
+
   xml_planner->InsertEndChild(xml_descartes);
 
   // TODO: Add Edge Evaluator and IsValidFn?
@@ -27,6 +27,7 @@
 #define TESSERACT_MOTION_PLANNERS_DESCARTES_DEFAULT_PROBLEM_GENERATOR_H
 
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 #include <tesseract_motion_planners/descartes/descartes_problem.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_motion_planners/descartes/profile/descartes_profile.h>
@@ -77,10 +78,8 @@ DefaultDescartesProblemGenerator(const std::string& name,
     CONSOLE_BRIDGE_logError("Check Kinematics failed. This means that Inverse Kinematics does not agree with KDL "
                             "(TrajOpt). Did you change the URDF recently?");
 
-  std::vector<std::string> active_link_names = prob->manip_inv_kin->getActiveLinkNames();
-  auto adjacency_map = std::make_shared<tesseract_environment::AdjacencyMap>(
-      request.env->getSceneGraph(), active_link_names, request.env_state->link_transforms);
-  const std::vector<std::string>& active_links = adjacency_map->getActiveLinkNames();
+  KinematicMetadata::ConstPtr metadata = KinematicMetadataCache::get(*request.env, *prob->manip_inv_kin);
+  const std::vector<std::string>& active_links = metadata->active_link_names;
 
   // Flatten the input for planning
   auto instructions_flat = flattenProgram(request.instructions);
@@ -77,6 +77,19 @@ public:
   // Applied during edge evaluation
   bool enable_edge_collision{ false };
   tesseract_collision::CollisionCheckConfig edge_collision_check_config{ 0 };
+
+  /**
+   * @brief The maximum absolute change of each joint along an edge, disabled if empty
+   * @details Edges are rejected on this before the configuration check and any other edge evaluator
+   */
+  Eigen::VectorXd edge_max_joint_delta;
+
+  /** @brief If true edges changing the configuration of a six axis robot are rejected, see getRobotConfig */
+  bool edge_reject_config_change{ false };
+
+  /** @brief The sign correction for Joint 3 and Joint 5 used by the configuration check */
+  Eigen::Vector2i edge_config_sign_correction{ Eigen::Vector2i::Ones() };
+
   int num_threads{ 1 };
   bool allow_collision{ false };
   bool debug{ false };
@@ -96,6 +109,18 @@ public:
              int index) const override;
 
   tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
+
+protected:
+  /**
+   * @brief Create the edge evaluator of a waypoint
+   * @details The evaluators are ordered cheapest first so edges rejected by the joint delta or configuration checks
+   * are never collision checked
+   * @param prob The problem being created
+   * @param active_links The active links of the problem
+   * @return The edge evaluator
+   */
+  typename descartes_light::EdgeEvaluator<FloatType>::Ptr
+  createEdgeEvaluator(const DescartesProblem<FloatType>& prob, const std::vector<std::string>& active_links) const;
 };
 
 using DescartesDefaultPlanProfileF = DescartesDefaultPlanProfile<float>;
@@ -30,10 +30,10 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/MotionValidator.h>
 #include <ompl/base/StateValidityChecker.h>
-#include <mutex>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/core/thread_local_cache.h>
 #include <tesseract_environment/core/environment.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
 
@@ -90,19 +90,14 @@ private:
   /** @bried This will extract an Eigen::VectorXd from the OMPL State */
   OMPLStateExtractor extractor_;
 
-  // The items below are to cache the contact manager based on thread ID. Currently ompl is multi
-  // threaded but the methods used to implement collision checking are not thread safe. To prevent
-  // reconstructing the collision environment for every check this will cache a contact manager
-  // based on its thread ID.
+  // Currently ompl is multi threaded but the methods used to implement collision checking are not thread safe. To
+  // prevent reconstructing the collision environment for every check each thread is given its own clone.
 
-  /** @brief Contact manager caching mutex */
-  mutable std::mutex mutex_;
+  /** @brief The continuous contact manager per thread */
+  ThreadLocalCache<tesseract_collision::ContinuousContactManager> continuous_contact_managers_;
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::ContinuousContactManager::Ptr> continuous_contact_managers_;
-
-  /** @brief The state solver manager cache */
-  mutable std::map<unsigned long int, tesseract_environment::StateSolver::Ptr> state_solver_managers_;
+  /** @brief The state solver per thread */
+  ThreadLocalCache<tesseract_environment::StateSolver> state_solvers_;
 };
 }  // namespace tesseract_planning
 
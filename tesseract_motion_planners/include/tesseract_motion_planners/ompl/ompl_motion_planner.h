@@ -74,6 +74,20 @@ public:
    */
   OMPLPlanProfileMap plan_profiles;
 
+  /**
+   * @brief Plan profiles used instead of plan_profiles if set
+   * @details This allows referencing the immutable profile entries of a ProfileDictionary without copying them
+   */
+  std::shared_ptr<const OMPLPlanProfileMap> shared_plan_profiles;
+
+  /**
+   * @brief The maximum number of problems (freespace segments) solved at the same time, zero uses the hardware
+   * concurrency
+   *
+   * Each problem is solved with OMPL ParallelPlan, which also runs a thread per planner of the problem.
+   */
+  std::size_t max_concurrent_problems{ 0 };
+
   /**
    * @brief Sets up the OMPL problem then solves. It is intended to simplify setting up
    * and solving freespace motion problems.
@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/types.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap.h>
 #include <tesseract_environment/core/environment.h>
 
 #ifdef SWIG
@@ -133,6 +134,13 @@ struct OMPLProblem
    */
   std::vector<OMPLPlannerConfigurator::ConstPtr> planners;
 
+  /**
+   * @brief The roadmap shared with other problems, this may be null
+   *
+   * If set the planners supported by OMPLRoadmap are created from it and it is updated after solving
+   */
+  OMPLRoadmap::Ptr roadmap;
+
   /**
    * @bried This will extract an Eigen::VectorXd from the OMPL State ***REQUIRED***
    */
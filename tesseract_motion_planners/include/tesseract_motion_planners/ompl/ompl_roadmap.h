@@ -0,0 +1,213 @@
+/**
+ * @file ompl_roadmap.h
+ * @brief A roadmap shared by the PRM planners of multiple OMPL requests
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/base/Planner.h>
+#include <ompl/base/SpaceInformation.h>
+#include <Eigen/Core>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::OMPLRoadmap)
+%shared_ptr(tesseract_planning::OMPLRoadmapCache)
+%ignore tesseract_planning::OMPLRoadmap::createPlanner;
+%ignore tesseract_planning::OMPLRoadmap::update;
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe roadmap grown by the PRM planners of every request using it
+ *
+ * The roadmap is stored independent of any space information as joint states and the edges between them, so it
+ * outlives the problems it was built by. A planner created from it is a LazyPRM holding a copy of the roadmap where
+ * every vertex and edge is marked unchecked. Only the vertices and edges of candidate paths are collision checked, so
+ * when the environment changes the roadmap is kept and the affected edges are found and removed while querying it.
+ *
+ * The roadmaps grown by the planners of concurrent requests are merged, vertices with the same joint state are only
+ * stored once. The roadmap remembers the vertices and edges each planner was created with, so the ones the planner
+ * removed because they are in collision are removed from the roadmap as well, unless the planner was solved with an
+ * older environment revision than the last update. Vertices and edges a planner was created with are never added
+ * back, so ones removed by another planner in the meantime stay removed.
+ *
+ * The number of vertices is bounded, the oldest vertices and their edges are removed first, since every planner
+ * created from the roadmap holds a copy of it.
+ *
+ * Only real vector state spaces are supported.
+ */
+class OMPLRoadmap
+{
+public:
+  using Ptr = std::shared_ptr<OMPLRoadmap>;
+  using ConstPtr = std::shared_ptr<const OMPLRoadmap>;
+
+  /**
+   * @brief Check if a planner type can use a roadmap
+   * @param type The planner type
+   * @return True for PRM, PRMstar and LazyPRMstar, otherwise false
+   */
+  static bool isSupported(OMPLPlannerType type);
+
+  /**
+   * @brief Create a planner connected to a copy of the roadmap
+   * @details PRM is replaced by LazyPRM while PRMstar and LazyPRMstar are replaced by LazyPRMstar. PRM checks every
+   * vertex and edge when it is added, which is not possible for a roadmap built in another environment revision, while
+   * the lazy planners only check them when they are part of a candidate path. The parameters of the planner created
+   * by the configurator, like PRMConfigurator::max_nearest_neighbors, are copied to the lazy planner when it has a
+   * parameter with the same name. Parameters it does not have are dropped.
+   * @param si The space information of the problem
+   * @param configurator The configurator of the planner, its type must be supported
+   * @return The planner
+   */
+  ompl::base::PlannerPtr createPlanner(const ompl::base::SpaceInformationPtr& si,
+                                       const OMPLPlannerConfigurator& configurator) const;
+
+  /**
+   * @brief Merge the roadmap of a planner into the roadmap
+   * @details The vertices and edges the planner was created with but no longer has are removed, if the revision is
+   * not older than the revision of the last update.
+   * @param planner A planner created by createPlanner after solving, or any LazyPRM whose roadmap is only added
+   * @param revision The environment revision the planner was solved with
+   */
+  void update(const ompl::base::Planner& planner, int revision);
+
+  /** @brief Set the maximum number of vertices, the oldest vertices are removed when it is exceeded */
+  void setMaxVertexCount(std::size_t max_vertex_count);
+
+  /** @brief Get the maximum number of vertices */
+  std::size_t getMaxVertexCount() const;
+
+  /** @brief The number of vertices in the roadmap */
+  std::size_t getVertexCount() const;
+
+  /** @brief The number of edges in the roadmap */
+  std::size_t getEdgeCount() const;
+
+  /** @brief The environment revision of the last update, -1 if it was never updated */
+  int getRevision() const;
+
+  /** @brief Remove all vertices and edges */
+  void clear();
+
+private:
+  /** @brief Orders joint states lexicographically so equal states are found */
+  struct VertexLess
+  {
+    bool operator()(const Eigen::VectorXd& lhs, const Eigen::VectorXd& rhs) const
+    {
+      return std::lexicographical_compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());
+    }
+  };
+
+  /** @brief The vertices and edges a planner was created with */
+  struct PlannerRoadmap
+  {
+    std::weak_ptr<const ompl::base::Planner> planner;
+
+    /** @brief The joint state of each vertex */
+    std::vector<Eigen::VectorXd> vertices;
+
+    /** @brief The indices in vertices of each edge, sorted and the first index is the smaller one */
+    std::vector<std::pair<unsigned, unsigned>> edges;
+  };
+
+  mutable std::mutex mutex_;
+
+  /** @brief The joint state of each vertex by id, ids are increasing so the oldest vertex is first */
+  std::map<std::size_t, Eigen::VectorXd> vertices_;
+
+  /** @brief The id of each vertex by joint state */
+  std::map<Eigen::VectorXd, std::size_t, VertexLess> vertex_ids_;
+
+  /** @brief The vertex ids of each edge, the first id is the smaller one */
+  std::set<std::pair<std::size_t, std::size_t>> edges_;
+
+  /** @brief The roadmaps of the planners created which were not updated yet */
+  mutable std::vector<PlannerRoadmap> planners_;
+
+  std::size_t next_vertex_id_{ 0 };
+  std::size_t max_vertex_count_{ 10000 };
+  int revision_{ -1 };
+
+  /** @brief Add a vertex, the caller must hold the lock */
+  std::size_t addVertex(const Eigen::VectorXd& vertex);
+
+  /** @brief Remove vertices and their edges, the caller must hold the lock */
+  void removeVertices(const std::set<std::size_t>& ids);
+
+  /** @brief Remove the oldest vertices until the maximum is met, the caller must hold the lock */
+  void prune();
+};
+
+/** @brief Provides a roadmap per key, used to share roadmaps per manipulator across requests */
+class OMPLRoadmapCache
+{
+public:
+  using Ptr = std::shared_ptr<OMPLRoadmapCache>;
+  using ConstPtr = std::shared_ptr<const OMPLRoadmapCache>;
+
+  /**
+   * @brief Get the roadmap of a key, creating an empty roadmap if it does not exist
+   * @param key The key, see getKey
+   * @return The roadmap
+   */
+  OMPLRoadmap::Ptr get(const std::string& key);
+
+  /** @brief The number of roadmaps */
+  std::size_t size() const;
+
+  /** @brief Remove all roadmaps */
+  void clear();
+
+  /**
+   * @brief Get the key of a manipulator
+   * @param manipulator The name of the manipulator
+   * @param joint_names The joint names of the state space, in order
+   * @return The key
+   */
+  static std::string getKey(const std::string& manipulator, const std::vector<std::string>& joint_names);
+
+private:
+  mutable std::mutex mutex_;
+  std::map<std::string, OMPLRoadmap::Ptr> roadmaps_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_H
@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_profile.h>
 #include <tesseract_motion_planners/ompl/types.h>
 
@@ -102,6 +103,13 @@ public:
   std::vector<OMPLPlannerConfigurator::ConstPtr> planners = { std::make_shared<const RRTConnectConfigurator>(),
                                                               std::make_shared<const RRTConnectConfigurator>() };
 
+  /**
+   * @brief If set the PRM planners share a roadmap per manipulator across requests, see OMPLRoadmap
+   *
+   * Only supported for the real state space
+   */
+  OMPLRoadmapCache::Ptr roadmap_cache;
+
   /** @brief If true, collision checking will be enabled. Default: true*/
   bool collision_check = true;
 
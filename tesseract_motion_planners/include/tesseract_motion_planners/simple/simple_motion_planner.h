@@ -30,6 +30,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -84,6 +85,13 @@ public:
    */
   SimplePlannerPlanProfileMap plan_profiles;
 
+  /**
+   * @brief Profile maps used instead of composite_profiles and plan_profiles if set
+   * @details This allows referencing the immutable profile entries of a ProfileDictionary without copying them
+   */
+  std::shared_ptr<const SimplePlannerCompositeProfileMap> shared_composite_profiles;
+  std::shared_ptr<const SimplePlannerPlanProfileMap> shared_plan_profiles;
+
   /**
    * @brief Sets up the opimizer and solves a SQP problem read from json with no callbacks and dafault parameterss
    * @param response The results of the optimization. Primary output is the optimized joint trajectory
@@ -112,9 +120,14 @@ protected:
                                       const tesseract_environment::EnvState::ConstPtr& current_state,
                                       const tesseract_kinematics::ForwardKinematics::Ptr& fwd_kin) const;
 
+  /**
+   * @brief Process the plan instructions of a composite into the seed
+   * @details Processing stops before the next instruction once cancelled returns true, leaving the seed incomplete
+   */
   CompositeInstruction processCompositeInstruction(const CompositeInstruction& instructions,
                                                    Waypoint& start_waypoint,
-                                                   const PlannerRequest& request) const;
+                                                   const PlannerRequest& request,
+                                                   const std::function<bool()>& cancelled) const;
 };
 
 class SimpleMotionPlannerStatusCategory : public tesseract_common::StatusCategory
@@ -129,6 +142,7 @@ public:
     SolutionFound = 0,
     ErrorInvalidInput = -1,
     FailedToFindValidSolution = -3,
+    Cancelled = -4,
   };
 
 private:
@@ -87,6 +87,14 @@ public:
    */
   TrajOptPlanProfileMap plan_profiles;
 
+  /**
+   * @brief Profile maps used instead of solver_profiles, composite_profiles and plan_profiles if set
+   * @details This allows referencing the immutable profile entries of a ProfileDictionary without copying them
+   */
+  std::shared_ptr<const TrajOptSolverProfileMap> shared_solver_profiles;
+  std::shared_ptr<const TrajOptCompositeProfileMap> shared_composite_profiles;
+  std::shared_ptr<const TrajOptPlanProfileMap> shared_plan_profiles;
+
   /** @brief Callback functions called on each iteration of the optimization (Optional) */
   std::vector<sco::Optimizer::Callback> callbacks;
 
@@ -129,6 +137,7 @@ public:
     SolutionFound = 0,
     ErrorInvalidInput = -1,
     FailedToFindValidSolution = -3,
+    Cancelled = -4,
   };
 
 private:
@@ -0,0 +1,103 @@
+/**
+ * @file cpu_budget.cpp
+ * @brief A process wide budget of the threads used by the planners
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/cpu_budget.h>
+
+namespace tesseract_planning
+{
+CPUBudget::Lease::Lease(CPUBudget* budget, std::size_t count) : budget_(budget), count_(count) {}
+
+CPUBudget::Lease::~Lease() { release(); }
+
+CPUBudget::Lease::Lease(Lease&& other) noexcept : budget_(other.budget_), count_(other.count_)
+{
+  other.budget_ = nullptr;
+  other.count_ = 0;
+}
+
+CPUBudget::Lease& CPUBudget::Lease::operator=(Lease&& other) noexcept
+{
+  if (this != &other)
+  {
+    release();
+    budget_ = other.budget_;
+    count_ = other.count_;
+    other.budget_ = nullptr;
+    other.count_ = 0;
+  }
+  return *this;
+}
+
+std::size_t CPUBudget::Lease::size() const { return count_; }
+
+void CPUBudget::Lease::release()
+{
+  if (budget_ != nullptr && count_ > 0)
+    budget_->release(count_);
+
+  budget_ = nullptr;
+  count_ = 0;
+}
+
+CPUBudget::CPUBudget(std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+CPUBudget& CPUBudget::getGlobal()
+{
+  static CPUBudget budget;
+  return budget;
+}
+
+void CPUBudget::setCapacity(std::size_t capacity) { capacity_ = std::max<std::size_t>(capacity, 1); }
+
+std::size_t CPUBudget::getCapacity() const { return capacity_; }
+
+std::size_t CPUBudget::getUsed() const { return used_; }
+
+CPUBudget::Lease CPUBudget::borrow(std::size_t count)
+{
+  std::size_t used = used_.load();
+  std::size_t granted = 0;
+  do
+  {
+    const std::size_t capacity = capacity_.load();
+    granted = std::min(count, (capacity > used) ? capacity - used : 0);
+    if (granted == 0)
+      return Lease();
+  } while (!used_.compare_exchange_weak(used, used + granted));
+
+  return Lease(this, granted);
+}
+
+void CPUBudget::acquire(std::size_t count) { used_ += count; }
+
+void CPUBudget::release(std::size_t count) { used_ -= count; }
+
+}  // namespace tesseract_planning
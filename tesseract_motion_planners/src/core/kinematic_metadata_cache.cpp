@@ -0,0 +1,90 @@
+/**
+ * @file kinematic_metadata_cache.cpp
+ * @brief A cache of the kinematic information of manipulators derived from the scene graph
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
+
+namespace tesseract_planning
+{
+KinematicMetadata::ConstPtr KinematicMetadataCache::get(const tesseract_environment::Environment& env,
+                                                        const std::string& manipulator,
+                                                        const std::function<KinematicMetadata::Ptr()>& create)
+{
+  tesseract_scene_graph::SceneGraph::ConstPtr scene_graph = env.getSceneGraph();
+  Key key(scene_graph.get(), env.getRevision(), manipulator);
+
+  {
+    std::shared_lock lock(getMutex());
+    auto it = getEntries().find(key);
+    if (it != getEntries().end() && !it->second.scene_graph.expired())
+      return it->second.metadata;
+  }
+
+  KinematicMetadata::Ptr metadata = create();
+  tesseract_environment::AdjacencyMap map(
+      scene_graph, metadata->active_link_names, env.getCurrentState()->link_transforms);
+  metadata->active_link_names = map.getActiveLinkNames();
+
+  std::unique_lock lock(getMutex());
+  std::map<Key, Entry>& entries = getEntries();
+  for (auto it = entries.begin(); it != entries.end();)
+  {
+    // Remove the entries of destroyed scene graphs and of previous revisions of this scene graph
+    if (it->second.scene_graph.expired() ||
+        (std::get<0>(it->first) == std::get<0>(key) && std::get<1>(it->first) < std::get<1>(key)))
+      it = entries.erase(it);
+    else
+      ++it;
+  }
+
+  entries[key] = Entry{ scene_graph, metadata };
+  return metadata;
+}
+
+std::size_t KinematicMetadataCache::size()
+{
+  std::shared_lock lock(getMutex());
+  return getEntries().size();
+}
+
+void KinematicMetadataCache::clear()
+{
+  std::unique_lock lock(getMutex());
+  getEntries().clear();
+}
+
+std::map<KinematicMetadataCache::Key, KinematicMetadataCache::Entry>& KinematicMetadataCache::getEntries()
+{
+  static std::map<Key, Entry> entries;
+  return entries;
+}
+
+std::shared_mutex& KinematicMetadataCache::getMutex()
+{
+  static std::shared_mutex mutex;
+  return mutex;
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,128 @@
+/**
+ * @file link_transform_batch.cpp
+ * @brief A reusable buffer of link transforms for a batch of joint states
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/link_transform_batch.h>
+
+namespace tesseract_planning
+{
+LinkTransformBatch::LinkTransformBatch(tesseract_environment::StateSolver& state_solver,
+                                       std::vector<std::string> joint_names,
+                                       std::vector<std::string> link_names)
+  : state_solver_(&state_solver)
+  , joint_names_(std::move(joint_names))
+  , link_names_(std::move(link_names))
+{
+  resolveTransforms();
+}
+
+void LinkTransformBatch::compute(const Eigen::Ref<const tesseract_common::TrajArray>& states)
+{
+  states_ = states;
+  computeStates();
+}
+
+void LinkTransformBatch::interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
+                                     const Eigen::Ref<const Eigen::VectorXd>& end,
+                                     long count)
+{
+  if (count < 2)
+    throw std::runtime_error("LinkTransformBatch: interpolate requires at least two states");
+
+  // Resizing to the same shape does not reallocate
+  states_.resize(count, start.size());
+  for (long iVar = 0; iVar < start.size(); ++iVar)
+    states_.col(iVar) = Eigen::VectorXd::LinSpaced(count, start(iVar), end(iVar));
+
+  computeStates();
+}
+
+long LinkTransformBatch::size() const { return states_.rows(); }
+
+const tesseract_common::TrajArray& LinkTransformBatch::states() const { return states_; }
+
+const std::vector<std::string>& LinkTransformBatch::getJointNames() const { return joint_names_; }
+
+const std::vector<std::string>& LinkTransformBatch::getLinkNames() const { return link_names_; }
+
+const Eigen::Isometry3d& LinkTransformBatch::getTransform(long state_idx, std::size_t link_idx) const
+{
+  return transforms_[static_cast<std::size_t>(state_idx) * link_names_.size() + link_idx];
+}
+
+void LinkTransformBatch::setCollisionObjectsTransform(tesseract_collision::DiscreteContactManager& manager,
+                                                      long state_idx) const
+{
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+    manager.setCollisionObjectsTransform(link_names_[i], getTransform(state_idx, i));
+}
+
+void LinkTransformBatch::setCollisionObjectsTransform(tesseract_collision::ContinuousContactManager& manager,
+                                                      long state0_idx,
+                                                      long state1_idx) const
+{
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+    manager.setCollisionObjectsTransform(link_names_[i], getTransform(state0_idx, i), getTransform(state1_idx, i));
+}
+
+void LinkTransformBatch::computeStates()
+{
+  const std::size_t link_cnt = link_names_.size();
+  transforms_.resize(static_cast<std::size_t>(states_.rows()) * link_cnt);
+
+  for (long s = 0; s < states_.rows(); ++s)
+  {
+    state_solver_->setState(joint_names_, states_.row(s).transpose());
+
+    // A state solver which replaces its state object instead of updating it in place would leave the locations stale
+    if (state_solver_->getCurrentState() != solver_state_)
+      resolveTransforms();
+
+    Eigen::Isometry3d* dst = &transforms_[static_cast<std::size_t>(s) * link_cnt];
+    for (std::size_t i = 0; i < link_cnt; ++i)
+      dst[i] = *solver_transforms_[i];
+  }
+}
+
+void LinkTransformBatch::resolveTransforms()
+{
+  solver_state_ = state_solver_->getCurrentState();
+  solver_transforms_.clear();
+  solver_transforms_.reserve(link_names_.size());
+  for (const auto& link_name : link_names_)
+  {
+    auto it = solver_state_->link_transforms.find(link_name);
+    if (it == solver_state_->link_transforms.end())
+      throw std::runtime_error("LinkTransformBatch: link '" + link_name + "' does not exist in the state solver");
+
+    solver_transforms_.push_back(&(it->second));
+  }
+}
+
+}  // namespace tesseract_planning
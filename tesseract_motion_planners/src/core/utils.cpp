@@ -27,6 +27,9 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 #include <memory>
+#include <atomic>
+#include <functional>
+#include <thread>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -37,6 +40,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_command_language/command_language.h>
 #include <tesseract_command_language/utils/utils.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/link_transform_batch.h>
+#include <tesseract_motion_planners/core/cpu_budget.h>
 
 namespace tesseract_planning
 {
@@ -172,157 +177,141 @@ flattenProgramToPattern(const CompositeInstruction& composite_instruction, const
   return flattenToPattern(composite_instruction, pattern, programFlattenFilter);
 }
 
-bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                         tesseract_collision::ContinuousContactManager& manager,
-                         const tesseract_environment::StateSolver& state_solver,
-                         const CompositeInstruction& program,
-                         const tesseract_collision::CollisionCheckConfig& config)
+/** @brief The number of chunks each worker is given on average when checking a program in parallel */
+static const std::size_t CONTACT_CHECK_CHUNKS_PER_THREAD = 4;
+
+/**
+ * @brief Signature of a function checking the steps [begin, end) of a flattened program
+ * @details state_solver is only read with getState. batch_state_solver is the solver driven by a LinkTransformBatch,
+ * it is a clone of state_solver created on first use and kept by the caller for its following calls.
+ */
+template <typename ManagerType>
+using ContactCheckStepsFn = std::function<bool(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                               ManagerType& manager,
+                                               const tesseract_environment::StateSolver& state_solver,
+                                               tesseract_environment::StateSolver::Ptr& batch_state_solver,
+                                               std::size_t begin,
+                                               std::size_t end,
+                                               const std::function<bool()>& cancelled)>;
+
+/**
+ * @brief Get a batch of the active collision objects of a manager, the current batch is reused if its joints match
+ * @details Only interpolated motions are worth computing as a batch, so the state solver it drives is cloned here on
+ * first use instead of for every check
+ */
+template <typename ManagerType>
+static LinkTransformBatch& getLinkTransformBatch(LinkTransformBatch::Ptr& batch,
+                                                 tesseract_environment::StateSolver::Ptr& batch_state_solver,
+                                                 const tesseract_environment::StateSolver& state_solver,
+                                                 const ManagerType& manager,
+                                                 const std::vector<std::string>& joint_names)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type (Continuous)");
-  bool found = false;
+  if (batch != nullptr && batch->getJointNames() == joint_names)
+    return *batch;
 
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-  {
-    assert(config.longest_valid_segment_length > 0);
+  if (batch_state_solver == nullptr)
+    batch_state_solver = state_solver.clone();
 
-    // Flatten results
-    std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
+  batch = std::make_shared<LinkTransformBatch>(*batch_state_solver, joint_names, manager.getActiveCollisionObjects());
+  return *batch;
+}
 
-    contacts.reserve(mi.size() - 1);
-    for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
-    {
-      const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-      const auto* swp1 =
-          mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+/**
+ * @brief Run a contact test on a manager whose transforms have already been set
+ * @details Matches tesseract_environment::checkTrajectoryState/checkTrajectorySegment, the results are only stored if
+ * a contact was found.
+ * @return True if a contact was found
+ */
+template <typename ManagerType>
+static bool contactTest(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                        ManagerType& manager,
+                        const tesseract_collision::CollisionCheckConfig& config)
+{
+  tesseract_collision::ContactResultMap collisions;
+  manager.contactTest(collisions, config.contact_request);
+  if (collisions.empty())
+    return false;
+
+  contacts.push_back(std::move(collisions));
+  return true;
+}
 
-      // TODO: Should check joint names and make sure they are in the same order
-      double dist = (swp1->position - swp0->position).norm();
-      if (dist > config.longest_valid_segment_length)
+/**
+ * @brief Perform a continuous collision check over the segments [begin, end) of a flattened program
+ * @details Segment i is the motion between move instruction i and i + 1.
+ * @param cancelled If provided, it is called before each collision check and the check is abandoned if it returns true
+ */
+static bool contactCheckSegments(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                 tesseract_collision::ContinuousContactManager& manager,
+                                 const tesseract_environment::StateSolver& state_solver,
+                                 tesseract_environment::StateSolver::Ptr& batch_state_solver,
+                                 const std::vector<std::reference_wrapper<const Instruction>>& mi,
+                                 std::size_t begin,
+                                 std::size_t end,
+                                 const tesseract_collision::CollisionCheckConfig& config,
+                                 const std::function<bool()>& cancelled)
+{
+  bool found = false;
+  LinkTransformBatch::Ptr batch_ptr;
+  for (std::size_t iStep = begin; iStep < end; ++iStep)
+  {
+    const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+    const auto* swp1 = mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+
+    // TODO: Should check joint names and make sure they are in the same order
+    double dist = (swp1->position - swp0->position).norm();
+    if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS &&
+        dist > config.longest_valid_segment_length)
+    {
+      long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+      LinkTransformBatch& batch =
+          getLinkTransformBatch(batch_ptr, batch_state_solver, state_solver, manager, swp0->joint_names);
+      batch.interpolate(swp0->position, swp1->position, cnt);
+      for (long iSubStep = 0; iSubStep < batch.size() - 1; ++iSubStep)
       {
-        long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, swp0->position.size());
-        for (long iVar = 0; iVar < swp0->position.size(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, swp0->position(iVar), swp1->position(iVar));
+        if (cancelled && cancelled())
+          return found;
 
-        for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
+        batch.setCollisionObjectsTransform(manager, iSubStep, iSubStep + 1);
+        if (contactTest(contacts, manager, config))
         {
-          tesseract_environment::EnvState::Ptr state0 = state_solver.getState(swp0->joint_names, subtraj.row(iSubStep));
-          tesseract_environment::EnvState::Ptr state1 =
-              state_solver.getState(swp0->joint_names, subtraj.row(iSubStep + 1));
-          if (checkTrajectorySegment(contacts, manager, state0, state1, config))
+          found = true;
+          if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
           {
-            found = true;
-            if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-            {
-              std::stringstream ss;
-              ss << "Continuous collision detected at step: " << iStep << " of " << (mi.size() - 1)
-                 << " substep: " << iSubStep << std::endl;
-
-              ss << "     Names:";
-              for (const auto& name : swp0->joint_names)
-                ss << " " << name;
-
-              ss << std::endl
-                 << "    State0: " << subtraj.row(iSubStep) << std::endl
-                 << "    State1: " << subtraj.row(iSubStep + 1) << std::endl;
-
-              CONSOLE_BRIDGE_logError(ss.str().c_str());
-            }
-          }
+            std::stringstream ss;
+            ss << "Continuous collision detected at step: " << iStep << " of " << (mi.size() - 1)
+               << " substep: " << iSubStep << std::endl;
 
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
-        }
+            ss << "     Names:";
+            for (const auto& name : swp0->joint_names)
+              ss << " " << name;
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-      else
-      {
-        // Flatten results
-        std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
+            ss << std::endl
+               << "    State0: " << batch.states().row(iSubStep) << std::endl
+               << "    State1: " << batch.states().row(iSubStep + 1) << std::endl;
 
-        contacts.reserve(mi.size() - 1);
-        for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
-        {
-          const auto* swp0 =
-              mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-          const auto* swp1 =
-              mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-
-          // TODO: Should check joint names and make sure they are in the same order
-          double dist = (swp1->position - swp0->position).norm();
-          if (dist > config.longest_valid_segment_length)
-          {
-            long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-            tesseract_common::TrajArray subtraj(cnt, swp0->position.size());
-            for (long iVar = 0; iVar < swp0->position.size(); ++iVar)
-              subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, swp0->position(iVar), swp1->position(iVar));
-
-            for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
-            {
-              tesseract_environment::EnvState::Ptr state0 =
-                  state_solver.getState(swp0->joint_names, subtraj.row(iSubStep));
-              tesseract_environment::EnvState::Ptr state1 =
-                  state_solver.getState(swp0->joint_names, subtraj.row(iSubStep + 1));
-              if (checkTrajectorySegment(contacts, manager, state0, state1, config))
-              {
-                found = true;
-                if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-                {
-                  std::stringstream ss;
-                  ss << "Continuous collision detected at step: " << iStep << " of " << (mi.size() - 1)
-                     << " substep: " << iSubStep << std::endl;
-
-                  ss << "     Names:";
-                  for (const auto& name : swp0->joint_names)
-                    ss << " " << name;
-
-                  ss << std::endl
-                     << "    State0: " << subtraj.row(iSubStep) << std::endl
-                     << "    State1: " << subtraj.row(iSubStep + 1) << std::endl;
-
-                  CONSOLE_BRIDGE_logError(ss.str().c_str());
-                }
-              }
-
-              if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-                break;
-            }
-
-            if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-              break;
+            CONSOLE_BRIDGE_logError(ss.str().c_str());
           }
         }
+
+        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+          return found;
       }
     }
-  }
-  else
-  {
-    bool found = false;
-
-    // Flatten results
-    std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
-
-    contacts.reserve(mi.size());
-    for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
+    else
     {
-      const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-      const auto* swp1 =
-          mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+      if (cancelled && cancelled())
+        return found;
+
       tesseract_environment::EnvState::Ptr state0 = state_solver.getState(swp0->joint_names, swp0->position);
       tesseract_environment::EnvState::Ptr state1 = state_solver.getState(swp1->joint_names, swp1->position);
-
       if (checkTrajectorySegment(contacts, manager, state0, state1, config))
       {
         found = true;
         if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
         {
           std::stringstream ss;
-          ss << "Discrete collision detected at step: " << iStep << " of " << (mi.size() - 1) << std::endl;
+          ss << "Continuous collision detected at step: " << iStep << " of " << (mi.size() - 1) << std::endl;
 
           ss << "     Names:";
           for (const auto& name : swp0->joint_names)
@@ -337,115 +326,80 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
       }
 
       if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-        break;
+        return found;
     }
   }
   return found;
 }
 
-bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                         tesseract_collision::DiscreteContactManager& manager,
-                         const tesseract_environment::StateSolver& state_solver,
-                         const CompositeInstruction& program,
-                         const tesseract_collision::CollisionCheckConfig& config)
+/**
+ * @brief Perform a discrete collision check over the states [begin, end) of a flattened program
+ * @details For LVS_DISCRETE, state i also covers the interpolated states between move instruction i and i + 1.
+ * @param cancelled If provided, it is called before each collision check and the check is abandoned if it returns true
+ */
+static bool contactCheckStates(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                               tesseract_collision::DiscreteContactManager& manager,
+                               const tesseract_environment::StateSolver& state_solver,
+                               tesseract_environment::StateSolver::Ptr& batch_state_solver,
+                               const std::vector<std::reference_wrapper<const Instruction>>& mi,
+                               std::size_t begin,
+                               std::size_t end,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               const std::function<bool()>& cancelled)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
-    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type (Discrete)");
   bool found = false;
-
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  LinkTransformBatch::Ptr batch_ptr;
+  for (std::size_t iStep = begin; iStep < end; ++iStep)
   {
-    assert(config.longest_valid_segment_length > 0);
-
-    // Flatten results
-    std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
+    const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+    const StateWaypoint* swp1 = nullptr;
 
-    contacts.reserve(mi.size());
-    for (std::size_t iStep = 0; iStep < mi.size(); ++iStep)
+    double dist = -1;
+    if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE && iStep < mi.size() - 1)
     {
-      const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-      const StateWaypoint* swp1 = nullptr;
-
-      double dist = -1;
-      if (iStep < mi.size() - 1)
-      {
-        swp1 = mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
-        dist = (swp1->position - swp0->position).norm();
-      }
+      swp1 = mi.at(iStep + 1).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+      dist = (swp1->position - swp0->position).norm();
+    }
 
-      if (dist > 0 && dist > config.longest_valid_segment_length)
+    if (dist > 0 && dist > config.longest_valid_segment_length)
+    {
+      long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+      LinkTransformBatch& batch =
+          getLinkTransformBatch(batch_ptr, batch_state_solver, state_solver, manager, swp0->joint_names);
+      batch.interpolate(swp0->position, swp1->position, cnt);
+      for (long iSubStep = 0; iSubStep < batch.size() - 1; ++iSubStep)
       {
-        int cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, swp0->position.size());
-        for (long iVar = 0; iVar < swp0->position.size(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, swp0->position(iVar), swp1->position(iVar));
-
-        for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
-        {
-          tesseract_environment::EnvState::Ptr state = state_solver.getState(swp0->joint_names, subtraj.row(iSubStep));
-          if (checkTrajectoryState(contacts, manager, state, config))
-          {
-            found = true;
-            if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-            {
-              std::stringstream ss;
-              ss << "Discrete collision detected at step: " << iStep << " of " << (mi.size() - 1)
-                 << " substate: " << iSubStep << std::endl;
-
-              ss << "     Names:";
-              for (const auto& name : swp0->joint_names)
-                ss << " " << name;
-
-              ss << std::endl << "    State: " << subtraj.row(iSubStep) << std::endl;
-
-              CONSOLE_BRIDGE_logError(ss.str().c_str());
-            }
-          }
-
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
-        }
+        if (cancelled && cancelled())
+          return found;
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-      else
-      {
-        tesseract_environment::EnvState::Ptr state = state_solver.getState(swp0->joint_names, swp0->position);
-        if (checkTrajectoryState(contacts, manager, state, config))
+        batch.setCollisionObjectsTransform(manager, iSubStep);
+        if (contactTest(contacts, manager, config))
         {
           found = true;
           if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
           {
             std::stringstream ss;
-            ss << "Discrete collision detected at step: " << iStep << " of " << (mi.size() - 1) << std::endl;
+            ss << "Discrete collision detected at step: " << iStep << " of " << (mi.size() - 1)
+               << " substate: " << iSubStep << std::endl;
 
             ss << "     Names:";
             for (const auto& name : swp0->joint_names)
               ss << " " << name;
 
-            ss << std::endl << "    State: " << swp0->position << std::endl;
+            ss << std::endl << "    State: " << batch.states().row(iSubStep) << std::endl;
 
             CONSOLE_BRIDGE_logError(ss.str().c_str());
           }
         }
 
         if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
+          return found;
       }
     }
-  }
-  else
-  {
-    // Flatten results
-    std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
-
-    contacts.reserve(mi.size());
-    for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
+    else
     {
-      const auto* swp0 = mi.at(iStep).get().cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+      if (cancelled && cancelled())
+        return found;
 
       tesseract_environment::EnvState::Ptr state = state_solver.getState(swp0->joint_names, swp0->position);
       if (checkTrajectoryState(contacts, manager, state, config))
@@ -460,19 +414,230 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
           for (const auto& name : swp0->joint_names)
             ss << " " << name;
 
-          ss << std::endl << "    State0: " << swp0->position << std::endl;
+          ss << std::endl << "    State: " << swp0->position << std::endl;
 
           CONSOLE_BRIDGE_logError(ss.str().c_str());
         }
       }
 
       if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+        return found;
+    }
+  }
+  return found;
+}
+
+/**
+ * @brief Split the steps of a program into chunks and check them on multiple threads
+ * @details Chunks are handed out in order. Each additional worker uses its own clone of the contact manager and state
+ * solver. Results are merged in chunk order so they match a serial check. When ContactTestType::FIRST is requested,
+ * chunks after the earliest chunk in collision are cancelled and their results discarded.
+ */
+template <typename ManagerType>
+static bool contactCheckStepsParallel(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                      ManagerType& manager,
+                                      const tesseract_environment::StateSolver& state_solver,
+                                      std::size_t step_count,
+                                      const tesseract_collision::CollisionCheckConfig& config,
+                                      std::size_t num_threads,
+                                      const ContactCheckStepsFn<ManagerType>& check)
+{
+  // The calling thread is already counted, only the additional workers are borrowed from the budget
+  CPUBudget::Lease lease;
+  if (num_threads > 1 && step_count > 1)
+  {
+    lease = CPUBudget::getGlobal().borrow(std::min(num_threads, step_count) - 1);
+    num_threads = 1 + lease.size();
+  }
+
+  if (num_threads < 2 || step_count < 2)
+  {
+    tesseract_environment::StateSolver::Ptr batch_state_solver;
+    return check(contacts, manager, state_solver, batch_state_solver, 0, step_count, nullptr);
+  }
+
+  const bool first = (config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+  const std::size_t chunk_count = std::min(step_count, num_threads * CONTACT_CHECK_CHUNKS_PER_THREAD);
+  const std::size_t worker_count = std::min(num_threads, chunk_count);
+
+  std::vector<std::vector<tesseract_collision::ContactResultMap>> chunk_contacts(chunk_count);
+  std::vector<char> chunk_found(chunk_count, 0);
+  std::atomic<std::size_t> next_chunk{ 0 };
+  std::atomic<std::size_t> first_found_chunk{ chunk_count };
+  std::atomic<bool> abort{ false };
+
+  auto worker = [&](ManagerType& worker_manager, tesseract_environment::StateSolver::Ptr& worker_state_solver) {
+    for (std::size_t c = next_chunk++; c < chunk_count; c = next_chunk++)
+    {
+      auto cancelled = [&, c]() { return abort.load() || (first && c > first_found_chunk.load()); };
+      if (cancelled())
+        return;
+
+      const std::size_t begin = (c * step_count) / chunk_count;
+      const std::size_t end = ((c + 1) * step_count) / chunk_count;
+      chunk_found[c] = check(
+          chunk_contacts[c], worker_manager, *worker_state_solver, worker_state_solver, begin, end, cancelled);
+
+      if (first && chunk_found[c])
+      {
+        std::size_t current = first_found_chunk.load();
+        while (c < current && !first_found_chunk.compare_exchange_weak(current, c))
+        {
+        }
+      }
+    }
+  };
+
+  // The calling thread uses the provided manager, so clones are created before it starts modifying it. Every worker
+  // needs its own state solver since the checks drive the solver's current state.
+  std::vector<typename ManagerType::Ptr> managers;
+  std::vector<tesseract_environment::StateSolver::Ptr> state_solvers;
+  managers.reserve(worker_count - 1);
+  state_solvers.reserve(worker_count);
+  for (std::size_t w = 0; w < worker_count; ++w)
+  {
+    if (w > 0)
+      managers.push_back(manager.clone());
+    state_solvers.push_back(state_solver.clone());
+  }
+
+  std::vector<std::exception_ptr> errors(worker_count);
+  std::vector<std::thread> threads;
+  threads.reserve(worker_count - 1);
+  for (std::size_t w = 1; w < worker_count; ++w)
+  {
+    threads.emplace_back([&, w]() {
+      try
+      {
+        worker(*managers[w - 1], state_solvers[w]);
+      }
+      catch (...)
+      {
+        errors[w] = std::current_exception();
+        abort = true;
+      }
+    });
+  }
+
+  try
+  {
+    worker(manager, state_solvers[0]);
+  }
+  catch (...)
+  {
+    errors[0] = std::current_exception();
+    abort = true;
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (const auto& error : errors)
+    if (error)
+      std::rethrow_exception(error);
+
+  bool found = false;
+  for (std::size_t c = 0; c < chunk_count; ++c)
+  {
+    contacts.insert(contacts.end(),
+                    std::make_move_iterator(chunk_contacts[c].begin()),
+                    std::make_move_iterator(chunk_contacts[c].end()));
+    if (chunk_found[c])
+    {
+      found = true;
+      if (first)
         break;
     }
   }
   return found;
 }
 
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_environment::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         std::size_t num_threads)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type (Continuous)");
+
+  assert(config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS ||
+         config.longest_valid_segment_length > 0);
+
+  // Flatten results
+  std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
+  if (mi.size() < 2)
+    return false;
+
+  contacts.reserve(contacts.size() + mi.size() - 1);
+  ContactCheckStepsFn<tesseract_collision::ContinuousContactManager> check =
+      [&mi, &config](std::vector<tesseract_collision::ContactResultMap>& chunk_contacts,
+                     tesseract_collision::ContinuousContactManager& chunk_manager,
+                     const tesseract_environment::StateSolver& chunk_state_solver,
+                     tesseract_environment::StateSolver::Ptr& chunk_batch_state_solver,
+                     std::size_t begin,
+                     std::size_t end,
+                     const std::function<bool()>& cancelled) {
+        return contactCheckSegments(chunk_contacts,
+                                    chunk_manager,
+                                    chunk_state_solver,
+                                    chunk_batch_state_solver,
+                                    mi,
+                                    begin,
+                                    end,
+                                    config,
+                                    cancelled);
+      };
+
+  return contactCheckStepsParallel(contacts, manager, state_solver, mi.size() - 1, config, num_threads, check);
+}
+
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_environment::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         std::size_t num_threads)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type (Discrete)");
+
+  assert(config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE ||
+         config.longest_valid_segment_length > 0);
+
+  // Flatten results
+  std::vector<std::reference_wrapper<const Instruction>> mi = flatten(program, moveFilter);
+  if (mi.empty())
+    return false;
+
+  contacts.reserve(contacts.size() + mi.size());
+  ContactCheckStepsFn<tesseract_collision::DiscreteContactManager> check =
+      [&mi, &config](std::vector<tesseract_collision::ContactResultMap>& chunk_contacts,
+                     tesseract_collision::DiscreteContactManager& chunk_manager,
+                     const tesseract_environment::StateSolver& chunk_state_solver,
+                     tesseract_environment::StateSolver::Ptr& chunk_batch_state_solver,
+                     std::size_t begin,
+                     std::size_t end,
+                     const std::function<bool()>& cancelled) {
+        return contactCheckStates(chunk_contacts,
+                                  chunk_manager,
+                                  chunk_state_solver,
+                                  chunk_batch_state_solver,
+                                  mi,
+                                  begin,
+                                  end,
+                                  config,
+                                  cancelled);
+      };
+
+  return contactCheckStepsParallel(contacts, manager, state_solver, mi.size(), config, num_threads, check);
+}
+
 void generateNaiveSeedHelper(CompositeInstruction& composite_instructions,
                              const tesseract_environment::Environment& env,
                              const tesseract_environment::EnvState& env_state,
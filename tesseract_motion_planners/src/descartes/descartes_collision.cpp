@@ -23,10 +23,49 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_motion_planners/descartes/impl/descartes_collision.hpp>
 
 namespace tesseract_planning
 {
+std::string getDescartesCollisionKey(const std::vector<std::string>& active_links,
+                                     const std::vector<std::string>& joint_names,
+                                     const tesseract_collision::CollisionCheckConfig& collision_check_config,
+                                     bool debug)
+{
+  // Only the parts of the config used by the vertex checks, the contact test type is always overridden
+  const tesseract_collision::CollisionMarginData& margin_data = collision_check_config.collision_margin_data;
+  std::vector<std::tuple<std::string, std::string, double>> pair_margins;
+  for (const auto& pair : margin_data.getPairCollisionMarginData())
+    pair_margins.emplace_back(pair.first.first, pair.first.second, pair.second);
+  std::sort(pair_margins.begin(), pair_margins.end());
+
+  std::stringstream key;
+  key.precision(17);
+  key << active_links.size() << "\n";
+  for (const auto& link : active_links)
+    key << link << "\n";
+
+  key << joint_names.size() << "\n";
+  for (const auto& joint : joint_names)
+    key << joint << "\n";
+
+  key << margin_data.getDefaultCollisionMargin() << "\n" << pair_margins.size() << "\n";
+  for (const auto& pair : pair_margins)
+    key << std::get<0>(pair) << "\n" << std::get<1>(pair) << "\n" << std::get<2>(pair) << "\n";
+
+  key << collision_check_config.contact_request.calculate_penetration << "\n"
+      << collision_check_config.contact_request.calculate_distance << "\n"
+      << debug;
+  return key.str();
+}
+
 // Explicit template instantiation
 template class DescartesCollision<float>;
 template class DescartesCollision<double>;
@@ -26,10 +26,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
-#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 
 namespace tesseract_planning
 {
@@ -46,14 +46,14 @@ ContinuousMotionValidator::ContinuousMotionValidator(
   , kin_(std::move(kin))
   , continuous_contact_manager_(env->getContinuousContactManager())
   , extractor_(extractor)
+  , continuous_contact_managers_([this]() { return continuous_contact_manager_->clone(); })
+  , state_solvers_([this]() { return state_solver_->clone(); })
 {
   joints_ = kin_->getJointNames();
 
-  // kinematics objects does not know of every link affected by its motion so must compute adjacency map
-  // to determine all active links.
-  tesseract_environment::AdjacencyMap adj_map(
-      env->getSceneGraph(), kin_->getActiveLinkNames(), env->getCurrentState()->link_transforms);
-  links_ = adj_map.getActiveLinkNames();
+  // kinematics objects does not know of every link affected by its motion so must use the active links of the
+  // kinematic metadata which are computed from the scene graph.
+  links_ = KinematicMetadataCache::get(*env, *kin_)->active_link_names;
 
   continuous_contact_manager_->setActiveCollisionObjects(links_);
   continuous_contact_manager_->setCollisionMarginData(collision_margin_data);
@@ -134,38 +134,20 @@ bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1,
 
 bool ContinuousMotionValidator::continuousCollisionCheck(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::ContinuousContactManager::Ptr cm;
-  tesseract_environment::StateSolver::Ptr ss;
-  mutex_.lock();
-  auto it = continuous_contact_managers_.find(hash);
-  if (it == continuous_contact_managers_.end())
-  {
-    cm = continuous_contact_manager_->clone();
-    continuous_contact_managers_[hash] = cm;
-
-    ss = state_solver_->clone();
-    state_solver_managers_[hash] = ss;
-  }
-  else
-  {
-    cm = it->second;
-    ss = state_solver_managers_[hash];
-  }
-  mutex_.unlock();
+  tesseract_collision::ContinuousContactManager& cm = continuous_contact_managers_.get();
+  tesseract_environment::StateSolver& ss = state_solvers_.get();
 
   Eigen::Map<Eigen::VectorXd> start_joints = extractor_(s1);
   Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(s2);
 
-  tesseract_environment::EnvState::Ptr state0 = ss->getState(joints_, start_joints);
-  tesseract_environment::EnvState::Ptr state1 = ss->getState(joints_, finish_joints);
+  tesseract_environment::EnvState::Ptr state0 = ss.getState(joints_, start_joints);
+  tesseract_environment::EnvState::Ptr state1 = ss.getState(joints_, finish_joints);
 
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state0->link_transforms[link_name], state1->link_transforms[link_name]);
+    cm.setCollisionObjectsTransform(link_name, state0->link_transforms[link_name], state1->link_transforms[link_name]);
 
   tesseract_collision::ContactResultMap contact_map;
-  cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
+  cm.contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
 
   return contact_map.empty();
 }
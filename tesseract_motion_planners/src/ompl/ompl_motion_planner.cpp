@@ -30,6 +30,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/goals/GoalStates.h>
 #include <ompl/tools/multiplan/ParallelPlan.h>
+#include <atomic>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/ompl_motion_planner_status_category.h>
@@ -42,6 +44,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
 #include <tesseract_motion_planners/ompl/weighted_real_vector_state_sampler.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/cpu_budget.h>
 
 #include <tesseract_command_language/command_language.h>
 #include <tesseract_command_language/utils/utils.h>
@@ -86,6 +89,132 @@ bool checkGoalState(const ompl::base::ProblemDefinitionPtr& prob_def,
   return false;
 }
 
+/**
+ * @brief Solve a single OMPL problem and simplify or interpolate its solution as configured
+ * @param p The problem, the solution is stored in its simple setup
+ * @param abort_ptc Stops the search early when it evaluates to true, in addition to the planning time
+ * @return True if an exact solution was found
+ */
+static bool solveProblem(OMPLProblem& p, const ompl::base::PlannerTerminationCondition& abort_ptc)
+{
+  auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(p.simple_setup->getProblemDefinition());
+
+  // Each planner runs on its own thread while the calling thread waits, so one less is borrowed from the budget.
+  // If the budget is exhausted only the first planners are used.
+  CPUBudget::Lease lease;
+  std::size_t planner_cnt = p.planners.size();
+  if (planner_cnt > 1)
+  {
+    lease = CPUBudget::getGlobal().borrow(planner_cnt - 1);
+    planner_cnt = 1 + lease.size();
+  }
+
+  const ompl::base::SpaceInformationPtr& si = p.simple_setup->getSpaceInformation();
+  std::vector<ompl::base::PlannerPtr> roadmap_planners;
+  for (std::size_t i = 0; i < planner_cnt; ++i)
+  {
+    const auto& planner = p.planners[i];
+    if (p.roadmap != nullptr && OMPLRoadmap::isSupported(planner->getType()))
+    {
+      roadmap_planners.push_back(p.roadmap->createPlanner(si, *planner));
+      parallel_plan->addPlanner(roadmap_planners.back());
+    }
+    else
+    {
+      parallel_plan->addPlanner(planner->create(si));
+    }
+  }
+
+  ompl::base::PlannerStatus status;
+  if (!p.optimize)
+  {
+    // Solve problem. Results are stored in the response
+    // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
+    // and finishes at the end state.
+    status = parallel_plan->solve(
+        ompl::base::plannerOrTerminationCondition(ompl::base::timedPlannerTerminationCondition(p.planning_time),
+                                                  abort_ptc),
+        1,
+        static_cast<unsigned>(p.max_solutions),
+        false);
+  }
+  else
+  {
+    ompl::time::point end = ompl::time::now() + ompl::time::seconds(p.planning_time);
+    const ompl::base::ProblemDefinitionPtr& pdef = p.simple_setup->getProblemDefinition();
+    while (ompl::time::now() < end && !abort_ptc())
+    {
+      // Solve problem. Results are stored in the response
+      // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
+      // and finishes at the end state.
+      ompl::base::PlannerStatus localResult = parallel_plan->solve(
+          ompl::base::plannerOrTerminationCondition(
+              ompl::base::timedPlannerTerminationCondition(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0)),
+              abort_ptc),
+          1,
+          static_cast<unsigned>(p.max_solutions),
+          false);
+      if (localResult)
+      {
+        if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+          status = localResult;
+
+        if (!pdef->hasOptimizationObjective())
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
+          break;
+        }
+
+        ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
+        CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
+
+        if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
+          break;
+        }
+
+        if (pdef->getSolutionCount() >= static_cast<std::size_t>(p.max_solutions))
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p.max_solutions);
+          break;
+        }
+      }
+    }
+  }
+
+  // The roadmap grows even if no solution was found
+  for (const auto& planner : roadmap_planners)
+    p.roadmap->update(*planner, p.env->getRevision());
+
+  if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+    return false;
+
+  if (p.simplify)
+  {
+    p.simple_setup->simplifySolution();
+  }
+  else
+  {
+    // Interpolate the path if it shouldn't be simplified and there are currently fewer states than requested
+    auto num_output_states = static_cast<unsigned>(p.n_output_states);
+    if (p.simple_setup->getSolutionPath().getStateCount() < num_output_states)
+    {
+      p.simple_setup->getSolutionPath().interpolate(num_output_states);
+    }
+    else
+    {
+      // Now try to simplify the trajectory to get it under the requested number of output states
+      // The interpolate function only executes if the current number of states is less than the requested
+      p.simple_setup->simplifySolution();
+      if (p.simple_setup->getSolutionPath().getStateCount() < num_output_states)
+        p.simple_setup->getSolutionPath().interpolate(num_output_states);
+    }
+  }
+
+  return true;
+}
+
 /** @brief Construct a basic planner */
 OMPLMotionPlanner::OMPLMotionPlanner()
   : status_category_(std::make_shared<const OMPLMotionPlannerStatusCategory>(name_))
@@ -97,8 +226,8 @@ const std::string& OMPLMotionPlanner::getName() const { return name_; }
 
 bool OMPLMotionPlanner::terminate()
 {
-  CONSOLE_BRIDGE_logWarn("Termination of ongoing optimization is not implemented yet");
-  return false;
+  cancelRunningSolves();
+  return true;
 }
 
 tesseract_common::StatusCode OMPLMotionPlanner::solve(const PlannerRequest& request,
@@ -128,7 +257,8 @@ tesseract_common::StatusCode OMPLMotionPlanner::solve(const PlannerRequest& requ
 
     try
     {
-      problem = problem_generator(name_, request, plan_profiles);
+      problem = problem_generator(
+          name_, request, (shared_plan_profiles != nullptr) ? *shared_plan_profiles : plan_profiles);
     }
     catch (std::exception& e)
     {
@@ -145,140 +275,155 @@ tesseract_common::StatusCode OMPLMotionPlanner::solve(const PlannerRequest& requ
   if (verbose)
     console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_DEBUG);
 
-  /// @todo: Need to expand this to support multiple motion plans leveraging taskflow
-  assert(problem.size() == 1);
-  for (auto& p : problem)
+  if (problem.empty())
   {
-    auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(p->simple_setup->getProblemDefinition());
-
-    for (const auto& planner : p->planners)
-      parallel_plan->addPlanner(planner->create(p->simple_setup->getSpaceInformation()));
-
-    ompl::base::PlannerStatus status;
-    if (!p->optimize)
-    {
-      // Solve problem. Results are stored in the response
-      // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-      // and finishes at the end state.
-      status = parallel_plan->solve(p->planning_time, 1, static_cast<unsigned>(p->max_solutions), false);
-    }
-    else
-    {
-      ompl::time::point end = ompl::time::now() + ompl::time::seconds(p->planning_time);
-      const ompl::base::ProblemDefinitionPtr& pdef = p->simple_setup->getProblemDefinition();
-      while (ompl::time::now() < end)
-      {
-        // Solve problem. Results are stored in the response
-        // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-        // and finishes at the end state.
-        ompl::base::PlannerStatus localResult =
-            parallel_plan->solve(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0),
-                                 1,
-                                 static_cast<unsigned>(p->max_solutions),
-                                 false);
-        if (localResult)
-        {
-          if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
-            status = localResult;
-
-          if (!pdef->hasOptimizationObjective())
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
-            break;
-          }
-
-          ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
-          CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
-
-          if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
-            break;
-          }
-
-          if (pdef->getSolutionCount() >= static_cast<std::size_t>(p->max_solutions))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p->max_solutions);
-            break;
-          }
-        }
-      }
-    }
+    CONSOLE_BRIDGE_logError("OMPLPlanner problem generator did not produce any problems.");
+    response.status =
+        tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::ErrorInvalidInput, status_category_);
+    return response.status;
+  }
 
-    if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+  for (const auto& p : problem)
+  {
+    if (p == nullptr)
     {
-      response.status = tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::ErrorFailedToFindValidSolution,
-                                                     status_category_);
+      CONSOLE_BRIDGE_logError("OMPLPlanner was given a problem containing an unsupported (linear) segment.");
+      response.status =
+          tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::ErrorInvalidInput, status_category_);
       return response.status;
     }
+  }
 
-    if (p->simplify)
+  // Solve every segment concurrently, stop all of them as soon as one fails or the request is cancelled. Reaching the
+  // request deadline shortens the planning time, so segments that found a solution by then still succeed.
+  std::function<bool()> cancelled = getCancellationCheck(request);
+  std::function<bool()> stop = [&request, &cancelled]() { return cancelled() || isDeadlineExceeded(request); };
+  std::atomic<bool> failed{ false };
+  std::atomic<std::size_t> next_problem{ 0 };
+  std::size_t thread_cnt =
+      (max_concurrent_problems > 0) ? max_concurrent_problems : std::thread::hardware_concurrency();
+  thread_cnt = std::max<std::size_t>(1, std::min(thread_cnt, problem.size()));
+
+  // The calling thread is already counted, only the additional workers are borrowed from the budget
+  CPUBudget::Lease lease = CPUBudget::getGlobal().borrow(thread_cnt - 1);
+  thread_cnt = 1 + lease.size();
+
+  auto worker = [&]() {
+    ompl::base::PlannerTerminationCondition abort_ptc([&failed, &stop]() { return failed.load() || stop(); });
+    for (std::size_t i = next_problem++; i < problem.size() && !failed; i = next_problem++)
     {
-      p->simple_setup->simplifySolution();
+      if (!solveProblem(*problem[i], abort_ptc))
+        failed = true;
     }
-    else
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_cnt - 1);
+  for (std::size_t i = 1; i < thread_cnt; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto& thread : threads)
+    thread.join();
+
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("OMPLPlanner was cancelled");
+    response.status = tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
+  if (failed)
+  {
+    response.status = tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::ErrorFailedToFindValidSolution,
+                                                   status_category_);
+    return response.status;
+  }
+
+  // Stitch the segments together, each segment starts at the last state of the previous one
+  tesseract_common::TrajArray trajectory;
+  for (std::size_t i = 0; i < problem.size(); ++i)
+  {
+    OMPLProblem& p = *problem[i];
+    tesseract_common::TrajArray segment = p.getTrajectory();
+    if (i > 0 && !segment.row(0).isApprox(trajectory.bottomRows(1), 1e-5))
     {
-      // Interpolate the path if it shouldn't be simplified and there are currently fewer states than requested
-      auto num_output_states = static_cast<unsigned>(p->n_output_states);
-      if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
+      // The shared waypoint had multiple valid states (ie. cartesian) and the segments picked different ones, so
+      // replan this segment from where the previous one ended.
+      if (p.state_space != OMPLProblemStateSpace::REAL_STATE_SPACE)
       {
-        p->simple_setup->getSolutionPath().interpolate(num_output_states);
+        response.status = tesseract_common::StatusCode(
+            OMPLMotionPlannerStatusCategory::ErrorFailedToFindValidSolution, status_category_);
+        return response.status;
       }
-      else
+
+      ompl::base::ScopedState<> start_state(p.simple_setup->getStateSpace());
+      for (unsigned j = 0; j < static_cast<unsigned>(trajectory.cols()); ++j)
+        start_state[j] = trajectory(trajectory.rows() - 1, j);
+
+      p.simple_setup->getProblemDefinition()->clearSolutionPaths();
+      p.simple_setup->clearStartStates();
+      p.simple_setup->addStartState(start_state);
+      if (!solveProblem(p, ompl::base::PlannerTerminationCondition(stop)))
       {
-        // Now try to simplify the trajectory to get it under the requested number of output states
-        // The interpolate function only executes if the current number of states is less than the requested
-        p->simple_setup->simplifySolution();
-        if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
-          p->simple_setup->getSolutionPath().interpolate(num_output_states);
+        response.status =
+            tesseract_common::StatusCode(cancelled() ? OMPLMotionPlannerStatusCategory::Cancelled :
+                                                       OMPLMotionPlannerStatusCategory::ErrorFailedToFindValidSolution,
+                                         status_category_);
+        return response.status;
       }
+      segment = p.getTrajectory();
     }
 
-    // Get the results
-    tesseract_common::TrajArray trajectory = p->getTrajectory();
+    assert(checkStartState(p.simple_setup->getProblemDefinition(), segment.row(0), p.extractor));
+    assert(checkGoalState(p.simple_setup->getProblemDefinition(), segment.bottomRows(1).transpose(), p.extractor));
 
-    assert(checkStartState(p->simple_setup->getProblemDefinition(), trajectory.row(0), p->extractor));
-    assert(checkGoalState(p->simple_setup->getProblemDefinition(), trajectory.bottomRows(1).transpose(), p->extractor));
+    if (i == 0)
+    {
+      trajectory = segment;
+    }
+    else
+    {
+      long prev_rows = trajectory.rows();
+      trajectory.conservativeResize(prev_rows + segment.rows() - 1, Eigen::NoChange);
+      trajectory.bottomRows(segment.rows() - 1) = segment.bottomRows(segment.rows() - 1);
+    }
+  }
 
-    // Flatten the results to make them easier to process
-    response.results = request.seed;
-    std::vector<std::reference_wrapper<Instruction>> results_flattened =
-        flattenProgramToPattern(response.results, request.instructions);
-    std::vector<std::reference_wrapper<const Instruction>> instructions_flattened =
-        flattenProgram(request.instructions);
+  // Flatten the results to make them easier to process
+  response.results = request.seed;
+  std::vector<std::reference_wrapper<Instruction>> results_flattened =
+      flattenProgramToPattern(response.results, request.instructions);
+  std::vector<std::reference_wrapper<const Instruction>> instructions_flattened = flattenProgram(request.instructions);
 
-    // Loop over the flattened results and add them to response if the input was a plan instruction
-    Eigen::Index result_index = 0;
-    for (std::size_t idx = 0; idx < instructions_flattened.size(); idx++)
+  // Loop over the flattened results and add them to response if the input was a plan instruction
+  Eigen::Index result_index = 0;
+  for (std::size_t idx = 0; idx < instructions_flattened.size(); idx++)
+  {
+    // If plan_index is zero then this should be the start instruction
+    assert((idx == 0) ? isPlanInstruction(instructions_flattened.at(idx).get()) : true);
+    assert((idx == 0) ? isMoveInstruction(results_flattened[idx].get()) : true);
+    if (isPlanInstruction(instructions_flattened.at(idx).get()))
     {
-      // If plan_index is zero then this should be the start instruction
-      assert((idx == 0) ? isPlanInstruction(instructions_flattened.at(idx).get()) : true);
-      assert((idx == 0) ? isMoveInstruction(results_flattened[idx].get()) : true);
-      if (isPlanInstruction(instructions_flattened.at(idx).get()))
+      // This instruction corresponds to a composite. Set all results in that composite to the results
+      const auto* plan_instruction = instructions_flattened.at(idx).get().cast_const<PlanInstruction>();
+      if (plan_instruction->isStart())
       {
-        // This instruction corresponds to a composite. Set all results in that composite to the results
-        const auto* plan_instruction = instructions_flattened.at(idx).get().cast_const<PlanInstruction>();
-        if (plan_instruction->isStart())
-        {
-          assert(idx == 0);
-          assert(isMoveInstruction(results_flattened[idx].get()));
-          auto* move_instruction = results_flattened[idx].get().cast<MoveInstruction>();
-          move_instruction->getWaypoint().cast<StateWaypoint>()->position = trajectory.row(result_index++);
-        }
-        else
-        {
-          auto* move_instructions = results_flattened[idx].get().cast<CompositeInstruction>();
-          for (auto& instruction : *move_instructions)
-            instruction.cast<MoveInstruction>()->getWaypoint().cast<StateWaypoint>()->position =
-                trajectory.row(result_index++);
-        }
+        assert(idx == 0);
+        assert(isMoveInstruction(results_flattened[idx].get()));
+        auto* move_instruction = results_flattened[idx].get().cast<MoveInstruction>();
+        move_instruction->getWaypoint().cast<StateWaypoint>()->position = trajectory.row(result_index++);
+      }
+      else
+      {
+        auto* move_instructions = results_flattened[idx].get().cast<CompositeInstruction>();
+        for (auto& instruction : *move_instructions)
+          instruction.cast<MoveInstruction>()->getWaypoint().cast<StateWaypoint>()->position =
+              trajectory.row(result_index++);
       }
     }
-
-    response.status = tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::SolutionFound, status_category_);
-    return response.status;
   }
 
+  response.status = tesseract_common::StatusCode(OMPLMotionPlannerStatusCategory::SolutionFound, status_category_);
   return response.status;
 }
 
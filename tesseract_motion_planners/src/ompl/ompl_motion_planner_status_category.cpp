@@ -51,6 +51,10 @@ std::string OMPLMotionPlannerStatusCategory::message(int code) const
     {
       return "Failed to find valid solution";
     }
+    case Cancelled:
+    {
+      return "Planning was cancelled";
+    }
     default:
     {
       assert(false);
@@ -0,0 +1,367 @@
+/**
+ * @file ompl_roadmap.cpp
+ * @brief A roadmap shared by the PRM planners of multiple OMPL requests
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/base/PlannerData.h>
+#include <ompl/base/spaces/RealVectorStateSpace.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <limits>
+#include <map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/ompl/ompl_roadmap.h>
+
+namespace tesseract_planning
+{
+bool OMPLRoadmap::isSupported(OMPLPlannerType type)
+{
+  return (type == OMPLPlannerType::PRM || type == OMPLPlannerType::PRMstar || type == OMPLPlannerType::LazyPRMstar);
+}
+
+/**
+ * @brief Copy the parameters of the planner created by a configurator to a planner replacing it
+ * @param planner The planner replacing the configured planner
+ * @param configured The planner created by the configurator
+ */
+static void copyPlannerParams(ompl::base::Planner& planner, const ompl::base::Planner& configured)
+{
+  std::map<std::string, std::string> params;
+  configured.params().getParams(params);
+  for (const auto& param : params)
+  {
+    if (!planner.params().hasParam(param.first))
+    {
+      CONSOLE_BRIDGE_logDebug("OMPLRoadmap: Planner %s has no parameter %s, it is ignored.",
+                              planner.getName().c_str(),
+                              param.first.c_str());
+      continue;
+    }
+
+    planner.params().setParam(param.first, param.second);
+  }
+}
+
+ompl::base::PlannerPtr OMPLRoadmap::createPlanner(const ompl::base::SpaceInformationPtr& si,
+                                                  const OMPLPlannerConfigurator& configurator) const
+{
+  assert(isSupported(configurator.getType()));
+  const bool star_strategy = (configurator.getType() != OMPLPlannerType::PRM);
+  const ompl::base::PlannerPtr configured = configurator.create(si);
+
+#ifdef OMPL_LESS_1_4_0
+  // Creating a planner from planner data is not available so the roadmap is not reused
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(si, star_strategy);
+  copyPlannerParams(*planner, *configured);
+  return planner;
+#else
+  const auto dof = static_cast<long>(si->getStateDimension());
+
+  ompl::base::PlannerData data(si);
+  PlannerRoadmap roadmap;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (vertices_.empty() || vertices_.begin()->second.size() != dof)
+    {
+      auto planner = std::make_shared<ompl::geometric::LazyPRM>(si, star_strategy);
+      copyPlannerParams(*planner, *configured);
+      return planner;
+    }
+
+    std::map<std::size_t, unsigned> indices;
+    roadmap.vertices.reserve(vertices_.size());
+    for (const auto& vertex : vertices_)
+    {
+      ompl::base::State* state = si->allocState();
+      auto* values = state->as<ompl::base::RealVectorStateSpace::StateType>()->values;
+      for (long i = 0; i < dof; ++i)
+        values[i] = vertex.second(i);
+
+      indices[vertex.first] = data.addVertex(ompl::base::PlannerDataVertex(state));
+      roadmap.vertices.push_back(vertex.second);
+    }
+
+    roadmap.edges.reserve(edges_.size());
+    for (const auto& edge : edges_)
+    {
+      const unsigned a = indices.at(edge.first);
+      const unsigned b = indices.at(edge.second);
+      data.addEdge(a, b);
+      roadmap.edges.emplace_back(std::min(a, b), std::max(a, b));
+    }
+    std::sort(roadmap.edges.begin(), roadmap.edges.end());
+  }
+
+  // The planner copies the states and marks every vertex and edge as unchecked
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(data, star_strategy);
+  copyPlannerParams(*planner, *configured);
+
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+    si->freeState(const_cast<ompl::base::State*>(data.getVertex(i).getState()));  // NOLINT
+
+  // The roadmap the planner was created with is kept to find the vertices and edges it removed
+  roadmap.planner = planner;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    planners_.erase(std::remove_if(planners_.begin(),
+                                   planners_.end(),
+                                   [](const PlannerRoadmap& p) { return p.planner.expired(); }),
+                    planners_.end());
+    planners_.push_back(std::move(roadmap));
+  }
+
+  return planner;
+#endif
+}
+
+void OMPLRoadmap::update(const ompl::base::Planner& planner, int revision)
+{
+  const ompl::base::SpaceInformationPtr& si = planner.getSpaceInformation();
+  const auto dof = static_cast<long>(si->getStateDimension());
+
+  ompl::base::PlannerData data(si);
+  planner.getPlannerData(data);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // A planner which was not created from the roadmap was not given anything, so its roadmap is only added
+  PlannerRoadmap given;
+  auto it = std::find_if(planners_.begin(), planners_.end(), [&planner](const PlannerRoadmap& p) {
+    return p.planner.lock().get() == &planner;
+  });
+  if (it != planners_.end())
+  {
+    given = std::move(*it);
+    planners_.erase(it);
+  }
+
+  // Collisions found in an older environment revision than the last update may no longer exist
+  const bool current = (revision >= revision_);
+  revision_ = std::max(revision_, revision);
+  if (!vertices_.empty() && vertices_.begin()->second.size() != dof)
+    return;
+
+  std::map<Eigen::VectorXd, unsigned, VertexLess> given_indices;
+  for (unsigned i = 0; i < given.vertices.size(); ++i)
+    given_indices.emplace(given.vertices[i], i);
+
+  // Map the vertices of the planner onto the roadmap. The vertices it was given are not added back if another planner
+  // removed them in the meantime, the query vertices have the same state as a given vertex if they are one.
+  const auto none = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> mapping(data.numVertices(), none);
+  std::vector<std::size_t> given_mapping(data.numVertices(), none);
+  std::vector<char> given_found(given.vertices.size(), 0);
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+  {
+    const auto* values = data.getVertex(i).getState()->as<ompl::base::RealVectorStateSpace::StateType>()->values;
+    Eigen::VectorXd vertex = Eigen::Map<const Eigen::VectorXd>(values, dof);
+    auto given_it = given_indices.find(vertex);
+    if (given_it != given_indices.end())
+    {
+      given_mapping[i] = given_it->second;
+      given_found[given_it->second] = 1;
+    }
+
+    auto id_it = vertex_ids_.find(vertex);
+    if (id_it != vertex_ids_.end())
+      mapping[i] = id_it->second;
+    else if (given_it == given_indices.end())
+      mapping[i] = addVertex(vertex);
+  }
+
+  // Planners store undirected edges either once or in both directions
+  std::set<std::pair<unsigned, unsigned>> given_kept;
+  std::vector<unsigned> out_edges;
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+  {
+    data.getEdges(i, out_edges);
+    for (const unsigned j : out_edges)
+    {
+      if (given_mapping[i] != none && given_mapping[j] != none)
+      {
+        const auto a = static_cast<unsigned>(given_mapping[i]);
+        const auto b = static_cast<unsigned>(given_mapping[j]);
+        const std::pair<unsigned, unsigned> edge(std::min(a, b), std::max(a, b));
+        if (std::binary_search(given.edges.begin(), given.edges.end(), edge))
+        {
+          given_kept.insert(edge);
+          continue;
+        }
+      }
+
+      if (mapping[i] != none && mapping[j] != none && mapping[i] != mapping[j])
+        edges_.emplace(std::min(mapping[i], mapping[j]), std::max(mapping[i], mapping[j]));
+    }
+  }
+
+  // The vertices and edges the planner was given but no longer has were found in collision
+  if (current)
+  {
+    for (const auto& edge : given.edges)
+    {
+      if (!given_found[edge.first] || !given_found[edge.second] || given_kept.count(edge) > 0)
+        continue;
+
+      auto a = vertex_ids_.find(given.vertices[edge.first]);
+      auto b = vertex_ids_.find(given.vertices[edge.second]);
+      if (a != vertex_ids_.end() && b != vertex_ids_.end())
+        edges_.erase(std::make_pair(std::min(a->second, b->second), std::max(a->second, b->second)));
+    }
+
+    std::set<std::size_t> removed;
+    for (unsigned i = 0; i < given.vertices.size(); ++i)
+    {
+      if (given_found[i])
+        continue;
+
+      auto id_it = vertex_ids_.find(given.vertices[i]);
+      if (id_it != vertex_ids_.end())
+        removed.insert(id_it->second);
+    }
+    removeVertices(removed);
+  }
+
+  prune();
+}
+
+void OMPLRoadmap::setMaxVertexCount(std::size_t max_vertex_count)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_vertex_count_ = max_vertex_count;
+  prune();
+}
+
+std::size_t OMPLRoadmap::getMaxVertexCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_vertex_count_;
+}
+
+std::size_t OMPLRoadmap::getVertexCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return vertices_.size();
+}
+
+std::size_t OMPLRoadmap::getEdgeCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return edges_.size();
+}
+
+int OMPLRoadmap::getRevision() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return revision_;
+}
+
+void OMPLRoadmap::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  vertices_.clear();
+  vertex_ids_.clear();
+  edges_.clear();
+  revision_ = -1;
+}
+
+std::size_t OMPLRoadmap::addVertex(const Eigen::VectorXd& vertex)
+{
+  const std::size_t id = next_vertex_id_++;
+  vertices_.emplace(id, vertex);
+  vertex_ids_.emplace(vertex, id);
+  return id;
+}
+
+void OMPLRoadmap::removeVertices(const std::set<std::size_t>& ids)
+{
+  if (ids.empty())
+    return;
+
+  for (const std::size_t id : ids)
+  {
+    auto it = vertices_.find(id);
+    if (it == vertices_.end())
+      continue;
+
+    vertex_ids_.erase(it->second);
+    vertices_.erase(it);
+  }
+
+  for (auto it = edges_.begin(); it != edges_.end();)
+  {
+    if (ids.count(it->first) > 0 || ids.count(it->second) > 0)
+      it = edges_.erase(it);
+    else
+      ++it;
+  }
+}
+
+void OMPLRoadmap::prune()
+{
+  if (vertices_.size() <= max_vertex_count_)
+    return;
+
+  std::set<std::size_t> removed;
+  for (auto it = vertices_.begin(); removed.size() < vertices_.size() - max_vertex_count_; ++it)
+    removed.insert(it->first);
+
+  removeVertices(removed);
+}
+
+OMPLRoadmap::Ptr OMPLRoadmapCache::get(const std::string& key)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  OMPLRoadmap::Ptr& roadmap = roadmaps_[key];
+  if (roadmap == nullptr)
+    roadmap = std::make_shared<OMPLRoadmap>();
+
+  return roadmap;
+}
+
+std::size_t OMPLRoadmapCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return roadmaps_.size();
+}
+
+void OMPLRoadmapCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  roadmaps_.clear();
+}
+
+std::string OMPLRoadmapCache::getKey(const std::string& manipulator, const std::vector<std::string>& joint_names)
+{
+  std::string key = manipulator;
+  for (const auto& joint_name : joint_names)
+    key += ";" + joint_name;
+
+  return key;
+}
+
+}  // namespace tesseract_planning
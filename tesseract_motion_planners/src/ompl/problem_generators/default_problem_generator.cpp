@@ -27,6 +27,7 @@
 #include <tesseract_kinematics/core/validate.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_motion_planners/core/types.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 #include <tesseract_motion_planners/ompl/problem_generators/default_problem_generator.h>
 #include <tesseract_command_language/utils/utils.h>
 
@@ -89,12 +90,7 @@ std::vector<OMPLProblem::Ptr> DefaultOMPLProblemGenerator(const std::string& nam
   }
 
   // Get Active Link Names
-  {
-    std::vector<std::string> active_link_names = manip_inv_kin_->getActiveLinkNames();
-    auto adjacency_map = std::make_shared<tesseract_environment::AdjacencyMap>(
-        request.env->getSceneGraph(), active_link_names, request.env_state->link_transforms);
-    active_link_names_ = adjacency_map->getActiveLinkNames();
-  }
+  active_link_names_ = KinematicMetadataCache::get(*request.env, *manip_inv_kin_)->active_link_names;
 
   // Check and make sure it does not contain any composite instruction
   for (const auto& instruction : request.instructions)
@@ -186,35 +182,27 @@ std::vector<OMPLProblem::Ptr> DefaultOMPLProblemGenerator(const std::string& nam
           cur_plan_profile->applyGoalStates(
               *sub_prob, cur_position, *plan_instruction, composite_mi, active_link_names_, index);
 
-          if (index == 0)
+          // The start of every segment is the goal of the previous one, so each can be solved independently
+          if (isJointWaypoint(start_waypoint) || isStateWaypoint(start_waypoint))
           {
-            ompl::base::ScopedState<> start_state(sub_prob->simple_setup->getStateSpace());
-            if (isJointWaypoint(start_waypoint) || isStateWaypoint(start_waypoint))
-            {
-              assert(checkJointPositionFormat(manip_fwd_kin_->getJointNames(), start_waypoint));
-              const Eigen::VectorXd& prev_position = getJointPosition(start_waypoint);
-              cur_plan_profile->applyStartStates(
-                  *sub_prob, prev_position, *start_instruction, composite_mi, active_link_names_, index);
-            }
-            else if (isCartesianWaypoint(start_waypoint))
-            {
-              const auto* prev_wp = start_waypoint.cast_const<tesseract_planning::CartesianWaypoint>();
-              cur_plan_profile->applyStartStates(
-                  *sub_prob, *prev_wp, *start_instruction, composite_mi, active_link_names_, index);
-            }
-            else
-            {
-              throw std::runtime_error("OMPLMotionPlannerDefaultConfig: unknown waypoint type");
-            }
-
-            problem.push_back(std::move(sub_prob));
-            ++index;
+            assert(checkJointPositionFormat(manip_fwd_kin_->getJointNames(), start_waypoint));
+            const Eigen::VectorXd& prev_position = getJointPosition(start_waypoint);
+            cur_plan_profile->applyStartStates(
+                *sub_prob, prev_position, *start_instruction, composite_mi, active_link_names_, index);
+          }
+          else if (isCartesianWaypoint(start_waypoint))
+          {
+            const auto* prev_wp = start_waypoint.cast_const<tesseract_planning::CartesianWaypoint>();
+            cur_plan_profile->applyStartStates(
+                *sub_prob, *prev_wp, *start_instruction, composite_mi, active_link_names_, index);
           }
           else
           {
-            /** @todo Update. Extract the solution for the previous plan and set as the start */
-            assert(false);
+            throw std::runtime_error("OMPLMotionPlannerDefaultConfig: unknown waypoint type");
           }
+
+          problem.push_back(std::move(sub_prob));
+          ++index;
         }
         else if (isCartesianWaypoint(plan_instruction->getWaypoint()))
         {
@@ -222,31 +210,23 @@ std::vector<OMPLProblem::Ptr> DefaultOMPLProblemGenerator(const std::string& nam
           cur_plan_profile->applyGoalStates(
               *sub_prob, *cur_wp, *plan_instruction, composite_mi, active_link_names_, index);
 
-          if (index == 0)
+          // The start of every segment is the goal of the previous one, so each can be solved independently
+          if (isJointWaypoint(start_waypoint) || isStateWaypoint(start_waypoint))
+          {
+            assert(checkJointPositionFormat(manip_fwd_kin_->getJointNames(), start_waypoint));
+            const Eigen::VectorXd& prev_position = getJointPosition(start_waypoint);
+            cur_plan_profile->applyStartStates(
+                *sub_prob, prev_position, *start_instruction, composite_mi, active_link_names_, index);
+          }
+          else if (isCartesianWaypoint(start_waypoint))
           {
-            ompl::base::ScopedState<> start_state(sub_prob->simple_setup->getStateSpace());
-            if (isJointWaypoint(start_waypoint) || isStateWaypoint(start_waypoint))
-            {
-              assert(checkJointPositionFormat(manip_fwd_kin_->getJointNames(), start_waypoint));
-              const Eigen::VectorXd& prev_position = getJointPosition(start_waypoint);
-              cur_plan_profile->applyStartStates(
-                  *sub_prob, prev_position, *start_instruction, composite_mi, active_link_names_, index);
-            }
-            else if (isCartesianWaypoint(start_waypoint))
-            {
-              const auto* prev_wp = start_waypoint.cast_const<tesseract_planning::CartesianWaypoint>();
-              cur_plan_profile->applyStartStates(
-                  *sub_prob, *prev_wp, *start_instruction, composite_mi, active_link_names_, index);
-            }
-            else
-            {
-              throw std::runtime_error("OMPLMotionPlannerDefaultConfig: unknown waypoint type");
-            }
+            const auto* prev_wp = start_waypoint.cast_const<tesseract_planning::CartesianWaypoint>();
+            cur_plan_profile->applyStartStates(
+                *sub_prob, *prev_wp, *start_instruction, composite_mi, active_link_names_, index);
           }
           else
           {
-            /** @todo Update. Extract the solution for the previous plan and set as the start */
-            assert(false);
+            throw std::runtime_error("OMPLMotionPlannerDefaultConfig: unknown waypoint type");
           }
 
           problem.push_back(std::move(sub_prob));
@@ -258,7 +238,7 @@ std::vector<OMPLProblem::Ptr> DefaultOMPLProblemGenerator(const std::string& nam
         throw std::runtime_error("OMPLMotionPlannerDefaultConfig: Unsupported!");
       }
 
-      start_waypoint = plan_instruction->getWaypoint(); /** @todo need to extract the solution */
+      start_waypoint = plan_instruction->getWaypoint();
       start_instruction = &instruction;
     }
   }
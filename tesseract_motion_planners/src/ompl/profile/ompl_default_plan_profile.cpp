@@ -339,6 +339,9 @@ void OMPLDefaultPlanProfile::setup(OMPLProblem& prob) const
 
     // make sure the planners run until the time limit, and get the best possible solution
     processOptimizationObjective(prob);
+
+    if (roadmap_cache != nullptr)
+      prob.roadmap = roadmap_cache->get(OMPLRoadmapCache::getKey(prob.manip_fwd_kin->getName(), joint_names));
   }
 }
 
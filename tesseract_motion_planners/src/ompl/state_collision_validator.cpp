@@ -26,11 +26,11 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
-#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/state_collision_validator.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 
 namespace tesseract_planning
 {
@@ -45,14 +45,14 @@ StateCollisionValidator::StateCollisionValidator(const ompl::base::SpaceInformat
   , kin_(std::move(kin))
   , contact_manager_(env_->getDiscreteContactManager())
   , extractor_(extractor)
+  , contact_managers_([this]() { return contact_manager_->clone(); })
+  , state_solvers_([this]() { return state_solver_->clone(); })
 {
   joints_ = kin_->getJointNames();
 
-  // kinematics objects does not know of every link affected by its motion so must compute adjacency map
-  // to determine all active links.
-  tesseract_environment::AdjacencyMap adj_map(
-      env_->getSceneGraph(), kin_->getActiveLinkNames(), env_->getCurrentState()->link_transforms);
-  links_ = adj_map.getActiveLinkNames();
+  // kinematics objects does not know of every link affected by its motion so must use the active links of the
+  // kinematic metadata which are computed from the scene graph.
+  links_ = KinematicMetadataCache::get(*env_, *kin_)->active_link_names;
 
   contact_manager_->setActiveCollisionObjects(links_);
   contact_manager_->setCollisionMarginData(collision_margin_data);
@@ -60,30 +60,17 @@ StateCollisionValidator::StateCollisionValidator(const ompl::base::SpaceInformat
 
 bool StateCollisionValidator::isValid(const ompl::base::State* state) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::DiscreteContactManager::Ptr cm;
-  mutex_.lock();
-  auto it = contact_managers_.find(hash);
-  if (it == contact_managers_.end())
-  {
-    cm = contact_manager_->clone();
-    contact_managers_[hash] = cm;
-  }
-  else
-  {
-    cm = it->second;
-  }
-  mutex_.unlock();
+  tesseract_collision::DiscreteContactManager& cm = contact_managers_.get();
+  tesseract_environment::StateSolver& ss = state_solvers_.get();
 
   Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(state);
-  tesseract_environment::EnvState::Ptr state1 = env_->getState(joints_, finish_joints);
+  tesseract_environment::EnvState::Ptr state1 = ss.getState(joints_, finish_joints);
 
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state1->link_transforms[link_name]);
+    cm.setCollisionObjectsTransform(link_name, state1->link_transforms[link_name]);
 
   tesseract_collision::ContactResultMap contact_map;
-  cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
+  cm.contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
 
   return contact_map.empty();
 }
@@ -59,6 +59,10 @@ std::string SimpleMotionPlannerStatusCategory::message(int code) const
     {
       return "Failed to find valid solution";
     }
+    case Cancelled:
+    {
+      return "Planning was cancelled";
+    }
     default:
     {
       assert(false);
@@ -83,8 +87,8 @@ const std::string& SimpleMotionPlanner::getName() const { return name_; }
 
 bool SimpleMotionPlanner::terminate()
 {
-  CONSOLE_BRIDGE_logWarn("Termination of ongoing planning is not implemented yet");
-  return false;
+  cancelRunningSolves();
+  return true;
 }
 
 void SimpleMotionPlanner::clear() {}
@@ -119,10 +123,11 @@ tesseract_common::StatusCode SimpleMotionPlanner::solve(const PlannerRequest& re
   MoveInstruction start_instruction = getStartInstruction(request, current_state, fwd_kin);
   start_waypoint = start_instruction.getWaypoint();
 
-  // Process the instructions into the seed
+  // Process the instructions into the seed, it stops early if the solve is cancelled
+  std::function<bool()> cancelled = getCancellationCheck(request);
   try
   {
-    seed = processCompositeInstruction(request.instructions, start_waypoint, request);
+    seed = processCompositeInstruction(request.instructions, start_waypoint, request, cancelled);
   }
   catch (std::exception& e)
   {
@@ -132,6 +137,13 @@ tesseract_common::StatusCode SimpleMotionPlanner::solve(const PlannerRequest& re
     return response.status;
   }
 
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("SimplePlanner was cancelled");
+    response.status = tesseract_common::StatusCode(SimpleMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
   // Set start instruction
   seed.setStartInstruction(start_instruction);
 
@@ -197,15 +209,19 @@ SimpleMotionPlanner::getStartInstruction(const PlannerRequest& request,
 
 CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const CompositeInstruction& instructions,
                                                                       Waypoint& start_waypoint,
-                                                                      const PlannerRequest& request) const
+                                                                      const PlannerRequest& request,
+                                                                      const std::function<bool()>& cancelled) const
 {
   CompositeInstruction seed(instructions.getProfile(), instructions.getOrder(), instructions.getManipulatorInfo());
   for (const auto& instruction : instructions)
   {
+    if (cancelled())
+      return seed;
+
     if (isCompositeInstruction(instruction))
     {
-      seed.push_back(
-          processCompositeInstruction(*instruction.cast_const<CompositeInstruction>(), start_waypoint, request));
+      seed.push_back(processCompositeInstruction(
+          *instruction.cast_const<CompositeInstruction>(), start_waypoint, request, cancelled));
     }
     else if (isPlanInstruction(instruction))
     {
@@ -224,7 +240,9 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
 
       std::string profile = getProfileString(plan_instruction->getProfile(), name_, request.plan_profile_remapping);
       SimplePlannerPlanProfile::ConstPtr start_plan_profile = getProfile<SimplePlannerPlanProfile>(
-          profile, plan_profiles, std::make_shared<SimplePlannerDefaultLVSPlanProfile>());
+          profile,
+          (shared_plan_profiles != nullptr) ? *shared_plan_profiles : plan_profiles,
+          std::make_shared<SimplePlannerDefaultLVSPlanProfile>());
       if (!start_plan_profile)
         throw std::runtime_error("SimpleMotionPlanner: Invalid start profile");
 
@@ -29,6 +29,7 @@
 #include <tesseract_motion_planners/trajopt/profile/trajopt_default_plan_profile.h>
 #include <tesseract_motion_planners/trajopt/profile/trajopt_default_solver_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 #include <tesseract_motion_planners/planner_utils.h>
 
 namespace tesseract_planning
@@ -77,9 +78,8 @@ DefaultTrajoptProblemGenerator(const std::string& name,
 
   // Get kinematics information
   tesseract_environment::Environment::ConstPtr env = request.env;
-  tesseract_environment::AdjacencyMap map(
-      env->getSceneGraph(), pci->kin->getActiveLinkNames(), env->getCurrentState()->link_transforms);
-  const std::vector<std::string>& active_links = map.getActiveLinkNames();
+  KinematicMetadata::ConstPtr metadata = KinematicMetadataCache::get(*env, *pci->kin);
+  const std::vector<std::string>& active_links = metadata->active_link_names;
 
   // Create a temp seed storage.
   std::vector<Eigen::VectorXd> seed_states;
@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <trajopt_sco/sco_common.hpp>
 #include <tesseract_environment/core/utils.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <functional>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
@@ -65,6 +66,10 @@ std::string TrajOptMotionPlannerStatusCategory::message(int code) const
     {
       return "Failed to find valid solution";
     }
+    case Cancelled:
+    {
+      return "Planning was cancelled";
+    }
     default:
     {
       assert(false);
@@ -84,8 +89,8 @@ const std::string& TrajOptMotionPlanner::getName() const { return name_; }
 
 bool TrajOptMotionPlanner::terminate()
 {
-  CONSOLE_BRIDGE_logWarn("Termination of ongoing optimization is not implemented yet");
-  return false;
+  cancelRunningSolves();
+  return true;
 }
 
 void TrajOptMotionPlanner::clear() { callbacks.clear(); }
@@ -120,7 +125,11 @@ tesseract_common::StatusCode TrajOptMotionPlanner::solve(const PlannerRequest& r
 
     try
     {
-      pci = problem_generator(name_, request, plan_profiles, composite_profiles, solver_profiles);
+      pci = problem_generator(name_,
+                              request,
+                              (shared_plan_profiles != nullptr) ? *shared_plan_profiles : plan_profiles,
+                              (shared_composite_profiles != nullptr) ? *shared_composite_profiles : composite_profiles,
+                              (shared_solver_profiles != nullptr) ? *shared_solver_profiles : solver_profiles);
     }
     catch (std::exception& e)
     {
@@ -133,6 +142,14 @@ tesseract_common::StatusCode TrajOptMotionPlanner::solve(const PlannerRequest& r
     response.data = pci;
   }
 
+  std::function<bool()> cancelled = getCancellationCheck(request);
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("TrajOptPlanner was cancelled");
+    response.status = tesseract_common::StatusCode(TrajOptMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
   // Construct Problem
   trajopt::TrajOptProb::Ptr problem = trajopt::ConstructProblem(*pci);
 
@@ -153,10 +170,22 @@ tesseract_common::StatusCode TrajOptMotionPlanner::solve(const PlannerRequest& r
     opt.addCallback(callback);
   }
 
+  // Stop iterating once the solve is cancelled or the request deadline has passed
+  opt.addCallback([cancelled, &request](sco::OptProb*, sco::OptResults&) {
+    return !cancelled() && !isDeadlineExceeded(request);
+  });
+
   // Optimize
   auto tStart = boost::posix_time::second_clock::local_time();
   opt.optimize();
   CONSOLE_BRIDGE_logInform("planning time: %.3f", (boost::posix_time::second_clock::local_time() - tStart).seconds());
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("TrajOptPlanner was cancelled");
+    response.status = tesseract_common::StatusCode(TrajOptMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
   if (opt.results().status != sco::OptStatus::OPT_CONVERGED)
   {
     response.status =
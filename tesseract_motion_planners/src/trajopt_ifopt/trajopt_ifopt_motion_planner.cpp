@@ -28,6 +28,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
 #include <tesseract_environment/core/utils.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <functional>
 #include <trajopt_sqp/trust_region_sqp_solver.h>
 #include <trajopt_sqp/osqp_eigen_solver.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -41,6 +42,21 @@ using namespace trajopt;
 
 namespace tesseract_planning
 {
+/** @brief Stops the SQP solver after an iteration once the stop check returns true */
+class StopSQPCallback : public trajopt_sqp::SQPCallback
+{
+public:
+  explicit StopSQPCallback(std::function<bool()> stop) : stop_(std::move(stop)) {}
+
+  bool execute(const ifopt::Problem& /*nlp*/, const trajopt_sqp::SQPResults& /*sqp_results*/) override
+  {
+    return !stop_();
+  }
+
+private:
+  std::function<bool()> stop_;
+};
+
 TrajOptIfoptMotionPlannerStatusCategory::TrajOptIfoptMotionPlannerStatusCategory(std::string name)
   : name_(std::move(name))
 {
@@ -62,6 +78,10 @@ std::string TrajOptIfoptMotionPlannerStatusCategory::message(int code) const
     {
       return "Failed to find valid solution";
     }
+    case Cancelled:
+    {
+      return "Planning was cancelled";
+    }
     default:
     {
       assert(false);
@@ -79,8 +99,8 @@ const std::string& TrajOptIfoptMotionPlanner::getName() const { return name_; }
 
 bool TrajOptIfoptMotionPlanner::terminate()
 {
-  CONSOLE_BRIDGE_logWarn("Termination of ongoing optimization is not implemented yet");
-  return false;
+  cancelRunningSolves();
+  return true;
 }
 
 void TrajOptIfoptMotionPlanner::clear()
@@ -117,6 +137,15 @@ tesseract_common::StatusCode TrajOptIfoptMotionPlanner::solve(const PlannerReque
     response.data = problem;
   }
 
+  std::function<bool()> cancelled = getCancellationCheck(request);
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("TrajOptIfoptPlanner was cancelled");
+    response.status =
+        tesseract_common::StatusCode(TrajOptIfoptMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
   // Create optimizer
   /** @todo Enable solver selection (e.g. IPOPT) */
   auto qp_solver = std::make_shared<trajopt_sqp::OSQPEigenSolver>();
@@ -136,6 +165,10 @@ tesseract_common::StatusCode TrajOptIfoptMotionPlanner::solve(const PlannerReque
     solver.registerCallback(callback);
   }
 
+  // Stop iterating once the solve is cancelled or the request deadline has passed
+  solver.registerCallback(std::make_shared<StopSQPCallback>(
+      [&cancelled, &request]() { return cancelled() || isDeadlineExceeded(request); }));
+
   // solve
   solver.verbose = verbose;
 
@@ -143,6 +176,14 @@ tesseract_common::StatusCode TrajOptIfoptMotionPlanner::solve(const PlannerReque
   solver.Solve(*(problem->nlp));
   CONSOLE_BRIDGE_logInform("planning time: %.3f", (boost::posix_time::second_clock::local_time() - tStart).seconds());
 
+  if (cancelled())
+  {
+    CONSOLE_BRIDGE_logInform("TrajOptIfoptPlanner was cancelled");
+    response.status =
+        tesseract_common::StatusCode(TrajOptIfoptMotionPlannerStatusCategory::Cancelled, status_category_);
+    return response.status;
+  }
+
   // Check success
   if (solver.getStatus() != trajopt_sqp::SQPStatus::NLP_CONVERGED)
   {
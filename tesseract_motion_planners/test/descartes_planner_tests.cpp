@@ -27,8 +27,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <tesseract_motion_planners/descartes/descartes_collision.h>
+#include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
+#include <tesseract_motion_planners/descartes/descartes_edge_evaluators.h>
 #include <descartes_samplers/evaluators/euclidean_distance_edge_evaluator.h>
+#include <descartes_samplers/evaluators/compound_edge_evaluator.h>
 #include <tesseract_kinematics/core/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -38,9 +44,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_command_language/utils/utils.h>
 
 #include <tesseract_motion_planners/descartes/descartes_motion_planner.h>
+#include <tesseract_motion_planners/descartes/descartes_robot_sampler.h>
+#include <tesseract_motion_planners/descartes/impl/descartes_tesseract_kinematics.hpp>
 #include <tesseract_motion_planners/descartes/descartes_utils.h>
+#include <tesseract_motion_planners/descartes/descartes_vertex_evaluator.h>
 #include <tesseract_motion_planners/descartes/profile/descartes_default_plan_profile.h>
 #include <tesseract_motion_planners/descartes/problem_generators/default_problem_generator.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_motion_planners/core/utils.h>
 #include <tesseract_motion_planners/interface_utils.h>
@@ -328,6 +338,70 @@ TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerAxialSymetric)  // NOLINT
   }
 }
 
+TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerSharedVertexCollision)  // NOLINT
+{
+  auto cur_state = env_->getCurrentState();
+
+  CartesianWaypoint wp1 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -.20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+  CartesianWaypoint wp2 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, .20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+  CartesianWaypoint wp3 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, .40, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+
+  // The first two plan instructions use the same profile and the last one a different collision margin
+  PlanInstruction start_instruction(wp1, PlanInstructionType::START, "TEST_PROFILE", manip);
+  PlanInstruction plan_f1(wp2, PlanInstructionType::LINEAR, "TEST_PROFILE", manip);
+  PlanInstruction plan_f2(wp3, PlanInstructionType::LINEAR, "MARGIN_PROFILE", manip);
+
+  CompositeInstruction program;
+  program.setStartInstruction(start_instruction);
+  program.setManipulatorInfo(manip);
+  program.push_back(plan_f1);
+  program.push_back(plan_f2);
+
+  CompositeInstruction seed = generateSeed(program, cur_state, env_, 3.14, 1.0, 3.14, 10);
+
+  auto plan_profile = std::make_shared<DescartesDefaultPlanProfileD>();
+  auto margin_profile = std::make_shared<DescartesDefaultPlanProfileD>();
+  margin_profile->vertex_collision_check_config.collision_margin_data = CollisionMarginData(0.05);
+
+  DescartesMotionPlannerD descartes_planner;
+  descartes_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+  descartes_planner.plan_profiles["MARGIN_PROFILE"] = margin_profile;
+
+  PlannerRequest request;
+  request.seed = seed;
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  auto problem = DefaultDescartesProblemGenerator<double>(
+      descartes_planner.getName(), request, descartes_planner.plan_profiles);
+  EXPECT_EQ(problem->samplers.size(), 21);
+
+  // The waypoints of each profile share one vertex collision interface
+  EXPECT_EQ(problem->vertex_collision_interfaces.size(), 2);
+
+  // Only the parts of the config used by the vertex checks are part of the key
+  KinematicMetadata::ConstPtr metadata = KinematicMetadataCache::get(*env_, *problem->manip_inv_kin);
+  const std::vector<std::string>& joint_names = problem->manip_inv_kin->getJointNames();
+  const std::vector<std::string>& active_links = metadata->active_link_names;
+  CollisionCheckConfig config(0);
+  std::string key = getDescartesCollisionKey(active_links, joint_names, config, false);
+  EXPECT_EQ(problem->vertex_collision_interfaces.count(key), 1);
+
+  CollisionCheckConfig continuous_config(0);
+  continuous_config.type = CollisionEvaluatorType::CONTINUOUS;
+  EXPECT_EQ(getDescartesCollisionKey(active_links, joint_names, continuous_config, false), key);
+  EXPECT_NE(getDescartesCollisionKey(active_links, joint_names, config, true), key);
+  EXPECT_NE(getDescartesCollisionKey(active_links, joint_names, CollisionCheckConfig(0.05), false), key);
+
+  CollisionCheckConfig pair_config(0);
+  pair_config.collision_margin_data.setPairCollisionMarginData(active_links.front(), active_links.back(), 0.1);
+  EXPECT_NE(getDescartesCollisionKey(active_links, joint_names, pair_config, false), key);
+}
+
 TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerCollisionEdgeEvaluator)  // NOLINT
 {
   // Create the planner and the responses that will store the results
@@ -436,6 +510,308 @@ TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerCollisionEdgeEvaluator)
   }
 }
 
+/** @brief Calls a function on every vertex evaluation, used to act while the graph is being built */
+class CallbackVertexEvaluator : public DescartesVertexEvaluator<double>
+{
+public:
+  CallbackVertexEvaluator(std::function<void()> callback) : callback_(std::move(callback)) {}
+
+  bool operator()(const Eigen::Ref<const Eigen::VectorXd>& /*vertex*/) const override
+  {
+    callback_();
+    return true;
+  }
+
+private:
+  std::function<void()> callback_;
+};
+
+TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerCancelInProgress)  // NOLINT
+{
+  CartesianWaypoint wp1 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -.20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+  CartesianWaypoint wp2 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, .20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+
+  CompositeInstruction program;
+  program.setStartInstruction(PlanInstruction(wp1, PlanInstructionType::START, "TEST_PROFILE", manip));
+  program.setManipulatorInfo(manip);
+  program.push_back(PlanInstruction(wp2, PlanInstructionType::LINEAR, "TEST_PROFILE", manip));
+
+  // The first vertex evaluated while the graph is built cancels the solve
+  std::function<void()> cancel;
+  auto plan_profile = std::make_shared<DescartesDefaultPlanProfileD>();
+  plan_profile->num_threads = 1;
+  plan_profile->vertex_evaluator = [&cancel](const DescartesProblem<double>& /*prob*/) {
+    return std::make_shared<CallbackVertexEvaluator>([&cancel]() {
+      if (cancel)
+        cancel();
+    });
+  };
+
+  DescartesMotionPlannerD descartes_planner;
+  descartes_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+  descartes_planner.problem_generator = &DefaultDescartesProblemGenerator<double>;
+
+  PlannerRequest request;
+  request.seed = generateSeed(program, env_->getCurrentState(), env_, 3.14, 1.0, 3.14, 10);
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  // Cancelled through the request token
+  auto token = std::make_shared<CancellationToken>();
+  cancel = [token]() { token->cancel(); };
+  request.cancellation_token = token;
+  PlannerResponse token_response;
+  auto status = descartes_planner.solve(request, token_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), DescartesMotionPlannerStatusCategory::Cancelled);
+  EXPECT_TRUE(token->isCancelled());
+
+  // Cancelled through terminate(), a later solve is not affected
+  request.cancellation_token = nullptr;
+  bool terminated = false;
+  cancel = [&descartes_planner, &terminated]() {
+    if (!terminated)
+      terminated = descartes_planner.terminate();
+  };
+  PlannerResponse terminate_response;
+  status = descartes_planner.solve(request, terminate_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), DescartesMotionPlannerStatusCategory::Cancelled);
+  EXPECT_TRUE(terminated);
+
+  cancel = nullptr;
+  PlannerResponse response;
+  status = descartes_planner.solve(request, response);
+  EXPECT_TRUE(status);
+}
+
+TEST_F(TesseractPlanningDescartesUnit, DescartesTesseractKinematicsRedundantSolutions)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  auto inv_kin = env_->getManipulatorManager()->getInvKinematicSolver(manip.manipulator);
+  const auto dof = static_cast<std::size_t>(fwd_kin->numJoints());
+
+  Eigen::VectorXd joints = Eigen::VectorXd::Zero(static_cast<long>(dof));
+  joints(1) = 0.2;
+  joints(2) = 0.3;
+  Eigen::Isometry3d pose;
+  EXPECT_TRUE(fwd_kin->calcFwdKin(pose, joints));
+
+  // Get the solution without filtering or redundant solutions
+  DescartesTesseractKinematicsD plain_kin(fwd_kin, inv_kin, nullptr, nullptr);
+  std::vector<double> plain;
+  ASSERT_TRUE(plain_kin.ik(pose, plain));
+  ASSERT_EQ(plain.size(), dof);
+
+  // The redundant solutions shift the first joint by a small and a large amount
+  auto redundant_sol_fn = [dof](const double* vertex) {
+    std::vector<double> sols(vertex, vertex + dof);
+    sols.insert(sols.end(), vertex, vertex + dof);
+    sols[0] += 0.1;
+    sols[dof] += 10;
+    return sols;
+  };
+
+  // Only the solution and the small shift are valid, solutions are appended after the existing content
+  auto is_valid_fn = [&plain](const double* vertex) { return std::abs(vertex[0] - plain[0]) < 1; };
+  DescartesTesseractKinematicsD kin(fwd_kin, inv_kin, is_valid_fn, redundant_sol_fn);
+  std::vector<double> solution_set(dof, 42);
+  EXPECT_TRUE(kin.ik(pose, solution_set));
+  ASSERT_EQ(solution_set.size(), 3 * dof);
+  for (std::size_t i = 0; i < dof; ++i)
+  {
+    EXPECT_DOUBLE_EQ(solution_set[i], 42);
+    EXPECT_DOUBLE_EQ(solution_set[dof + i], plain[i]);
+    EXPECT_DOUBLE_EQ(solution_set[2 * dof + i], (i == 0) ? plain[i] + 0.1 : plain[i]);
+  }
+
+  // A rejected solution still provides its redundant solutions
+  auto shifted_valid_fn = [&plain](const double* vertex) { return std::abs(vertex[0] - plain[0] - 0.1) < 1e-6; };
+  DescartesTesseractKinematicsD shifted_kin(fwd_kin, inv_kin, shifted_valid_fn, redundant_sol_fn);
+  solution_set.clear();
+  EXPECT_TRUE(shifted_kin.ik(pose, solution_set));
+  ASSERT_EQ(solution_set.size(), dof);
+  EXPECT_DOUBLE_EQ(solution_set[0], plain[0] + 0.1);
+
+  // Without redundant solutions a rejected solution is removed again
+  DescartesTesseractKinematicsD reject_kin(fwd_kin, inv_kin, [](const double*) { return false; }, nullptr);
+  solution_set.clear();
+  EXPECT_FALSE(reject_kin.ik(pose, solution_set));
+  EXPECT_TRUE(solution_set.empty());
+}
+
+/** @brief A collision interface where every state is in collision and the distance is given by the first joint */
+class FirstJointCollisionInterface : public descartes_light::CollisionInterface<double>
+{
+public:
+  bool validate(const double* /*pos*/, std::size_t /*size*/) override { return false; }
+
+  double distance(const double* pos, std::size_t /*size*/) override { return pos[0]; }
+
+  descartes_light::CollisionInterface<double>::Ptr clone() const override
+  {
+    return std::make_shared<FirstJointCollisionInterface>();
+  }
+};
+
+TEST_F(TesseractPlanningDescartesUnit, DescartesRobotSamplerAllowCollision)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  auto inv_kin = env_->getManipulatorManager()->getInvKinematicSolver(manip.manipulator);
+  const auto dof = static_cast<std::size_t>(fwd_kin->numJoints());
+
+  Eigen::VectorXd joints = Eigen::VectorXd::Zero(static_cast<long>(dof));
+  joints(1) = 0.2;
+  joints(2) = 0.3;
+  Eigen::Isometry3d pose;
+  EXPECT_TRUE(fwd_kin->calcFwdKin(pose, joints));
+
+  auto pose_sampler = [](const Eigen::Isometry3d& tool_pose) {
+    return tesseract_planning::sampleToolAxis(tool_pose, M_PI_4, Eigen::Vector3d(0, 0, 1));
+  };
+  auto collision = std::make_shared<FirstJointCollisionInterface>();
+  const Eigen::Isometry3d tcp = Eigen::Isometry3d::Identity();
+
+  // Get every candidate solution without collision checking
+  DescartesRobotSamplerD candidate_sampler(pose, pose_sampler, inv_kin, nullptr, tcp, false, nullptr);
+  std::vector<double> candidates;
+  ASSERT_TRUE(candidate_sampler.sample(candidates));
+  ASSERT_GT(candidates.size(), dof);
+  double best = std::numeric_limits<double>::lowest();
+  for (std::size_t i = 0; i < candidates.size(); i += dof)
+    best = std::max(best, candidates[i]);
+
+  // Every candidate is in collision
+  DescartesRobotSamplerD sampler(pose, pose_sampler, inv_kin, collision, tcp, false, nullptr);
+  std::vector<double> solution_set;
+  EXPECT_FALSE(sampler.sample(solution_set));
+  EXPECT_TRUE(solution_set.empty());
+
+  // Allowing collision keeps only the candidate furthest from collision after the existing content
+  DescartesRobotSamplerD allow_sampler(pose, pose_sampler, inv_kin, collision, tcp, true, nullptr);
+  solution_set.assign(dof, 42);
+  EXPECT_TRUE(allow_sampler.sample(solution_set));
+  ASSERT_EQ(solution_set.size(), 2 * dof);
+  for (std::size_t i = 0; i < dof; ++i)
+    EXPECT_DOUBLE_EQ(solution_set[i], 42);
+  EXPECT_DOUBLE_EQ(solution_set[dof], best);
+}
+
+TEST(TesseractPlanningDescartesEdgeEvaluatorUnit, JointDeltaEdgeEvaluator)  // NOLINT
+{
+  Eigen::VectorXd max_joint_delta(3);
+  max_joint_delta << 0.1, 0.2, 0.3;
+  DescartesJointDeltaEdgeEvaluatorD evaluator(max_joint_delta);
+
+  std::vector<double> start{ 0, 0, 0 };
+  std::vector<double> within{ 0.1, -0.2, 0.25 };
+  std::vector<double> outside{ 0.05, 0.05, -0.31 };
+  EXPECT_TRUE(evaluator.considerEdge(start.data(), within.data()).first);
+  EXPECT_FALSE(evaluator.considerEdge(start.data(), outside.data()).first);
+  EXPECT_FALSE(evaluator.considerEdge(outside.data(), within.data()).first);
+}
+
+TEST_F(TesseractPlanningDescartesUnit, RobotConfigEdgeEvaluator)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  DescartesRobotConfigEdgeEvaluatorD evaluator(fwd_kin);
+
+  std::vector<double> start{ 0, 0.2, 0.3, 0, 0.5, 0 };
+  std::vector<double> same_config{ 0.1, 0.25, 0.35, 0.1, 0.6, 0.1 };
+  std::vector<double> wrist_flip{ 0, 0.2, 0.3, 0, -0.5, 0 };
+  EXPECT_TRUE(evaluator.considerEdge(start.data(), same_config.data()).first);
+  EXPECT_FALSE(evaluator.considerEdge(start.data(), wrist_flip.data()).first);
+  EXPECT_FALSE(evaluator.considerEdge(wrist_flip.data(), start.data()).first);
+
+  // The sign correction changes which configuration a state has but not whether an edge changes it
+  DescartesRobotConfigEdgeEvaluatorD corrected_evaluator(fwd_kin, Eigen::Vector2i(1, -1));
+  EXPECT_TRUE(corrected_evaluator.considerEdge(start.data(), same_config.data()).first);
+  EXPECT_FALSE(corrected_evaluator.considerEdge(start.data(), wrist_flip.data()).first);
+  EXPECT_EQ(getRobotConfig<double>(fwd_kin, Eigen::Map<Eigen::VectorXd>(start.data(), 6)),
+            getRobotConfig<double>(fwd_kin, Eigen::Map<Eigen::VectorXd>(wrist_flip.data(), 6), Eigen::Vector2i(1, -1)));
+}
+
+TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerEdgeEvaluatorOrder)  // NOLINT
+{
+  auto cur_state = env_->getCurrentState();
+
+  CartesianWaypoint wp1 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -.20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+  CartesianWaypoint wp2 =
+      Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, .20, 0.8) * Eigen::Quaterniond(0, 0, -1.0, 0);
+
+  PlanInstruction start_instruction(wp1, PlanInstructionType::START, "TEST_PROFILE", manip);
+  PlanInstruction plan_f1(wp2, PlanInstructionType::LINEAR, "TEST_PROFILE", manip);
+
+  CompositeInstruction program;
+  program.setStartInstruction(start_instruction);
+  program.setManipulatorInfo(manip);
+  program.push_back(plan_f1);
+
+  CompositeInstruction seed = generateSeed(program, cur_state, env_, 3.14, 1.0, 3.14, 10);
+
+  PlannerRequest request;
+  request.seed = seed;
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  auto plan_profile = std::make_shared<DescartesDefaultPlanProfileD>();
+  DescartesMotionPlannerD descartes_planner;
+  descartes_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+
+  // Without the cheap checks the default evaluator is used directly
+  auto problem = DefaultDescartesProblemGenerator<double>(
+      descartes_planner.getName(), request, descartes_planner.plan_profiles);
+  ASSERT_EQ(problem->edge_evaluators.size(), 10);
+  EXPECT_TRUE(std::dynamic_pointer_cast<descartes_light::EuclideanDistanceEdgeEvaluator<double>>(
+                  problem->edge_evaluators.front()) != nullptr);
+
+  // The joint delta check runs first, then the configuration check and then the collision checks
+  plan_profile->edge_max_joint_delta = Eigen::VectorXd::Constant(6, 0.5);
+  plan_profile->edge_reject_config_change = true;
+  plan_profile->enable_edge_collision = true;
+  problem = DefaultDescartesProblemGenerator<double>(
+      descartes_planner.getName(), request, descartes_planner.plan_profiles);
+  ASSERT_EQ(problem->edge_evaluators.size(), 10);
+  for (const auto& edge_evaluator : problem->edge_evaluators)
+  {
+    auto pipeline = std::dynamic_pointer_cast<descartes_light::CompoundEdgeEvaluator<double>>(edge_evaluator);
+    ASSERT_TRUE(pipeline != nullptr);
+    ASSERT_EQ(pipeline->evaluators.size(), 3);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DescartesJointDeltaEdgeEvaluatorD>(pipeline->evaluators[0]) != nullptr);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DescartesRobotConfigEdgeEvaluatorD>(pipeline->evaluators[1]) != nullptr);
+
+    auto collision = std::dynamic_pointer_cast<descartes_light::CompoundEdgeEvaluator<double>>(pipeline->evaluators[2]);
+    ASSERT_TRUE(collision != nullptr);
+    ASSERT_EQ(collision->evaluators.size(), 2);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DescartesCollisionEdgeEvaluatorD>(collision->evaluators[1]) != nullptr);
+  }
+
+  // Only the enabled checks are added
+  plan_profile->edge_max_joint_delta.resize(0);
+  plan_profile->enable_edge_collision = false;
+  problem = DefaultDescartesProblemGenerator<double>(
+      descartes_planner.getName(), request, descartes_planner.plan_profiles);
+  auto pipeline =
+      std::dynamic_pointer_cast<descartes_light::CompoundEdgeEvaluator<double>>(problem->edge_evaluators.front());
+  ASSERT_TRUE(pipeline != nullptr);
+  ASSERT_EQ(pipeline->evaluators.size(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DescartesRobotConfigEdgeEvaluatorD>(pipeline->evaluators[0]) != nullptr);
+  EXPECT_TRUE(std::dynamic_pointer_cast<descartes_light::EuclideanDistanceEdgeEvaluator<double>>(
+                  pipeline->evaluators[1]) != nullptr);
+
+  // The joint delta must have one element per joint
+  plan_profile->edge_max_joint_delta = Eigen::VectorXd::Constant(5, 0.5);
+  EXPECT_ANY_THROW(DefaultDescartesProblemGenerator<double>(  // NOLINT
+      descartes_planner.getName(),
+      request,
+      descartes_planner.plan_profiles));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -40,6 +40,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/prm/PRM.h>
 #include <ompl/geometric/planners/prm/PRMstar.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
+#include <ompl/base/PlannerData.h>
+#include <ompl/base/ProblemDefinition.h>
+#include <ompl/base/ScopedState.h>
+#include <ompl/base/spaces/RealVectorStateSpace.h>
 #include <ompl/geometric/planners/prm/SPARS.h>
 
 #include <ompl/util/RandomNumbers.h>
@@ -53,6 +58,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_environment/ofkt/ofkt_state_solver.h>
 #include <tesseract_environment/core/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/ompl_motion_planner_status_category.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
 #include <tesseract_motion_planners/ompl/problem_generators/default_problem_generator.h>
@@ -297,6 +303,443 @@ TYPED_TEST(OMPLTestFixture, OMPLFreespacePlannerUnit)
   EXPECT_FALSE(status);
 }
 
+TYPED_TEST(OMPLTestFixture, OMPLFreespaceMultiSegmentPlannerUnit)
+{
+  EXPECT_EQ(ompl::RNG::getSeed(), SEED) << "Randomization seed does not match expected: " << ompl::RNG::getSeed()
+                                        << " vs. " << SEED;
+
+  // Step 1: Load scene and srdf
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  Environment::Ptr env = std::make_shared<Environment>();
+  boost::filesystem::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  boost::filesystem::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init<OFKTStateSolver>(urdf_path, srdf_path, locator));
+
+  ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+
+  // Step 2: Add box to environment
+  addBox(*env);
+
+  // Step 3: Create ompl planner config and populate it
+  auto fwd_kin = env->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  auto cur_state = env->getCurrentState();
+
+  // Go from the start to the end and back, each freespace move is planned as its own problem
+  JointWaypoint wp1(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size())));
+  JointWaypoint wp2(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size())));
+
+  PlanInstruction start_instruction(wp1, PlanInstructionType::START, "TEST_PROFILE");
+  PlanInstruction plan_f1(wp2, PlanInstructionType::FREESPACE, "TEST_PROFILE");
+  PlanInstruction plan_f2(wp1, PlanInstructionType::FREESPACE, "TEST_PROFILE");
+
+  CompositeInstruction program;
+  program.setStartInstruction(start_instruction);
+  program.setManipulatorInfo(manip);
+  program.push_back(plan_f1);
+  program.push_back(plan_f2);
+
+  CompositeInstruction seed = generateSeed(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_margin_data.setDefaultCollisionMarginData(0.025);
+  plan_profile->planning_time = 10;
+  plan_profile->max_solutions = 2;
+  plan_profile->longest_valid_segment_fraction = 0.01;
+  plan_profile->collision_continuous = true;
+  plan_profile->simplify = false;
+  plan_profile->planners = { this->configurator, this->configurator };
+
+  OMPLMotionPlanner ompl_planner;
+  ompl_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+  ompl_planner.problem_generator = &DefaultOMPLProblemGenerator;
+
+  PlannerRequest request;
+  request.instructions = program;
+  request.seed = seed;
+  request.env = env;
+  request.env_state = env->getCurrentState();
+
+  PlannerResponse planner_response;
+  auto status = ompl_planner.solve(request, planner_response);
+
+  if (!status)
+  {
+    CONSOLE_BRIDGE_logError("CI Error: %s", status.message().c_str());
+  }
+
+  ASSERT_TRUE(status);
+  EXPECT_EQ(std::static_pointer_cast<std::vector<OMPLProblem::Ptr>>(planner_response.data)->size(), 2UL);
+  EXPECT_EQ(getMoveInstructionCount(planner_response.results), 21);
+
+  // Each freespace move is planned as its own segment and the segments are stitched together in order
+  ASSERT_EQ(planner_response.results.size(), 2UL);
+  ASSERT_TRUE(isCompositeInstruction(planner_response.results[0]));
+  ASSERT_TRUE(isCompositeInstruction(planner_response.results[1]));
+  const auto* first_segment = planner_response.results[0].cast_const<CompositeInstruction>();
+  const auto* second_segment = planner_response.results[1].cast_const<CompositeInstruction>();
+  EXPECT_FALSE(first_segment->empty());
+  EXPECT_FALSE(second_segment->empty());
+  EXPECT_TRUE(wp1.isApprox(getJointPosition(getFirstMoveInstruction(planner_response.results)->getWaypoint()), 1e-5));
+  EXPECT_TRUE(wp2.isApprox(getJointPosition(getLastMoveInstruction(*first_segment)->getWaypoint()), 1e-5));
+  EXPECT_TRUE(wp1.isApprox(getJointPosition(getLastMoveInstruction(*second_segment)->getWaypoint()), 1e-5));
+  EXPECT_TRUE(wp1.isApprox(getJointPosition(getLastMoveInstruction(planner_response.results)->getWaypoint()), 1e-5));
+
+  // The states of a segment are within the joint limits
+  const Eigen::MatrixX2d limits = fwd_kin->getLimits().joint_limits;
+  for (const auto* segment : { first_segment, second_segment })
+  {
+    for (const auto& instruction : *segment)
+    {
+      ASSERT_TRUE(isMoveInstruction(instruction));
+      const Eigen::VectorXd& position = getJointPosition(instruction.cast_const<MoveInstruction>()->getWaypoint());
+      ASSERT_EQ(position.size(), limits.rows());
+      EXPECT_TRUE(((position.array() >= limits.col(0).array() - 1e-5) &&
+                   (position.array() <= limits.col(1).array() + 1e-5))
+                      .all());
+    }
+  }
+
+  // A cancelled request returns without planning
+  auto cancellation_token = std::make_shared<CancellationToken>();
+  cancellation_token->cancel();
+  request.cancellation_token = cancellation_token;
+
+  PlannerResponse cancelled_response;
+  status = ompl_planner.solve(request, cancelled_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), OMPLMotionPlannerStatusCategory::Cancelled);
+}
+
+/** @brief Calls a function on every state validity check, used to act while the planner is running */
+class CallbackStateValidator : public ompl::base::StateValidityChecker
+{
+public:
+  CallbackStateValidator(const ompl::base::SpaceInformationPtr& si, std::function<void()> callback)
+    : ompl::base::StateValidityChecker(si), callback_(std::move(callback))
+  {
+  }
+
+  bool isValid(const ompl::base::State* /*state*/) const override
+  {
+    callback_();
+    return true;
+  }
+
+private:
+  std::function<void()> callback_;
+};
+
+TYPED_TEST(OMPLTestFixture, OMPLFreespaceCancelInProgressUnit)
+{
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  Environment::Ptr env = std::make_shared<Environment>();
+  boost::filesystem::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  boost::filesystem::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init<OFKTStateSolver>(urdf_path, srdf_path, locator));
+
+  ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  addBox(*env);
+
+  auto fwd_kin = env->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  JointWaypoint wp1(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size())));
+  JointWaypoint wp2(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size())));
+
+  CompositeInstruction program;
+  program.setStartInstruction(PlanInstruction(wp1, PlanInstructionType::START, "TEST_PROFILE"));
+  program.setManipulatorInfo(manip);
+  program.push_back(PlanInstruction(wp2, PlanInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  OMPLMotionPlanner ompl_planner;
+  ompl_planner.problem_generator = &DefaultOMPLProblemGenerator;
+
+  // The first state validity check while planning cancels the solve
+  std::function<void()> cancel;
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->planning_time = 10;
+  plan_profile->collision_continuous = true;
+  plan_profile->planners = { this->configurator };
+  plan_profile->svc_allocator = [&cancel](const ompl::base::SpaceInformationPtr& si, const OMPLProblem&) {
+    return std::make_shared<CallbackStateValidator>(si, [&cancel]() {
+      if (cancel)
+        cancel();
+    });
+  };
+  ompl_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+
+  PlannerRequest request;
+  request.instructions = program;
+  request.seed = generateSeed(program, env->getCurrentState(), env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.env_state = env->getCurrentState();
+
+  // Cancelled through the request token
+  auto token = std::make_shared<CancellationToken>();
+  cancel = [token]() { token->cancel(); };
+  request.cancellation_token = token;
+  PlannerResponse token_response;
+  auto status = ompl_planner.solve(request, token_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), OMPLMotionPlannerStatusCategory::Cancelled);
+  EXPECT_TRUE(token->isCancelled());
+
+  // Cancelled through terminate(), a later solve is not affected
+  request.cancellation_token = nullptr;
+  bool terminated = false;
+  cancel = [&ompl_planner, &terminated]() {
+    if (!terminated)
+      terminated = ompl_planner.terminate();
+  };
+  PlannerResponse terminate_response;
+  status = ompl_planner.solve(request, terminate_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), OMPLMotionPlannerStatusCategory::Cancelled);
+  EXPECT_TRUE(terminated);
+
+  cancel = nullptr;
+  PlannerResponse response;
+  status = ompl_planner.solve(request, response);
+  EXPECT_TRUE(status);
+}
+
+TYPED_TEST(OMPLTestFixture, OMPLFreespaceRoadmapPlannerUnit)
+{
+  EXPECT_EQ(ompl::RNG::getSeed(), SEED) << "Randomization seed does not match expected: " << ompl::RNG::getSeed()
+                                        << " vs. " << SEED;
+
+  // Step 1: Load scene and srdf
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  Environment::Ptr env = std::make_shared<Environment>();
+  boost::filesystem::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  boost::filesystem::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init<OFKTStateSolver>(urdf_path, srdf_path, locator));
+
+  ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+
+  // Step 2: Add box to environment
+  addBox(*env);
+
+  // Step 3: Create ompl planner config and populate it
+  auto fwd_kin = env->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  auto cur_state = env->getCurrentState();
+
+  JointWaypoint wp1(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size())));
+  JointWaypoint wp2(fwd_kin->getJointNames(),
+                    Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size())));
+
+  PlanInstruction start_instruction(wp1, PlanInstructionType::START, "TEST_PROFILE");
+  PlanInstruction plan_f1(wp2, PlanInstructionType::FREESPACE, "TEST_PROFILE");
+
+  CompositeInstruction program;
+  program.setStartInstruction(start_instruction);
+  program.setManipulatorInfo(manip);
+  program.push_back(plan_f1);
+
+  CompositeInstruction seed = generateSeed(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_margin_data.setDefaultCollisionMarginData(0.025);
+  plan_profile->planning_time = 10;
+  plan_profile->max_solutions = 2;
+  plan_profile->optimize = false;
+  plan_profile->longest_valid_segment_fraction = 0.01;
+  plan_profile->collision_continuous = true;
+  plan_profile->simplify = false;
+  plan_profile->planners = { this->configurator, this->configurator };
+  plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>();
+
+  OMPLMotionPlanner ompl_planner;
+  ompl_planner.plan_profiles["TEST_PROFILE"] = plan_profile;
+  ompl_planner.problem_generator = &DefaultOMPLProblemGenerator;
+
+  PlannerRequest request;
+  request.instructions = program;
+  request.seed = seed;
+  request.env = env;
+  request.env_state = env->getCurrentState();
+
+  PlannerResponse planner_response;
+  auto status = ompl_planner.solve(request, planner_response);
+  EXPECT_TRUE(status) << status.message();
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 1UL);
+
+  OMPLRoadmap::Ptr roadmap =
+      plan_profile->roadmap_cache->get(OMPLRoadmapCache::getKey(fwd_kin->getName(), fwd_kin->getJointNames()));
+  if (!OMPLRoadmap::isSupported(this->configurator->getType()))
+  {
+    EXPECT_EQ(roadmap->getVertexCount(), 0UL);
+    return;
+  }
+
+  std::size_t vertex_count = roadmap->getVertexCount();
+  EXPECT_GT(vertex_count, 0UL);
+  EXPECT_EQ(roadmap->getRevision(), env->getRevision());
+
+  // The second request starts from the roadmap of the first
+  PlannerResponse second_response;
+  status = ompl_planner.solve(request, second_response);
+  EXPECT_TRUE(status) << status.message();
+  EXPECT_GE(roadmap->getVertexCount(), vertex_count);
+}
+
+/** @brief Create a LazyPRM holding a roadmap of two dimensional states with an edge between consecutive states */
+static ompl::base::PlannerPtr createLazyPRM(const ompl::base::SpaceInformationPtr& si,
+                                            const std::vector<Eigen::Vector2d>& states)
+{
+  ompl::base::PlannerData data(si);
+  for (const auto& s : states)
+  {
+    ompl::base::State* state = si->allocState();
+    state->as<ompl::base::RealVectorStateSpace::StateType>()->values[0] = s(0);
+    state->as<ompl::base::RealVectorStateSpace::StateType>()->values[1] = s(1);
+    data.addVertex(ompl::base::PlannerDataVertex(state));
+  }
+
+  for (unsigned i = 1; i < data.numVertices(); ++i)
+    data.addEdge(i - 1, i);
+
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(data);
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+    si->freeState(const_cast<ompl::base::State*>(data.getVertex(i).getState()));  // NOLINT
+
+  return planner;
+}
+
+TEST(OMPLRoadmapUnit, CreatePlannerAndMerge)  // NOLINT
+{
+  auto space = std::make_shared<ompl::base::RealVectorStateSpace>(2);
+  space->setBounds(-1, 1);
+  auto si = std::make_shared<ompl::base::SpaceInformation>(space);
+  si->setStateValidityChecker([](const ompl::base::State*) { return true; });
+  si->setup();
+
+  PRMConfigurator configurator;
+  configurator.max_nearest_neighbors = 3;
+
+  // PRM is replaced by LazyPRM which keeps the parameters of the configurator
+  OMPLRoadmap roadmap;
+  ompl::base::PlannerPtr planner = roadmap.createPlanner(si, configurator);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ompl::geometric::LazyPRM>(planner) != nullptr);
+  EXPECT_EQ(planner->params().getParam("max_nearest_neighbors")->getValue(), "3");
+
+#ifndef OMPL_LESS_1_4_0
+  // The roadmaps of planners started from the same roadmap are merged, equal states are stored once
+  roadmap.update(*createLazyPRM(si, { Eigen::Vector2d(0, 0), Eigen::Vector2d(0.5, 0) }), 1);
+  EXPECT_EQ(roadmap.getVertexCount(), 2UL);
+  EXPECT_EQ(roadmap.getEdgeCount(), 1UL);
+  EXPECT_EQ(roadmap.getRevision(), 1);
+
+  roadmap.update(*createLazyPRM(si, { Eigen::Vector2d(0, 0), Eigen::Vector2d(0, 0.5) }), 2);
+  EXPECT_EQ(roadmap.getVertexCount(), 3UL);
+  EXPECT_EQ(roadmap.getEdgeCount(), 2UL);
+  EXPECT_EQ(roadmap.getRevision(), 2);
+
+  // A smaller roadmap does not remove anything
+  roadmap.update(*createLazyPRM(si, { Eigen::Vector2d(0.5, 0) }), 3);
+  EXPECT_EQ(roadmap.getVertexCount(), 3UL);
+  EXPECT_EQ(roadmap.getEdgeCount(), 2UL);
+
+  // A planner seeded with the roadmap also keeps the parameters of the configurator
+  planner = roadmap.createPlanner(si, configurator);
+  EXPECT_EQ(planner->params().getParam("max_nearest_neighbors")->getValue(), "3");
+  ompl::base::PlannerData data(si);
+  planner->getPlannerData(data);
+  EXPECT_EQ(data.numVertices(), 3U);
+#endif
+}
+
+/** @brief Check if the roadmap of a planner has an edge between two states */
+static bool hasEdge(const ompl::base::Planner& planner, const Eigen::Vector2d& a, const Eigen::Vector2d& b)
+{
+  ompl::base::PlannerData data(planner.getSpaceInformation());
+  planner.getPlannerData(data);
+
+  std::vector<unsigned> a_indices, b_indices;
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+  {
+    const auto* values = data.getVertex(i).getState()->as<ompl::base::RealVectorStateSpace::StateType>()->values;
+    const Eigen::Vector2d state(values[0], values[1]);
+    if (state == a)
+      a_indices.push_back(i);
+    else if (state == b)
+      b_indices.push_back(i);
+  }
+
+  for (const unsigned i : a_indices)
+    for (const unsigned j : b_indices)
+      if (data.edgeExists(i, j) || data.edgeExists(j, i))
+        return true;
+
+  return false;
+}
+
+TEST(OMPLRoadmapUnit, RemoveInvalidEdgesAndPrune)  // NOLINT
+{
+#ifndef OMPL_LESS_1_4_0
+  auto space = std::make_shared<ompl::base::RealVectorStateSpace>(2);
+  space->setBounds(-1, 1);
+  auto si = std::make_shared<ompl::base::SpaceInformation>(space);
+  si->setStateValidityChecker([](const ompl::base::State*) { return true; });
+  si->setup();
+
+  PRMConfigurator configurator;
+  OMPLRoadmap roadmap;
+  const Eigen::Vector2d start(-0.5, 0);
+  const Eigen::Vector2d goal(0.5, 0);
+  const Eigen::Vector2d side(0, 0.5);
+  roadmap.update(*createLazyPRM(si, { start, goal, side }), 1);
+  EXPECT_EQ(roadmap.getEdgeCount(), 2UL);
+
+  // An obstacle added between the start and the goal invalidates the edge between them
+  auto obstacle_si = std::make_shared<ompl::base::SpaceInformation>(space);
+  obstacle_si->setStateValidityChecker([](const ompl::base::State* state) {
+    const auto* values = state->as<ompl::base::RealVectorStateSpace::StateType>()->values;
+    return std::abs(values[0]) > 0.1 || std::abs(values[1]) > 0.1;
+  });
+  obstacle_si->setup();
+
+  ompl::base::PlannerPtr planner = roadmap.createPlanner(obstacle_si, configurator);
+  EXPECT_TRUE(hasEdge(*planner, start, goal));
+
+  ompl::base::ScopedState<> start_state(space);
+  ompl::base::ScopedState<> goal_state(space);
+  start_state[0] = start(0);
+  start_state[1] = start(1);
+  goal_state[0] = goal(0);
+  goal_state[1] = goal(1);
+  auto pdef = std::make_shared<ompl::base::ProblemDefinition>(obstacle_si);
+  pdef->setStartAndGoalStates(start_state, goal_state);
+  planner->setProblemDefinition(pdef);
+  planner->solve(5.0);
+  EXPECT_FALSE(hasEdge(*planner, start, goal));
+
+  // The edge is removed from the roadmap and not merged back by a planner created before the update
+  ompl::base::PlannerPtr old_planner = roadmap.createPlanner(si, configurator);
+  roadmap.update(*planner, 2);
+  EXPECT_EQ(roadmap.getRevision(), 2);
+  EXPECT_FALSE(hasEdge(*roadmap.createPlanner(si, configurator), start, goal));
+
+  roadmap.update(*old_planner, 2);
+  EXPECT_FALSE(hasEdge(*roadmap.createPlanner(si, configurator), start, goal));
+
+  // The oldest vertices and their edges are removed once the maximum is exceeded
+  roadmap.setMaxVertexCount(1);
+  EXPECT_EQ(roadmap.getMaxVertexCount(), 1UL);
+  EXPECT_EQ(roadmap.getVertexCount(), 1UL);
+  EXPECT_EQ(roadmap.getEdgeCount(), 0UL);
+#endif
+}
+
 TYPED_TEST(OMPLTestFixture, OMPLFreespaceCartesianGoalPlannerUnit)
 {
   EXPECT_EQ(ompl::RNG::getSeed(), SEED) << "Randomization seed does not match expected: " << ompl::RNG::getSeed()
@@ -119,6 +119,45 @@ TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryTest)
   EXPECT_EQ(profile_check4->a, 20);
 }
 
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionarySnapshotTest)
+{
+  ProfileDictionary profiles;
+  EXPECT_TRUE(profiles.getProfileEntryPtr<ProfileBase>() == nullptr);
+
+  profiles.addProfile<ProfileBase>("key", std::make_shared<ProfileTest>(10));
+  profiles.addProfile<ProfileBase2>("key", std::make_shared<ProfileTest2>(5));
+  auto entry = profiles.getProfileEntryPtr<ProfileBase>();
+  auto entry2 = profiles.getProfileEntryPtr<ProfileBase2>();
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(entry->at("key")->a, 10);
+
+  ProfileDictionary::ConstPtr snapshot = profiles.getSnapshot();
+  EXPECT_EQ(snapshot->getRevision(), profiles.getRevision());
+  EXPECT_EQ(snapshot->getSnapshotId(), profiles.getSnapshotId());
+  EXPECT_EQ(snapshot->getProfileEntryPtr<ProfileBase>(), entry);
+
+  // Updates do not modify the entries already referenced or the snapshot
+  profiles.addProfile<ProfileBase>("key", std::make_shared<ProfileTest>(20));
+  profiles.removeProfile<ProfileBase>("key2");
+  EXPECT_EQ(entry->at("key")->a, 10);
+  EXPECT_EQ(snapshot->getProfile<ProfileBase>("key")->a, 10);
+  EXPECT_EQ(profiles.getProfile<ProfileBase>("key")->a, 20);
+  EXPECT_GT(profiles.getRevision(), snapshot->getRevision());
+  EXPECT_NE(snapshot->getSnapshotId(), profiles.getSnapshotId());
+
+  // Entries which were not updated are shared
+  EXPECT_EQ(profiles.getProfileEntryPtr<ProfileBase2>(), entry2);
+
+  profiles.removeProfileEntry<ProfileBase>();
+  EXPECT_FALSE(profiles.hasProfileEntry<ProfileBase>());
+  EXPECT_TRUE(snapshot->hasProfile<ProfileBase>("key"));
+
+  std::vector<std::type_index> types = profiles.getProfileEntryTypes();
+  ASSERT_EQ(types.size(), 1UL);
+  EXPECT_EQ(types[0], std::type_index(typeid(ProfileBase2)));
+  EXPECT_EQ(snapshot->getProfileEntryTypes().size(), 2UL);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
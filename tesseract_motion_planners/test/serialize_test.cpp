@@ -118,6 +118,9 @@ DescartesDefaultPlanProfile<double> genDescartesPlanProfile()
   DescartesDefaultPlanProfile<double> descartes_profile;
 
   descartes_profile.enable_edge_collision = true;
+  descartes_profile.edge_max_joint_delta = Eigen::VectorXd::Constant(6, 0.25);
+  descartes_profile.edge_reject_config_change = true;
+  descartes_profile.edge_config_sign_correction = Eigen::Vector2i(1, -1);
 
   return descartes_profile;
 }
@@ -189,6 +192,19 @@ TEST(TesseractMotionPlannersDescartesSerializeUnit, SerializeDescartesDefaultPla
   EXPECT_TRUE(
       toXMLFile(imported_plan_profile, tesseract_common::getTempPath() + "descartes_default_plan_example_input2.xml"));
   EXPECT_TRUE(plan_profile.enable_edge_collision == imported_plan_profile.enable_edge_collision);
+  EXPECT_TRUE(plan_profile.edge_max_joint_delta.isApprox(imported_plan_profile.edge_max_joint_delta));
+  EXPECT_TRUE(plan_profile.edge_reject_config_change == imported_plan_profile.edge_reject_config_change);
+  EXPECT_TRUE(plan_profile.edge_config_sign_correction == imported_plan_profile.edge_config_sign_correction);
+
+  // An empty joint delta disables the check
+  DescartesDefaultPlanProfile<double> default_profile;
+  EXPECT_TRUE(
+      toXMLFile(default_profile, tesseract_common::getTempPath() + "descartes_default_plan_example_input3.xml"));
+  DescartesDefaultPlanProfile<double> imported_default_profile =
+      descartesPlanFromXMLFile(tesseract_common::getTempPath() + "descartes_default_plan_example_input3.xml");
+  EXPECT_EQ(imported_default_profile.edge_max_joint_delta.size(), 0);
+  EXPECT_FALSE(imported_default_profile.edge_reject_config_change);
+  EXPECT_TRUE(imported_default_profile.edge_config_sign_correction == Eigen::Vector2i::Ones());
 }
 
 int main(int argc, char** argv)
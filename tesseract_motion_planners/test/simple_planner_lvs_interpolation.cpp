@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_environment/ofkt/ofkt_state_solver.h>
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
 #include <tesseract_motion_planners/simple/step_generators/lvs_interpolation.h>
+#include <tesseract_motion_planners/simple/profile/simple_planner_default_lvs_plan_profile.h>
 
 using namespace tesseract_environment;
 using namespace tesseract_planning;
@@ -546,6 +547,68 @@ TEST_F(TesseractPlanningSimplePlannerLVSInterpolationUnit, InterpolateCartStateW
   /// @todo: Update once implemented
 }
 
+TEST_F(TesseractPlanningSimplePlannerLVSInterpolationUnit, CancelSolveInProgress)  // NOLINT
+{
+  CompositeInstruction program("TEST_PROFILE", CompositeInstructionOrder::ORDERED, manip_info_);
+  JointWaypoint start_wp(joint_names_, Eigen::VectorXd::Zero(7));
+  program.setStartInstruction(PlanInstruction(start_wp, PlanInstructionType::START, "TEST_PROFILE"));
+  for (int i = 1; i <= 3; ++i)
+  {
+    JointWaypoint wp(joint_names_, Eigen::VectorXd::Constant(7, 0.2 * i));
+    program.push_back(PlanInstruction(wp, PlanInstructionType::FREESPACE, "TEST_PROFILE"));
+  }
+
+  PlannerRequest request;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+  request.instructions = program;
+
+  // The profile cancels the solve while the first plan instruction is processed
+  SimpleMotionPlanner planner;
+  std::function<void()> cancel;
+  int calls = 0;
+  auto profile = std::make_shared<SimplePlannerDefaultLVSPlanProfile>();
+  JointJointStepGenerator generator = profile->joint_joint_freespace;
+  profile->joint_joint_freespace = [&](const JointWaypoint& start,
+                                       const JointWaypoint& end,
+                                       const PlanInstruction& base_instruction,
+                                       const PlannerRequest& req,
+                                       const ManipulatorInfo& manip_info) {
+    ++calls;
+    if (cancel)
+      cancel();
+    return generator(start, end, base_instruction, req, manip_info);
+  };
+  planner.plan_profiles["TEST_PROFILE"] = profile;
+
+  // Cancelled through the request token
+  auto token = std::make_shared<CancellationToken>();
+  request.cancellation_token = token;
+  cancel = [token]() { token->cancel(); };
+  PlannerResponse token_response;
+  tesseract_common::StatusCode status = planner.solve(request, token_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), SimpleMotionPlannerStatusCategory::Cancelled);
+  EXPECT_EQ(calls, 1);
+
+  // Cancelled through terminate(), which only affects the solves that are running
+  calls = 0;
+  request.cancellation_token = nullptr;
+  cancel = [&planner]() { planner.terminate(); };
+  PlannerResponse terminate_response;
+  status = planner.solve(request, terminate_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), SimpleMotionPlannerStatusCategory::Cancelled);
+  EXPECT_EQ(calls, 1);
+
+  calls = 0;
+  cancel = nullptr;
+  PlannerResponse response;
+  status = planner.solve(request, response);
+  EXPECT_TRUE(status);
+  EXPECT_EQ(calls, 3);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,177 @@
+/**
+ * @file trajopt_ifopt_planner_tests.cpp
+ * @brief Unit tests for the TrajOpt Ifopt motion planner
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <functional>
+#include <trajopt_sqp/sqp_callback.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+
+#include <tesseract_command_language/plan_instruction.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_motion_planner.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_plan_profile.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_composite_profile.h>
+#include <tesseract_motion_planners/trajopt_ifopt/problem_generators/default_problem_generator.h>
+#include <tesseract_motion_planners/core/utils.h>
+
+using namespace tesseract_environment;
+using namespace tesseract_planning;
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+class TesseractPlanningTrajoptIfoptUnit : public ::testing::Test
+{
+protected:
+  Environment::Ptr env_;
+  ManipulatorInfo manip;
+
+  void SetUp() override
+  {
+    tesseract_scene_graph::ResourceLocator::Ptr locator =
+        std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+    Environment::Ptr env = std::make_shared<Environment>();
+    boost::filesystem::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+    boost::filesystem::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+    EXPECT_TRUE(env->init<OFKTStateSolver>(urdf_path, srdf_path, locator));
+    env_ = env;
+    manip.manipulator = "manipulator";
+  }
+};
+
+/** @brief Calls a function after every SQP iteration, used to act while the solver is running */
+class IterationCallback : public trajopt_sqp::SQPCallback
+{
+public:
+  explicit IterationCallback(std::function<void()> callback) : callback_(std::move(callback)) {}
+
+  bool execute(const ifopt::Problem& /*nlp*/, const trajopt_sqp::SQPResults& /*sqp_results*/) override
+  {
+    callback_();
+    return true;
+  }
+
+private:
+  std::function<void()> callback_;
+};
+
+TEST_F(TesseractPlanningTrajoptIfoptUnit, TrajoptIfoptCancelInProgress)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  const std::vector<std::string>& joint_names = fwd_kin->getJointNames();
+
+  JointWaypoint wp1(joint_names, { 0, 0, 0, -1.57, 0, 0, 0 });
+  JointWaypoint wp2(joint_names, { 0, 0, 0, 1.57, 0, 0, 0 });
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setStartInstruction(PlanInstruction(wp1, PlanInstructionType::START, "TEST_PROFILE"));
+  program.setManipulatorInfo(manip);
+  program.push_back(PlanInstruction(wp2, PlanInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  TrajOptIfoptMotionPlanner test_planner;
+  test_planner.plan_profiles["TEST_PROFILE"] = std::make_shared<TrajOptIfoptDefaultPlanProfile>();
+  test_planner.composite_profiles["TEST_PROFILE"] = std::make_shared<TrajOptIfoptDefaultCompositeProfile>();
+  test_planner.problem_generator = &DefaultTrajoptProblemGenerator;
+
+  // The first SQP iteration cancels the solve, the planner's callback then stops the solver
+  std::function<void()> cancel;
+  int iterations = 0;
+  test_planner.callbacks.push_back(std::make_shared<IterationCallback>([&cancel, &iterations]() {
+    ++iterations;
+    if (cancel)
+      cancel();
+  }));
+
+  PlannerRequest request;
+  request.seed = generateSeed(program, env_->getCurrentState(), env_, 3.14, 1.0, 3.14, 10);
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  // Cancelled through the request token
+  auto token = std::make_shared<CancellationToken>();
+  cancel = [token]() { token->cancel(); };
+  request.cancellation_token = token;
+  PlannerResponse token_response;
+  tesseract_common::StatusCode status = test_planner.solve(request, token_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), TrajOptIfoptMotionPlannerStatusCategory::Cancelled);
+  EXPECT_EQ(iterations, 1);
+
+  // Cancelled through terminate(), a later solve is not affected
+  iterations = 0;
+  request.cancellation_token = nullptr;
+  cancel = [&test_planner]() { test_planner.terminate(); };
+  PlannerResponse terminate_response;
+  status = test_planner.solve(request, terminate_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), TrajOptIfoptMotionPlannerStatusCategory::Cancelled);
+  EXPECT_EQ(iterations, 1);
+
+  cancel = nullptr;
+  PlannerResponse response;
+  status = test_planner.solve(request, response);
+  EXPECT_TRUE(status);
+  EXPECT_GT(iterations, 1);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
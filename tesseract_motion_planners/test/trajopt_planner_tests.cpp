@@ -794,6 +794,67 @@ TEST_F(TesseractPlanningTrajoptUnit, TrajoptArrayJointCost)  // NOLINT
       (tesseract_tests::vectorContainsType<sco::Cost::Ptr, trajopt::TrajOptCostFromErrFunc>(problem->getCosts())));
 }
 
+TEST_F(TesseractPlanningTrajoptUnit, TrajoptCancelInProgress)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver(manip.manipulator);
+  const std::vector<std::string>& joint_names = fwd_kin->getJointNames();
+
+  JointWaypoint wp1(joint_names, { 0, 0, 0, -1.57, 0, 0, 0 });
+  JointWaypoint wp2(joint_names, { 0, 0, 0, 1.57, 0, 0, 0 });
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setStartInstruction(PlanInstruction(wp1, PlanInstructionType::START, "TEST_PROFILE"));
+  program.setManipulatorInfo(manip);
+  program.push_back(PlanInstruction(wp2, PlanInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  TrajOptMotionPlanner test_planner;
+  test_planner.plan_profiles["TEST_PROFILE"] = std::make_shared<TrajOptDefaultPlanProfile>();
+  test_planner.composite_profiles["TEST_PROFILE"] = std::make_shared<TrajOptDefaultCompositeProfile>();
+  test_planner.problem_generator = &DefaultTrajoptProblemGenerator;
+
+  // The first iteration of the optimization cancels the solve
+  std::function<void()> cancel;
+  int iterations = 0;
+  test_planner.callbacks.emplace_back([&cancel, &iterations](sco::OptProb*, sco::OptResults&) {
+    ++iterations;
+    if (cancel)
+      cancel();
+    return true;
+  });
+
+  PlannerRequest request;
+  request.seed = generateSeed(program, env_->getCurrentState(), env_, 3.14, 1.0, 3.14, 10);
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  // Cancelled through the request token, the optimization stops after the iteration
+  auto token = std::make_shared<CancellationToken>();
+  cancel = [token]() { token->cancel(); };
+  request.cancellation_token = token;
+  PlannerResponse token_response;
+  tesseract_common::StatusCode status = test_planner.solve(request, token_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), TrajOptMotionPlannerStatusCategory::Cancelled);
+  EXPECT_GE(iterations, 1);
+
+  // Cancelled through terminate(), a later solve is not affected
+  iterations = 0;
+  request.cancellation_token = nullptr;
+  request.data = nullptr;
+  cancel = [&test_planner]() { test_planner.terminate(); };
+  PlannerResponse terminate_response;
+  status = test_planner.solve(request, terminate_response);
+  EXPECT_FALSE(status);
+  EXPECT_EQ(status.value(), TrajOptMotionPlannerStatusCategory::Cancelled);
+  EXPECT_GE(iterations, 1);
+
+  cancel = nullptr;
+  PlannerResponse response;
+  status = test_planner.solve(request, response);
+  EXPECT_TRUE(status);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -27,13 +27,21 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <atomic>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/core/environment.h>
 #include <tesseract_environment/ofkt/ofkt_state_solver.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+#include <tesseract_motion_planners/core/link_transform_batch.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
+#include <tesseract_motion_planners/core/cpu_budget.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_command_language/plan_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
 
 using namespace tesseract_planning;
 using namespace tesseract_environment;
@@ -122,6 +130,234 @@ TEST_F(TesseractPlanningUtilsUnit, GetProfileStringTest)
   EXPECT_EQ(output_profile, "profile_1_remapped");
 }
 
+static void expectSameContacts(const std::vector<tesseract_collision::ContactResultMap>& expected,
+                               const std::vector<tesseract_collision::ContactResultMap>& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    ASSERT_EQ(expected[i].size(), actual[i].size());
+    auto expected_it = expected[i].begin();
+    auto actual_it = actual[i].begin();
+    for (; expected_it != expected[i].end(); ++expected_it, ++actual_it)
+    {
+      EXPECT_EQ(expected_it->first, actual_it->first);
+      EXPECT_EQ(expected_it->second.size(), actual_it->second.size());
+    }
+  }
+}
+
+TEST_F(TesseractPlanningUtilsUnit, ContactCheckProgramParallelTest)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver("manipulator");
+  std::vector<std::string> joint_names = fwd_kin->getJointNames();
+
+  // Sweep the arm through configurations where links come close to each other
+  CompositeInstruction program;
+  for (int i = 0; i < 50; ++i)
+  {
+    Eigen::VectorXd position = Eigen::VectorXd::Constant(7, -2.0 + 0.08 * i);
+    program.push_back(MoveInstruction(StateWaypoint(joint_names, position), MoveInstructionType::FREESPACE));
+  }
+
+  tesseract_environment::StateSolver::Ptr state_solver = env_->getStateSolver();
+  tesseract_collision::CollisionCheckConfig config;
+  config.longest_valid_segment_length = 0.05;
+  config.collision_margin_data = tesseract_collision::CollisionMarginData(0.1);
+
+  for (auto type : { tesseract_collision::ContactTestType::ALL, tesseract_collision::ContactTestType::FIRST })
+  {
+    config.contact_request.type = type;
+
+    for (auto eval_type : { tesseract_collision::CollisionEvaluatorType::DISCRETE,
+                            tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE })
+    {
+      config.type = eval_type;
+      auto serial_manager = env_->getDiscreteContactManager();
+      serial_manager->setActiveCollisionObjects(fwd_kin->getActiveLinkNames());
+      serial_manager->setCollisionMarginData(config.collision_margin_data);
+      auto parallel_manager = serial_manager->clone();
+
+      std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+      std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+      bool serial_found = contactCheckProgram(serial_contacts, *serial_manager, *state_solver, program, config);
+      bool parallel_found =
+          contactCheckProgram(parallel_contacts, *parallel_manager, *state_solver, program, config, 4);
+      EXPECT_EQ(serial_found, parallel_found);
+      expectSameContacts(serial_contacts, parallel_contacts);
+    }
+
+    for (auto eval_type : { tesseract_collision::CollisionEvaluatorType::CONTINUOUS,
+                            tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS })
+    {
+      config.type = eval_type;
+      auto serial_manager = env_->getContinuousContactManager();
+      serial_manager->setActiveCollisionObjects(fwd_kin->getActiveLinkNames());
+      serial_manager->setCollisionMarginData(config.collision_margin_data);
+      auto parallel_manager = serial_manager->clone();
+
+      std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+      std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+      bool serial_found = contactCheckProgram(serial_contacts, *serial_manager, *state_solver, program, config);
+      bool parallel_found =
+          contactCheckProgram(parallel_contacts, *parallel_manager, *state_solver, program, config, 4);
+      EXPECT_EQ(serial_found, parallel_found);
+      expectSameContacts(serial_contacts, parallel_contacts);
+    }
+  }
+}
+
+TEST_F(TesseractPlanningUtilsUnit, LinkTransformBatchTest)  // NOLINT
+{
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver("manipulator");
+  std::vector<std::string> joint_names = fwd_kin->getJointNames();
+  std::vector<std::string> link_names = fwd_kin->getActiveLinkNames();
+
+  tesseract_environment::StateSolver::Ptr state_solver = env_->getStateSolver();
+  LinkTransformBatch batch(*state_solver, joint_names, link_names);
+  EXPECT_EQ(batch.getJointNames(), joint_names);
+  EXPECT_EQ(batch.getLinkNames(), link_names);
+
+  Eigen::VectorXd start = Eigen::VectorXd::Constant(7, -0.5);
+  Eigen::VectorXd end = Eigen::VectorXd::Constant(7, 0.5);
+  const long count = 5;
+
+  // The buffer is reused between batches, so computing twice must give the same result
+  for (int run = 0; run < 2; ++run)
+  {
+    batch.interpolate(start, end, count);
+    ASSERT_EQ(batch.size(), count);
+    for (long s = 0; s < batch.size(); ++s)
+    {
+      env_->setState(joint_names, batch.states().row(s).transpose());
+      for (std::size_t i = 0; i < link_names.size(); ++i)
+        EXPECT_TRUE(batch.getTransform(s, i).isApprox(env_->getLinkTransform(link_names[i]), 1e-8));
+    }
+  }
+
+  tesseract_common::TrajArray states(2, 7);
+  states.row(0) = end.transpose();
+  states.row(1) = Eigen::VectorXd::Zero(7).transpose();
+  batch.compute(states);
+  ASSERT_EQ(batch.size(), 2);
+  for (long s = 0; s < batch.size(); ++s)
+  {
+    env_->setState(joint_names, states.row(s).transpose());
+    for (std::size_t i = 0; i < link_names.size(); ++i)
+      EXPECT_TRUE(batch.getTransform(s, i).isApprox(env_->getLinkTransform(link_names[i]), 1e-8));
+  }
+
+  EXPECT_ANY_THROW(batch.interpolate(start, end, 1));  // NOLINT
+  EXPECT_ANY_THROW(LinkTransformBatch(*state_solver, joint_names, { "does_not_exist" }));  // NOLINT
+}
+
+TEST_F(TesseractPlanningUtilsUnit, KinematicMetadataCacheTest)  // NOLINT
+{
+  KinematicMetadataCache::clear();
+  auto fwd_kin = env_->getManipulatorManager()->getFwdKinematicSolver("manipulator");
+  auto inv_kin = env_->getManipulatorManager()->getInvKinematicSolver("manipulator");
+
+  KinematicMetadata::ConstPtr metadata = KinematicMetadataCache::get(*env_, *fwd_kin);
+  ASSERT_TRUE(metadata != nullptr);
+  EXPECT_EQ(metadata->manipulator, "manipulator");
+  EXPECT_EQ(metadata->joint_names, fwd_kin->getJointNames());
+  EXPECT_TRUE(metadata->joint_limits.isApprox(fwd_kin->getLimits().joint_limits));
+
+  tesseract_environment::AdjacencyMap map(
+      env_->getSceneGraph(), fwd_kin->getActiveLinkNames(), env_->getCurrentState()->link_transforms);
+  EXPECT_EQ(metadata->active_link_names, map.getActiveLinkNames());
+
+  // The metadata is shared by the kinematics of the manipulator
+  EXPECT_EQ(KinematicMetadataCache::get(*env_, *fwd_kin), metadata);
+  EXPECT_EQ(KinematicMetadataCache::get(*env_, *inv_kin), metadata);
+  EXPECT_EQ(KinematicMetadataCache::size(), 1UL);
+
+  // A clone of the environment has its own entry
+  {
+    Environment::Ptr clone = env_->clone();
+    KinematicMetadata::ConstPtr clone_metadata = KinematicMetadataCache::get(*clone, *fwd_kin);
+    EXPECT_NE(clone_metadata, metadata);
+    EXPECT_EQ(clone_metadata->active_link_names, metadata->active_link_names);
+    EXPECT_EQ(KinematicMetadataCache::size(), 2UL);
+  }
+  KinematicMetadataCache::clear();
+  EXPECT_EQ(KinematicMetadataCache::size(), 0UL);
+}
+
+TEST(TesseractPlanningThreadLocalCacheUnit, GetPerThread)  // NOLINT
+{
+  std::atomic<int> created{ 0 };
+  ThreadLocalCache<int> cache([&created]() { return std::make_shared<int>(created++); });
+
+  // The same thread always gets the same instance
+  int& main_instance = cache.get();
+  EXPECT_EQ(&main_instance, &cache.get());
+  EXPECT_EQ(cache.size(), 1UL);
+
+  std::vector<int*> thread_instances(4, nullptr);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < thread_instances.size(); ++i)
+    threads.emplace_back([&cache, &thread_instances, i]() {
+      thread_instances[i] = &cache.get();
+      EXPECT_EQ(thread_instances[i], &cache.get());
+    });
+
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(created.load(), 5);
+  EXPECT_EQ(cache.size(), 5UL);
+  for (const auto* instance : thread_instances)
+    EXPECT_NE(instance, &main_instance);
+
+  // A new cache never reuses the instances of another cache
+  ThreadLocalCache<int> other_cache([]() { return std::make_shared<int>(-1); });
+  EXPECT_NE(&main_instance, &other_cache.get());
+  EXPECT_EQ(other_cache.get(), -1);
+}
+
+TEST(TesseractPlanningCPUBudgetUnit, BorrowAndRelease)  // NOLINT
+{
+  CPUBudget budget(4);
+  EXPECT_EQ(budget.getCapacity(), 4UL);
+  EXPECT_EQ(budget.getUsed(), 0UL);
+
+  // Workers counted with acquire reduce what may be borrowed
+  budget.acquire(1);
+  {
+    CPUBudget::Lease lease = budget.borrow(5);
+    EXPECT_EQ(lease.size(), 3UL);
+    EXPECT_EQ(budget.getUsed(), 4UL);
+
+    // Nothing is granted while the budget is exhausted
+    CPUBudget::Lease empty = budget.borrow(2);
+    EXPECT_EQ(empty.size(), 0UL);
+
+    // Moving a lease does not return its threads
+    CPUBudget::Lease moved = std::move(lease);
+    EXPECT_EQ(moved.size(), 3UL);
+    EXPECT_EQ(budget.getUsed(), 4UL);
+  }
+  EXPECT_EQ(budget.getUsed(), 1UL);
+
+  // Acquire may exceed the capacity, nothing is borrowed until enough threads are released
+  budget.acquire(4);
+  EXPECT_EQ(budget.getUsed(), 5UL);
+  EXPECT_EQ(budget.borrow(1).size(), 0UL);
+  budget.release(5);
+  EXPECT_EQ(budget.getUsed(), 0UL);
+
+  CPUBudget::Lease lease = budget.borrow(2);
+  EXPECT_EQ(lease.size(), 2UL);
+  lease.release();
+  EXPECT_EQ(lease.size(), 0UL);
+  EXPECT_EQ(budget.getUsed(), 0UL);
+
+  // The capacity is at least one
+  budget.setCapacity(0);
+  EXPECT_EQ(budget.getCapacity(), 1UL);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,127 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/util/RandomNumbers.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+#include <tesseract_process_managers/core/process_planning_server.h>
+#include <tesseract_process_managers/core/request_bundle.h>
+
+using namespace tesseract_planning;
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+/**
+ * @brief Replay a request bundle written by a RequestRecorder and print the time of each run
+ * @details The environment is loaded from the URDF and SRDF the recorded process used, and set to the recorded
+ * state. The OMPL seed is set to the recorded seed before anything else, so runs of this program replaying a bundle
+ * draw the same random numbers, as long as the planners use a single thread. These are not the random numbers drawn by
+ * the recorded request, which depend on the generators its process created before it, so a replay of a request using
+ * OMPL is not guaranteed to plan the same path.
+ *
+ * Usage: request_replay <bundle> <urdf> <srdf> [runs] [threads]
+ */
+int main(int argc, char** argv)
+{
+  if (argc < 4)
+  {
+    std::cerr << "Usage: " << argv[0] << " <bundle> <urdf> <srdf> [runs] [threads]" << std::endl;
+    return 1;
+  }
+
+  RequestBundle bundle;
+  if (!loadRequestBundle(bundle, argv[1]))
+    return 1;
+
+  // This must happen before the first OMPL random number generator is created, it makes the replays repeatable but
+  // does not reproduce the random numbers of the recorded request
+  ompl::RNG::setSeed(bundle.ompl_seed);
+
+  const int runs = (argc > 4) ? std::max(std::atoi(argv[4]), 1) : 1;
+  const std::size_t threads = (argc > 5) ? static_cast<std::size_t>(std::max(std::atoi(argv[5]), 1)) : 1;
+
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  auto env = std::make_shared<tesseract_environment::Environment>();
+  if (!env->init<tesseract_environment::OFKTStateSolver>(
+          boost::filesystem::path(argv[2]), boost::filesystem::path(argv[3]), locator))
+  {
+    std::cerr << "Failed to load the environment" << std::endl;
+    return 1;
+  }
+
+  if (env->getSceneGraph()->getName() != bundle.scene_graph_name)
+  {
+    std::cerr << "The environment '" << env->getSceneGraph()->getName() << "' does not match the recorded environment '"
+              << bundle.scene_graph_name << "'" << std::endl;
+    return 1;
+  }
+
+  if (env->getRevision() != bundle.environment_revision)
+    std::cerr << "Warning: The environment revision " << env->getRevision() << " does not match the recorded revision "
+              << bundle.environment_revision << ", commands applied by the recorded process are missing" << std::endl;
+
+  if (bundle.command_count > 0)
+    std::cerr << "Warning: The " << bundle.command_count << " commands of the request were not recorded" << std::endl;
+
+  env->setState(bundle.environment_state);
+
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env), threads);
+  planning_server.loadDefaultProcessPlanners();
+  if (!addRequestBundleProfiles(*planning_server.getProfiles(), bundle))
+    return 1;
+
+  std::cout << "Replaying " << bundle.request.name << " recorded taking " << bundle.duration << " s ("
+            << (bundle.successful ? "successful" : "failed") << ")" << std::endl;
+
+  std::vector<double> durations;
+  for (int i = 0; i < runs; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    ProcessPlanningFuture response = planning_server.run(bundle.request);
+    response.wait();
+    durations.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    std::cout << "Run " << i << ": " << durations.back() << " s ("
+              << (response.interface->isSuccessful() ? "successful" : "failed") << ")" << std::endl;
+  }
+
+  std::sort(durations.begin(), durations.end());
+  const double mean =
+      std::accumulate(durations.begin(), durations.end(), 0.0) / static_cast<double>(durations.size());
+  std::cout << "Min: " << durations.front() << " s, Median: " << durations[durations.size() / 2] << " s, Mean: " << mean
+            << " s, Max: " << durations.back() << " s" << std::endl;
+
+  return 0;
+}
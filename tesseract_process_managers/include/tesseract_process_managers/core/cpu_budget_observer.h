@@ -0,0 +1,68 @@
+/**
+ * @file cpu_budget_observer.h
+ * @brief A Taskflow observer which counts the busy workers against a CPU budget
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_CPU_BUDGET_OBSERVER_H
+#define TESSERACT_PROCESS_MANAGERS_CPU_BUDGET_OBSERVER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <taskflow/taskflow.hpp>
+#include <memory>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/cpu_budget.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Counts each worker of an executor against a CPU budget while it runs a task
+ * @details The planners run by the tasks borrow their additional threads from the same budget, so they fall back to
+ * fewer threads while the executor is busy instead of oversubscribing the cores.
+ */
+class CPUBudgetObserver : public tf::ObserverInterface
+{
+public:
+  using Ptr = std::shared_ptr<CPUBudgetObserver>;
+  using ConstPtr = std::shared_ptr<const CPUBudgetObserver>;
+
+  /**
+   * @brief Constructor
+   * @param budget The budget the workers are counted against, it must outlive the observer
+   */
+  CPUBudgetObserver(CPUBudget& budget = CPUBudget::getGlobal());
+
+  void set_up(size_t num_workers) final;
+
+  void on_entry(size_t w, tf::TaskView tv) final;
+
+  void on_exit(size_t w, tf::TaskView tv) final;
+
+private:
+  CPUBudget& budget_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_CPU_BUDGET_OBSERVER_H
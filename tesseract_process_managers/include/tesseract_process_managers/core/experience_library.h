@@ -0,0 +1,180 @@
+/**
+ * @file experience_library.h
+ * @brief A library of previously planned trajectories used to seed new requests
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_EXPERIENCE_LIBRARY_H
+#define TESSERACT_PROCESS_MANAGERS_EXPERIENCE_LIBRARY_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_command_language/composite_instruction.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::ExperienceLibrary)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/** @brief A trajectory which was successfully planned for a manipulator */
+struct Experience
+{
+  /** @brief The name of the manipulator */
+  std::string manipulator;
+
+  /** @brief The joint names of the trajectory columns */
+  std::vector<std::string> joint_names;
+
+  /** @brief The environment revision the trajectory was planned with */
+  int revision{ -1 };
+
+  /** @brief The joint states of the trajectory, the first row is the start and the last row is the goal */
+  tesseract_common::TrajArray trajectory;
+};
+
+/**
+ * @brief A threadsafe library of experiences indexed by manipulator, start state, goal state and environment revision
+ * @details Repeated motions like raster transitions have nearly identical start and goal states, so a previously
+ * planned trajectory is usually a valid path for a new request after adjusting its end points. The experience used
+ * is the nearest one by the largest joint difference of its start and goal, preferring experiences planned with the
+ * same environment revision. The trajectory is not guaranteed to be collision free for the new request and must be
+ * revalidated by the caller.
+ *
+ * If a file path is provided the library is loaded from it on construction and each added experience is appended
+ * to it. The file is plain text with one experience per line, names containing whitespace are quoted. Replaced and
+ * removed experiences stay in the file until it is compacted, which happens on construction and when the file has
+ * more than twice the maximum number of experiences. Lookups are never blocked by writing the file.
+ */
+class ExperienceLibrary
+{
+public:
+  using Ptr = std::shared_ptr<ExperienceLibrary>;
+  using ConstPtr = std::shared_ptr<const ExperienceLibrary>;
+
+  /**
+   * @brief Constructor
+   * @param file_path The file the library is loaded from and written to, empty to only keep it in memory
+   * @param max_experiences The maximum number of experiences, if exceeded the oldest experience is removed
+   */
+  ExperienceLibrary(std::string file_path = "", std::size_t max_experiences = 1000);
+
+  /**
+   * @brief Add an experience, replacing an experience of the manipulator with the same start and goal
+   * @param experience The experience, the trajectory requires at least two states
+   * @return True if the experience was added, false if it is invalid
+   */
+  bool add(Experience experience);
+
+  /**
+   * @brief Find the nearest experience of a manipulator
+   * @param experience The nearest experience if found
+   * @param manipulator The name of the manipulator
+   * @param joint_names The joint names of the start and goal states
+   * @param start The start state
+   * @param goal The goal state
+   * @param revision The current environment revision
+   * @param tolerance The maximum difference of any joint in the start and goal states
+   * @return True if an experience was found within the tolerance, otherwise false
+   */
+  bool lookup(Experience& experience,
+              const std::string& manipulator,
+              const std::vector<std::string>& joint_names,
+              const Eigen::Ref<const Eigen::VectorXd>& start,
+              const Eigen::Ref<const Eigen::VectorXd>& goal,
+              int revision,
+              double tolerance) const;
+
+  /** @brief The number of experiences */
+  std::size_t size() const;
+
+  /** @brief Remove all experiences, the file is not modified */
+  void clear();
+
+  /**
+   * @brief Write all experiences to a file, replacing its content
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  bool save(const std::string& file_path) const;
+
+  /**
+   * @brief Add the experiences stored in a file
+   * @details Invalid lines are skipped
+   * @param file_path The file path
+   * @return True if the file could be read, otherwise false
+   */
+  bool load(const std::string& file_path);
+
+  /** @brief The file the library is written to, empty if it is only kept in memory */
+  const std::string& getFilePath() const;
+
+protected:
+  std::string file_path_;
+  std::size_t max_experiences_;
+
+  /** @brief The experiences, the oldest first */
+  std::deque<Experience> experiences_;
+
+  /** @brief The mutex used when reading and writing to experiences_ */
+  mutable std::shared_mutex mutex_;
+
+  /** @brief The number of lines of the file */
+  std::size_t file_lines_{ 0 };
+
+  /** @brief The mutex used when writing to the file and file_lines_, it is locked before mutex_ */
+  std::mutex file_mutex_;
+
+  /** @brief Copy the experiences */
+  std::deque<Experience> snapshot() const;
+
+  /** @brief Replace the content of the file with the current experiences, the caller must hold file_mutex_ */
+  void compact();
+
+  /** @brief Add an experience, the caller must hold a unique lock */
+  void addExperience(Experience experience);
+};
+
+/**
+ * @brief Get the start state of a single segment program
+ * @param start The start state
+ * @param results The results of the program
+ * @param start_instruction The start instruction provided by the parent program, used if the results have none
+ * @return True if the start is a joint or state waypoint, otherwise false
+ */
+bool getExperienceStart(Eigen::VectorXd& start,
+                        const CompositeInstruction& results,
+                        const Instruction& start_instruction);
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_EXPERIENCE_LIBRARY_H
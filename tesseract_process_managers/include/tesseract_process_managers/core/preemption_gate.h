@@ -0,0 +1,117 @@
+/**
+ * @file preemption_gate.h
+ * @brief Hold back the sub-taskflows of a process while it is preempted
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_PREEMPTION_GATE_H
+#define TESSERACT_PROCESS_MANAGERS_PREEMPTION_GATE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <future>
+#include <memory>
+#include <mutex>
+#include <taskflow/taskflow.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::PreemptionGate)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe gate holding back the sub-taskflows of a process at their module boundaries while it is
+ * preempted
+ * @details The raster process planners add the gate of their process in front of each sub-taskflow (raster,
+ * transition, from_start and to_end). The RequestQueue closes the gate of a preemptible request while requests of a
+ * higher priority are in flight and opens it once they finished.
+ *
+ * A sub-taskflow reaching a closed gate is parked on a semaphore, so it does not occupy a worker of the executor, and
+ * the workers run the higher priority requests instead. Opening the gate runs a task releasing the semaphore once for
+ * each parked sub-taskflow. Sub-taskflows which already passed the gate are not paused.
+ */
+class PreemptionGate : public std::enable_shared_from_this<PreemptionGate>
+{
+public:
+  using Ptr = std::shared_ptr<PreemptionGate>;
+  using ConstPtr = std::shared_ptr<const PreemptionGate>;
+
+  PreemptionGate();
+  ~PreemptionGate() = default;
+  PreemptionGate(const PreemptionGate&) = delete;
+  PreemptionGate& operator=(const PreemptionGate&) = delete;
+  PreemptionGate(PreemptionGate&&) = delete;
+  PreemptionGate& operator=(PreemptionGate&&) = delete;
+
+#ifndef SWIG
+  /**
+   * @brief Add the gate in front of a sub-taskflow
+   * @details This adds a condition task to the taskflow which either runs the input task or, if the gate is closed,
+   * parks it until the gate is opened. The input task must not have any other predecessors.
+   * @note This must be owned by a shared pointer, the tasks keep the gate alive
+   * @param taskflow The sub-taskflow
+   * @param input The input task of the sub-taskflow
+   */
+  void add(tf::Taskflow& taskflow, tf::Task input);
+
+  /**
+   * @brief Open the gate and resume the parked sub-taskflows
+   * @param executor The executor running the process
+   * @return The future which is ready once the parked sub-taskflows were resumed, invalid if none were parked
+   */
+  std::shared_future<void> open(tf::Executor& executor);
+#endif  // SWIG
+
+  /** @brief Close the gate, the sub-taskflows reaching it are parked until it is opened */
+  void close();
+
+  /** @brief Check if the gate is closed */
+  bool isClosed() const;
+
+  /** @brief Get the number of sub-taskflows parked at the gate */
+  std::size_t getParked() const;
+
+protected:
+  /** @brief Set while the gate is closed */
+  bool closed_{ false };
+
+  /** @brief The number of sub-taskflows parked since the gate was closed */
+  std::size_t parked_{ 0 };
+
+  /** @brief The mutex used when reading and writing the members above */
+  mutable std::mutex mutex_;
+
+  /** @brief The parked sub-taskflows each wait for a unit, there are none while no sub-taskflow is resumed */
+  tf::Semaphore semaphore_{ 0 };
+
+  /** @brief Releases one unit of the semaphore each time it is run */
+  tf::Taskflow resume_;
+
+  /** @brief Check if the gate is closed, counting the calling sub-taskflow as parked if so */
+  bool park();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_PREEMPTION_GATE_H
@@ -29,9 +29,11 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
+#include <deque>
 #include <thread>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/core/environment.h>
@@ -71,15 +73,40 @@ public:
    * @details This will first call refreshCache to ensure it has an updated tesseract then proceed
    */
   virtual tesseract_environment::Environment::Ptr getCachedEnvironment() = 0;
+
+  /**
+   * @brief Get the environment the cache is created from
+   * @return The source environment, nullptr if it is not known
+   */
+  virtual tesseract_environment::Environment::ConstPtr getEnvironment() const { return nullptr; }
 };
 
-class ProcessEnvironmentCache : public EnvironmentCache
+/**
+ * @brief An environment cache which leases pooled environments and takes them back once released
+ * @details The environment returned by getCachedEnvironment() is handed back to the pool when the last reference to
+ * it is released (i.e. when the ProcessPlanningFuture is cleared or destroyed). Leased environments which had
+ * commands applied are discarded instead of being returned.
+ *
+ * When the source environment revision changes, a pooled environment is brought up to date when it is leased by
+ * applying only the commands added since its revision instead of being cloned again. The commands are applied after
+ * it was removed from the pool, so leasing is never blocked by them. A background thread keeps the pool filled so
+ * requests do not have to wait on a clone.
+ *
+ * @note To take back leased environments this must be owned by a shared pointer, otherwise they are simply deleted.
+ */
+class ProcessEnvironmentCache : public EnvironmentCache,
+                                public std::enable_shared_from_this<ProcessEnvironmentCache>
 {
 public:
   using Ptr = std::shared_ptr<ProcessEnvironmentCache>;
   using ConstPtr = std::shared_ptr<const ProcessEnvironmentCache>;
 
   ProcessEnvironmentCache(tesseract_environment::Environment::ConstPtr env, std::size_t cache_size = 5);
+  ~ProcessEnvironmentCache() override;
+  ProcessEnvironmentCache(const ProcessEnvironmentCache&) = delete;
+  ProcessEnvironmentCache& operator=(const ProcessEnvironmentCache&) = delete;
+  ProcessEnvironmentCache(ProcessEnvironmentCache&&) = delete;
+  ProcessEnvironmentCache& operator=(ProcessEnvironmentCache&&) = delete;
 
   /**
    * @brief Set the cache size used to hold tesseract objects for motion planning
@@ -93,22 +120,30 @@ public:
    */
   long getCacheSize() const override;
 
-  /** @brief If the environment has changed it will rebuild the cache of tesseract objects */
+  /**
+   * @brief Fill the cache with clones of the source environment
+   * @details Cached environments of an older revision are kept, they are updated when leased
+   */
   void refreshCache() override;
 
   /**
    * @brief This will pop an Environment object from the queue
-   * @details This will first call refreshCache to ensure it has an updated tesseract then proceed
+   * @details The most recently returned environment is leased and updated to the current revision. If the cache is
+   * empty or the update fails a clone is made. A background refill is triggered afterwards.
+   * @return An environment which is returned to the cache once all references are released
    */
   tesseract_environment::Environment::Ptr getCachedEnvironment() override;
 
+  /**
+   * @brief Get the environment the cache is created from
+   * @return The source environment
+   */
+  tesseract_environment::Environment::ConstPtr getEnvironment() const override;
+
 protected:
   /** @brief The tesseract_object used to create the cache */
   tesseract_environment::Environment::ConstPtr env_;
 
-  /** @brief The environment revision number at the time the cache was populated */
-  int cache_env_revision_{ 0 };
-
   /** @brief The assigned cache size */
   std::size_t cache_size_{ 5 };
 
@@ -117,6 +152,39 @@ protected:
 
   /** @brief The mutex used when reading and writing to cache_ */
   mutable std::shared_mutex cache_mutex_;
+
+  /** @brief Used to wake up the refill thread */
+  std::condition_variable_any refill_cv_;
+
+  /** @brief Indicate that the refill thread should refresh the cache */
+  bool refill_requested_{ true };
+
+  /** @brief Indicate that the refill thread should exit */
+  bool refill_stop_{ false };
+
+  /** @brief The thread used to keep the cache filled */
+  std::thread refill_thread_;
+
+  /**
+   * @brief Bring an environment up to the source revision by applying the missing commands
+   * @details The environment must not be in the cache, so this is called without holding cache_mutex_
+   * @param env The environment
+   * @return True if the environment is at the source revision, false if it could not be updated
+   */
+  bool updateEnvironment(tesseract_environment::Environment& env) const;
+
+  /**
+   * @brief Return a leased environment to the cache
+   * @param env The environment being returned
+   * @param lease_revision The revision of the environment when it was leased
+   */
+  void returnCachedEnvironment(tesseract_environment::Environment::Ptr env, int lease_revision);
+
+  /** @brief Wake up the refill thread */
+  void requestRefill();
+
+  /** @brief The function run by the refill thread */
+  void refillLoop();
 };
 }  // namespace tesseract_planning
 #endif  // TESSERACT_PROCESS_MANAGERS_PROCESS_ENVIRONMENT_CACHE_H
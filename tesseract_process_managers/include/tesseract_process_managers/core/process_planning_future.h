@@ -35,6 +35,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/taskflow_interface.h>
 #include <tesseract_process_managers/core/taskflow_generator.h>
+#include <tesseract_process_managers/core/taskflow_cache.h>
+#include <tesseract_process_managers/core/taskflow_metrics_observer.h>
 
 #include <tesseract_motion_planners/core/types.h>
 
@@ -53,6 +55,14 @@ namespace tesseract_planning
  */
 struct ProcessPlanningFuture
 {
+#ifndef SWIG
+  /**
+   * @brief The cached taskflow leased for the process, if taskflow caching is enabled
+   * @details This is returned to the cache when cleared or destroyed. It is declared first so it is released last.
+   */
+  CachedTaskflow::Ptr cached_taskflow;
+#endif  // SWIG
+
 #ifdef SWIG
   %ignore process_future;
 #endif  // SWIG
@@ -62,21 +72,24 @@ struct ProcessPlanningFuture
   /** @brief This is used to abort the associated process and check if the process was successful */
   TaskflowInterface::Ptr interface;
 
+  /** @brief The timing of each task of the process, only recorded if ProcessPlanningRequest::profile is enabled */
+  ProcessMetrics::Ptr metrics;
+
 #ifndef SWIG
   /** @brief The stored input to the process */
-  std::unique_ptr<Instruction> input;
+  std::shared_ptr<Instruction> input;
 
   /** @brief The results to the process */
-  std::unique_ptr<Instruction> results;
+  std::shared_ptr<Instruction> results;
 
   /** @brief The stored global manipulator info */
-  std::unique_ptr<const ManipulatorInfo> global_manip_info;
+  std::shared_ptr<const ManipulatorInfo> global_manip_info;
 
   /** @brief The stored plan profile remapping */
-  std::unique_ptr<const PlannerProfileRemapping> plan_profile_remapping;
+  std::shared_ptr<const PlannerProfileRemapping> plan_profile_remapping;
 
   /** @brief The stored composite profile remapping */
-  std::unique_ptr<const PlannerProfileRemapping> composite_profile_remapping;
+  std::shared_ptr<const PlannerProfileRemapping> composite_profile_remapping;
 
 #else
   // clang-format off
@@ -93,10 +106,18 @@ struct ProcessPlanningFuture
 #ifdef SWIG
   %ignore taskflow_container;
 #endif  // SWIG
-  /** @brief The taskflow container returned from the TaskflowGenerator that must remain during taskflow execution */
+  /**
+   * @brief The taskflow container returned from the TaskflowGenerator that must remain during taskflow execution
+   * @details If the taskflow is leased from the taskflow cache this is empty and the taskflow is stored in
+   * cached_taskflow
+   */
   TaskflowContainer taskflow_container;
 
-  /** @brief Clear all content */
+  /**
+   * @brief Clear all content
+   * @details This releases the taskflow which returns the leased environment to the environment cache and the leased
+   * taskflow to the taskflow cache
+   */
   void clear();
 
   /**
@@ -131,6 +152,25 @@ struct ProcessPlanningFuture
    * @return The future status
    */
   std::future_status waitUntil(const std::chrono::time_point<std::chrono::high_resolution_clock>& abs) const;
+
+#ifndef SWIG
+  /**
+   * @brief Subscribe to the segments of the results (from_start, rasters and transitions) as they complete
+   * @details Each segment is passed in program order once it and every segment before it were planned, validated and
+   * time parameterized, so execution can start while the remaining segments are planned. The segments completed before
+   * subscribing are passed immediately. The callback is called from the threads of the executor, see SegmentStream.
+   * Only the raster process planners stream their segments.
+   * @param callback The callback
+   * @return The id used to unsubscribe
+   */
+  std::size_t subscribe(SegmentStream::Callback callback) const;
+
+  /**
+   * @brief Unsubscribe from the segments of the results
+   * @param id The id returned by subscribe
+   */
+  void unsubscribe(std::size_t id) const;
+#endif  // SWIG
 };
 }  // namespace tesseract_planning
 
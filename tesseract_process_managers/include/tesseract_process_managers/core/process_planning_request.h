@@ -43,6 +43,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+/** @brief The priority classes of process planning requests, see RequestQueue */
+enum class ProcessPlanningPriority
+{
+  LOW = 0,
+  NORMAL = 1,
+  HIGH = 2
+};
+
 struct ProcessPlanningRequest
 {
   /** @brief The name of the Process Pipeline (aka. Taskflow) to use */
@@ -60,7 +68,7 @@ struct ProcessPlanningRequest
   /** @brief Additional Commands to be applied to environment prior to planning (Optional) */
   tesseract_environment::Commands commands;
 
-  /** @brief Enable profiling of the planning request (Optional) */
+  /** @brief Enable profiling of the planning request, the timing of each task is stored in the future (Optional) */
   bool profile{ false };
 
   /**
@@ -74,6 +82,27 @@ struct ProcessPlanningRequest
    * for a given motion planner. (Optional)
    */
   PlannerProfileRemapping composite_profile_remapping;
+
+  /**
+   * @brief The wall clock budget for the request in seconds, zero for no limit (Optional)
+   * @details The planners running when the budget is exhausted shorten their planning time to return by the deadline
+   * and the tasks that have not started are skipped. The results hold whatever was planned by then and
+   * TaskflowInterface::isTimedOut() returns true.
+   */
+  double timeout{ 0 };
+
+  /**
+   * @brief The priority class of the request (Optional)
+   * @details Queued requests are started in order of priority, see ProcessPlanningServer::getRequestQueue()
+   */
+  ProcessPlanningPriority priority{ ProcessPlanningPriority::NORMAL };
+
+  /**
+   * @brief Hold the request while requests of a higher priority are running (Optional)
+   * @details A request which already started finishes the sub-taskflows it started, but the sub-taskflows of the raster
+   * process planners which have not started wait, see PreemptionGate
+   */
+  bool preemptible{ true };
 };
 
 namespace process_planner_names
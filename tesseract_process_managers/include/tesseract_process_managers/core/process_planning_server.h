@@ -36,9 +36,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/core/profile_dictionary.h>
 
 #include <tesseract_process_managers/core/process_environment_cache.h>
+#include <tesseract_process_managers/core/taskflow_cache.h>
 #include <tesseract_process_managers/core/taskflow_generator.h>
 #include <tesseract_process_managers/core/process_planning_request.h>
 #include <tesseract_process_managers/core/process_planning_future.h>
+#include <tesseract_process_managers/core/taskflow_metrics_observer.h>
+#include <tesseract_process_managers/core/cpu_budget_observer.h>
+#include <tesseract_process_managers/core/request_queue.h>
+#include <tesseract_process_managers/core/result_cache.h>
+#include <tesseract_process_managers/core/request_bundle.h>
 
 #ifdef SWIG
 %shared_ptr(tesseract_planning::ProcessPlanningServer)
@@ -116,14 +122,28 @@ public:
 #ifndef SWIG
   /**
    * @brief Execute a process planning request.
-   * @details This does not block to allow for multiple requests, use future to wait if needed.
+   * @details This does not block to allow for multiple requests, use future to wait if needed. The request is started
+   * by the request queue according to its priority, this blocks while the queue is full (see getRequestQueue()).
    * @param request The process planning request to execute
    * @return A process planning future to get results and monitor the execution along with the ability to abort
    */
   ProcessPlanningFuture run(const ProcessPlanningRequest& request);
 
+  /**
+   * @brief Execute a batch of process planning requests
+   * @details All programs are formatted before any request is started. The requests without an environment state or
+   * commands share one environment snapshot and the batch is run as a single taskflow admitted as one request, with the
+   * highest priority of its requests. Each request keeps its own interface, so aborting one does not abort the others.
+   * A request which is invalid has no interface and must not be waited on. Requests whose results are cached are
+   * returned completed.
+   * @param requests The process planning requests
+   * @return A process planning future for each request
+   */
+  std::vector<ProcessPlanningFuture> runBatch(const std::vector<ProcessPlanningRequest>& requests);
+
   /**
    * @brief This is a utility function to run arbitrary taskflows
+   * @details The taskflow is run immediately without passing through the request queue
    * @param taskflow the taskflow to execute
    * @return A future to monitor progress
    */
@@ -143,6 +163,73 @@ public:
   /** @brief Wait for all process currently being executed to finish before returning */
   void waitForAll();
 
+  /**
+   * @brief Set the number of generated taskflows kept for reuse
+   * @details Requests using the same process planner, program structure (composite tree shape and profile names),
+   * environment revision and profiles reuse a previously generated taskflow instead of generating a new one. A
+   * taskflow is returned to the cache when the ProcessPlanningFuture is cleared or destroyed. Requests with commands
+   * are never cached.
+   * @param size The maximum number of cached taskflows, zero disables caching (Default)
+   */
+  void setTaskflowCacheSize(std::size_t size);
+
+  /**
+   * @brief Get the number of generated taskflows kept for reuse
+   * @return The maximum number of cached taskflows
+   */
+  std::size_t getTaskflowCacheSize() const;
+
+  /**
+   * @brief Get the timing of every task run by the executor
+   * @details The timing of the tasks of a single request is available from ProcessPlanningFuture::metrics if
+   * ProcessPlanningRequest::profile is enabled
+   * @return The observer holding the histograms of the task timing by task name
+   */
+  TaskflowMetricsObserver::ConstPtr getTaskflowMetrics() const;
+
+  /**
+   * @brief Set the cache of the results of successful requests
+   * @details A request with the same process planner, program, seed, profile remappings, profiles and environment as
+   * a previous successful request returns a copy of its results with a future which is already ready, without running
+   * any task. Requests with commands are never cached. This must not be called while requests are being submitted.
+   * @param cache The result cache, nullptr disables result caching (Default)
+   */
+  void setResultCache(ResultCache::Ptr cache);
+
+  /**
+   * @brief Get the cache of the results of successful requests
+   * @return The result cache, nullptr if result caching is disabled
+   */
+  ResultCache::Ptr getResultCache() const;
+
+  /**
+   * @brief Set the recorder of the bundles of finished requests, so they can be replayed offline
+   * @details Each request is captured before it is planned, see captureRequestBundle, and passed to the recorder once
+   * it finished. Requests returning cached results are not recorded. This must not be called while requests are being
+   * submitted.
+   * @param recorder The request recorder, nullptr disables recording (Default)
+   */
+  void setRequestRecorder(RequestRecorder::Ptr recorder);
+
+  /**
+   * @brief Get the recorder of the bundles of finished requests
+   * @return The request recorder, nullptr if recording is disabled
+   */
+  RequestRecorder::Ptr getRequestRecorder() const;
+
+  /**
+   * @brief Get the queue which starts the requests in order of priority
+   * @details It is used to limit the number of requests in flight and queued, and to monitor the queue depth
+   * @return The request queue
+   */
+  RequestQueue::Ptr getRequestQueue();
+
+  /**
+   * @brief Get the queue which starts the requests in order of priority (const)
+   * @return The request queue (const)
+   */
+  RequestQueue::ConstPtr getRequestQueue() const;
+
   /** @brief This add a Taskflow profiling observer to the executor */
   void enableTaskflowProfiling();
 
@@ -163,11 +250,44 @@ public:
 
 protected:
   EnvironmentCache::Ptr cache_;
+  TaskflowCache::Ptr taskflow_cache_{ std::make_shared<TaskflowCache>() };
   std::shared_ptr<tf::Executor> executor_;
   std::shared_ptr<tf::TFProfObserver> profile_observer_;
+  std::shared_ptr<TaskflowMetricsObserver> metrics_observer_;
+
+  /** @brief Counts the busy workers against CPUBudget::getGlobal() used by the planners */
+  std::shared_ptr<CPUBudgetObserver> budget_observer_;
+
+  /** @brief Starts the requests on the executor */
+  RequestQueue::Ptr request_queue_;
+
+  /** @brief The results of successful requests, nullptr if disabled */
+  ResultCache::Ptr result_cache_;
+
+  /** @brief Writes the bundles of finished requests, nullptr if disabled */
+  RequestRecorder::Ptr request_recorder_;
 
   std::unordered_map<std::string, TaskflowGenerator::UPtr> process_planners_;
   ProfileDictionary::Ptr profiles_{ std::make_shared<ProfileDictionary>() };
+
+#ifndef SWIG
+  /**
+   * @brief Format a request and generate or lease its taskflow without running it
+   * @details If the results of the request are cached the response is completed and no taskflow is returned
+   * @param response The response of the request
+   * @param on_finished Set to the callback which must be called once the taskflow finished, if one is required
+   * @param request The request
+   * @param env The environment shared with other requests, only allowed without an environment state or commands.
+   * If nullptr one is leased from the environment cache.
+   * @param profiles The profiles used by the request
+   * @return The taskflow of the request, nullptr if the request is invalid or its results were cached
+   */
+  tf::Taskflow* prepareRequest(ProcessPlanningFuture& response,
+                               std::function<void()>& on_finished,
+                               const ProcessPlanningRequest& request,
+                               tesseract_environment::Environment::Ptr env,
+                               const ProfileDictionary::ConstPtr& profiles);
+#endif  // SWIG
 };
 
 }  // namespace tesseract_planning
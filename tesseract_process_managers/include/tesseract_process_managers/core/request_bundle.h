@@ -0,0 +1,189 @@
+/**
+ * @file request_bundle.h
+ * @brief Capture a process planning request so it can be replayed offline
+ *
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_REQUEST_BUNDLE_H
+#define TESSERACT_PROCESS_MANAGERS_REQUEST_BUNDLE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_motion_planners/core/profile_dictionary.h>
+#include <tesseract_process_managers/core/process_planning_request.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::RequestBundle)
+%shared_ptr(tesseract_planning::RequestRecorder)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A process planning request with the state it was planned from
+ * @details Environment commands and profiles are arbitrary types which can not be serialized. The bundle only holds
+ * the number of commands of the request, and the profiles of the TrajOpt, OMPL and Descartes planners which provide
+ * an xml serialization. These are restored as the default profile types of the planners, every other profile must
+ * be added by the replay. The environment is identified by its scene graph name and revision, and must be loaded by
+ * the replay from the same URDF and SRDF.
+ */
+struct RequestBundle
+{
+  using Ptr = std::shared_ptr<RequestBundle>;
+  using ConstPtr = std::shared_ptr<const RequestBundle>;
+
+  /** @brief The request, without its commands */
+  ProcessPlanningRequest request;
+
+  /** @brief The number of commands of the request which were not captured */
+  std::size_t command_count{ 0 };
+
+  /** @brief The name of the scene graph of the environment */
+  std::string scene_graph_name;
+
+  /** @brief The revision of the environment */
+  int environment_revision{ 0 };
+
+  /** @brief The joint values of the environment, after the state of the request was applied */
+  std::unordered_map<std::string, double> environment_state;
+
+  /** @brief The revision of the profile dictionary */
+  std::size_t profiles_revision{ 0 };
+
+  /** @brief The xml of the TrajOpt plan profiles by name */
+  std::map<std::string, std::string> trajopt_plan_profiles;
+
+  /** @brief The xml of the TrajOpt composite profiles by name */
+  std::map<std::string, std::string> trajopt_composite_profiles;
+
+  /** @brief The xml of the OMPL plan profiles by name */
+  std::map<std::string, std::string> ompl_plan_profiles;
+
+  /** @brief The xml of the Descartes plan profiles by name */
+  std::map<std::string, std::string> descartes_plan_profiles;
+
+  /**
+   * @brief The first seed of the OMPL random number generators of the recording process
+   * @details Each generator is seeded from this when it is created, so the random numbers drawn by the request depend
+   * on every generator the process created before it. They are not reproduced by setting this seed in a replay.
+   */
+  std::uint_fast32_t ompl_seed{ 0 };
+
+  /** @brief The time from submitting the request until it finished in seconds, negative if it did not finish */
+  double duration{ -1 };
+
+  /** @brief Indicate if the request was successful */
+  bool successful{ false };
+};
+
+/**
+ * @brief Capture a request before it is planned
+ * @param request The request
+ * @param env The environment the request is planned with, after its state is set and before its commands are applied
+ * @param profiles The profiles the request is planned with
+ * @return The bundle, its duration is set once the request finished
+ */
+RequestBundle captureRequestBundle(const ProcessPlanningRequest& request,
+                                   const tesseract_environment::Environment& env,
+                                   const ProfileDictionary& profiles);
+
+/**
+ * @brief Write a bundle to a file
+ * @param bundle The bundle
+ * @param file_path The file path
+ * @return True if successful, false if the program is not supported by serializeInstruction or writing failed
+ */
+bool saveRequestBundle(const RequestBundle& bundle, const std::string& file_path);
+
+/**
+ * @brief Read a bundle written by saveRequestBundle
+ * @param bundle The bundle
+ * @param file_path The file path
+ * @return True if successful, otherwise false
+ */
+bool loadRequestBundle(RequestBundle& bundle, const std::string& file_path);
+
+/**
+ * @brief Add the profiles of a bundle to a profile dictionary, replacing profiles with the same name
+ * @param profiles The profile dictionary
+ * @param bundle The bundle
+ * @return True if successful, false if a profile could not be parsed
+ */
+bool addRequestBundleProfiles(ProfileDictionary& profiles, const RequestBundle& bundle);
+
+/**
+ * @brief Writes the bundles of finished requests to a directory, see ProcessPlanningServer::setRequestRecorder
+ * @details A bundle is only written if the request took at least the minimum duration, so the recorder may be left
+ * enabled to capture the slow requests of a process. Each bundle is written to its own file named by the time it
+ * was written.
+ */
+class RequestRecorder
+{
+public:
+  using Ptr = std::shared_ptr<RequestRecorder>;
+  using ConstPtr = std::shared_ptr<const RequestRecorder>;
+
+  /**
+   * @brief Constructor
+   * @param directory The directory the bundles are written to, it must exist
+   * @param min_duration The minimum duration in seconds of the requests which are written
+   */
+  RequestRecorder(std::string directory, double min_duration = 0);
+
+  /**
+   * @brief Write a bundle if its duration is at least the minimum duration
+   * @param bundle The bundle of a finished request
+   * @return The file path of the bundle, empty if it was not written
+   */
+  std::string record(const RequestBundle& bundle);
+
+  /** @brief Get the directory the bundles are written to */
+  const std::string& getDirectory() const;
+
+  /** @brief Get the minimum duration in seconds of the requests which are written */
+  double getMinDuration() const;
+
+  /** @brief Get the number of bundles written */
+  std::size_t getCount() const;
+
+protected:
+  std::string directory_;
+  double min_duration_;
+  std::atomic<std::size_t> count_{ 0 };
+
+  /** @brief The index of the next bundle, used to make the file names unique */
+  std::atomic<std::size_t> index_{ 0 };
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_REQUEST_BUNDLE_H
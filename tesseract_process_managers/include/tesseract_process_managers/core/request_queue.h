@@ -0,0 +1,247 @@
+/**
+ * @file request_queue.h
+ * @brief Admission control of the process planning requests run by an executor
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_REQUEST_QUEUE_H
+#define TESSERACT_PROCESS_MANAGERS_REQUEST_QUEUE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/taskflow_interface.h>
+#include <tesseract_process_managers/core/process_planning_request.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::RequestQueue)
+%nodefaultctor tesseract_planning::RequestQueue;
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe queue of the taskflows of process planning requests in front of an executor
+ * @details Requests are started in order of priority, and in submission order within a priority class, as long as the
+ * number of requests in flight and the number of requests of their class in flight are below the configured limits.
+ * Submitting blocks while the number of queued requests is at its limit, so callers producing requests faster than
+ * they are planned are slowed down.
+ *
+ * Preemptible requests are held in the queue while requests of a higher priority are in flight, so the workers of the
+ * executor are left to the higher priority requests. The preemption gates of the preemptible requests which already
+ * started are closed as well, so their sub-taskflows which have not started are parked at their module boundary until
+ * the higher priority requests finished (see PreemptionGate). No worker of the executor is ever blocked by the queue.
+ */
+class RequestQueue
+{
+public:
+  using Ptr = std::shared_ptr<RequestQueue>;
+  using ConstPtr = std::shared_ptr<const RequestQueue>;
+
+  /**
+   * @brief Constructor
+   * @param executor The executor running the requests
+   */
+  RequestQueue(std::shared_ptr<tf::Executor> executor);
+
+  /** @brief Waits for all submitted requests to finish */
+  ~RequestQueue();
+  RequestQueue(const RequestQueue&) = delete;
+  RequestQueue& operator=(const RequestQueue&) = delete;
+  RequestQueue(RequestQueue&&) = delete;
+  RequestQueue& operator=(RequestQueue&&) = delete;
+
+#ifndef SWIG
+  /**
+   * @brief Submit the taskflow of a request
+   * @details This blocks while the queue is full, so it must not be called from a task run by the executor.
+   * @param taskflow The taskflow, it must not be modified or destroyed until the returned future is ready
+   * @param interface The interface of the taskflow
+   * @param priority The priority class
+   * @param preemptible Hold the request while requests of a higher priority are in flight
+   * @param on_finished Called once the taskflow has finished before the future is ready (Optional)
+   * @return The future which is ready once the taskflow has finished
+   */
+  std::future<void> submit(tf::Taskflow& taskflow,
+                           TaskflowInterface::Ptr interface,
+                           ProcessPlanningPriority priority = ProcessPlanningPriority::NORMAL,
+                           bool preemptible = true,
+                           std::function<void()> on_finished = nullptr);
+
+  /**
+   * @brief Submit the taskflows of a batch of requests which are admitted as a single request
+   * @details The taskflows run concurrently as one taskflow so the executor balances the work across the batch
+   * @param taskflows The taskflows, they must not be modified or destroyed until their future is ready
+   * @param interfaces The interfaces of the taskflows, the same size as taskflows
+   * @param priority The priority class
+   * @param preemptible Hold the request while requests of a higher priority are in flight
+   * @param on_finished Called once each taskflow has finished before its future is ready, empty or the same size as
+   * taskflows (Optional)
+   * @return The future of each taskflow which is ready once it has finished
+   */
+  std::vector<std::future<void>> submit(const std::vector<tf::Taskflow*>& taskflows,
+                                        const std::vector<TaskflowInterface::Ptr>& interfaces,
+                                        ProcessPlanningPriority priority = ProcessPlanningPriority::NORMAL,
+                                        bool preemptible = true,
+                                        const std::vector<std::function<void()>>& on_finished = {});
+#endif  // SWIG
+
+  /** @brief Wait until all submitted requests have finished */
+  void waitForAll();
+
+  /**
+   * @brief Set the maximum number of requests in flight
+   * @param max_in_flight The maximum, zero for no limit (Default)
+   */
+  void setMaxInFlight(std::size_t max_in_flight);
+
+  /** @brief Get the maximum number of requests in flight, zero if there is no limit */
+  std::size_t getMaxInFlight() const;
+
+  /**
+   * @brief Set the maximum number of requests of a priority class in flight
+   * @param priority The priority class
+   * @param max_in_flight The maximum, zero for no limit (Default)
+   */
+  void setMaxInFlight(ProcessPlanningPriority priority, std::size_t max_in_flight);
+
+  /** @brief Get the maximum number of requests of a priority class in flight, zero if there is no limit */
+  std::size_t getMaxInFlight(ProcessPlanningPriority priority) const;
+
+  /**
+   * @brief Set the maximum number of queued requests, submitting blocks while it is reached
+   * @param max_queued The maximum, zero for no limit (Default)
+   */
+  void setMaxQueued(std::size_t max_queued);
+
+  /** @brief Get the maximum number of queued requests, zero if there is no limit */
+  std::size_t getMaxQueued() const;
+
+  /** @brief Get the number of requests waiting to start */
+  std::size_t getQueueDepth() const;
+
+  /** @brief Get the number of requests of a priority class waiting to start */
+  std::size_t getQueueDepth(ProcessPlanningPriority priority) const;
+
+  /** @brief Get the number of requests started which have not finished */
+  std::size_t getInFlight() const;
+
+  /** @brief Get the number of requests of a priority class started which have not finished */
+  std::size_t getInFlight(ProcessPlanningPriority priority) const;
+
+  /**
+   * @brief Get the number of preemptible requests held by requests of a higher priority in flight
+   * @details This includes the queued requests and the started requests whose preemption gates are closed
+   */
+  std::size_t getPreempted() const;
+
+protected:
+  static constexpr std::size_t PRIORITY_COUNT = 3;
+
+  struct QueuedRequest
+  {
+    ProcessPlanningPriority priority{ ProcessPlanningPriority::NORMAL };
+    bool preemptible{ true };
+    std::vector<TaskflowInterface::Ptr> interfaces;
+    std::vector<std::function<void()>> on_finished;
+
+    /** @brief Runs the taskflows of the request followed by the task which reports it finished */
+    tf::Taskflow taskflow;
+
+    /** @brief The future of running the taskflow, the request is kept until it is ready */
+    std::shared_future<void> run_future;
+
+    /** @brief Set once each taskflow of the request has finished */
+    std::vector<std::promise<void>> promises;
+
+    /** @brief Set once the last task of the request ran */
+    bool finished{ false };
+
+    /** @brief Set while the preemption gates of the interfaces are closed */
+    bool preempted{ false };
+
+    /** @brief The futures of resuming the sub-taskflows parked at the preemption gates */
+    std::vector<std::shared_future<void>> resumed;
+  };
+
+  std::shared_ptr<tf::Executor> executor_;
+  std::size_t max_in_flight_{ 0 };
+  std::array<std::size_t, PRIORITY_COUNT> max_class_in_flight_{};
+  std::size_t max_queued_{ 0 };
+
+  /** @brief The requests waiting to start by priority class */
+  std::array<std::deque<std::shared_ptr<QueuedRequest>>, PRIORITY_COUNT> queued_;
+
+  /** @brief The number of requests in flight by priority class */
+  std::array<std::size_t, PRIORITY_COUNT> in_flight_{};
+
+  /** @brief The requests started whose taskflow may still be run by the executor */
+  std::list<std::shared_ptr<QueuedRequest>> started_;
+
+  /** @brief The mutex used when reading and writing the members above */
+  mutable std::mutex mutex_;
+
+  /** @brief Notified when the requests queued or in flight change */
+  std::condition_variable changed_;
+
+  /**
+   * @brief Start the queued requests allowed by the limits and update the preemption gates of the started requests
+   * @details The caller must hold the lock
+   */
+  void dispatch();
+
+  /** @brief Start the queued requests allowed by the limits, the caller must hold the lock */
+  void start();
+
+  /** @brief Close or open the preemption gates of the started preemptible requests, the caller must hold the lock */
+  void updatePreemptionGates();
+
+  /** @brief Check if the executor is done with a started request, the caller must hold the lock */
+  bool isReleased(const QueuedRequest& request) const;
+
+  /** @brief Called by the last task of a request */
+  void finished(QueuedRequest& request);
+
+  /** @brief Check if requests of a higher priority are in flight, the caller must hold the lock */
+  bool isPreempted(ProcessPlanningPriority priority) const;
+
+  /** @brief Get the total number of queued requests, the caller must hold the lock */
+  std::size_t queueDepth() const;
+
+  /** @brief Get the total number of requests in flight, the caller must hold the lock */
+  std::size_t inFlight() const;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_REQUEST_QUEUE_H
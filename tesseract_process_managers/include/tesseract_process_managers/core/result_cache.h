@@ -0,0 +1,184 @@
+/**
+ * @file result_cache.h
+ * @brief A cache of planning results keyed by the content of the request
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_RESULT_CACHE_H
+#define TESSERACT_PROCESS_MANAGERS_RESULT_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/core/instruction.h>
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_motion_planners/core/profile_dictionary.h>
+#include <tesseract_process_managers/core/process_planning_request.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::ResultCache)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe cache of successful planning results keyed by the content of the request
+ * @details The key holds the full content of the request, see getResultCacheKey, and entries are found by comparing
+ * the full key so a lookup never returns the results of a different request. The results are kept in memory up to a
+ * bound on their approximate size, removing the least recently used first.
+ *
+ * If a directory is provided the results are also written to it, one file per key named by a hash of the key, and
+ * results not in memory are read from it. Each file stores the full key which is compared on read. Only keys marked
+ * persistent by getResultCacheKey use the directory, since other keys are only valid in this process. Only results made
+ * of composite, plan and move instructions with cartesian, joint or state waypoints and without external tool center
+ * points are written to the directory.
+ */
+class ResultCache
+{
+public:
+  using Ptr = std::shared_ptr<ResultCache>;
+  using ConstPtr = std::shared_ptr<const ResultCache>;
+
+  /**
+   * @brief Constructor
+   * @param max_bytes The maximum approximate size of the results kept in memory
+   * @param directory The directory the results are written to, empty to only keep them in memory
+   */
+  ResultCache(std::size_t max_bytes = 64 * 1024 * 1024, std::string directory = "");
+
+  /**
+   * @brief Get the results of a key
+   * @param results The results if found
+   * @param key The key
+   * @param persistent False if the key is only valid in this process, the directory is then not read
+   * @return True if found, otherwise false
+   */
+  bool get(Instruction& results, const std::string& key, bool persistent = true);
+
+  /**
+   * @brief Add the results of a key, replacing existing results
+   * @param key The key
+   * @param results The results
+   * @param persistent False if the key is only valid in this process, the results are then not written to the directory
+   * @return True if added, false if the results are not supported or are larger than the memory bound
+   */
+  bool put(const std::string& key, const Instruction& results, bool persistent = true);
+
+  /** @brief Set the maximum approximate size of the results kept in memory */
+  void setMaxBytes(std::size_t max_bytes);
+
+  /** @brief Get the maximum approximate size of the results kept in memory */
+  std::size_t getMaxBytes() const;
+
+  /** @brief Get the approximate size of the results kept in memory */
+  std::size_t getBytes() const;
+
+  /** @brief Get the number of results kept in memory */
+  std::size_t size() const;
+
+  /** @brief Remove the results kept in memory, the directory is not modified */
+  void clear();
+
+  /** @brief Get the directory the results are written to, empty if they are only kept in memory */
+  const std::string& getDirectory() const;
+
+  /** @brief Get the number of lookups which found results */
+  std::size_t getHits() const;
+
+  /** @brief Get the number of lookups which did not find results */
+  std::size_t getMisses() const;
+
+protected:
+  struct Entry
+  {
+    std::string key;
+    Instruction results;
+    std::size_t bytes{ 0 };
+  };
+
+  std::size_t max_bytes_;
+  std::string directory_;
+
+  /** @brief The results kept in memory, the most recently used first */
+  std::list<Entry> entries_;
+
+  /** @brief The entries by key, referring to the key stored in the entry so it is only stored once */
+  std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+
+  std::size_t bytes_{ 0 };
+  std::size_t hits_{ 0 };
+  std::size_t misses_{ 0 };
+
+  /** @brief The mutex used when reading and writing the members above */
+  mutable std::mutex mutex_;
+
+  /** @brief Add results to memory, removing the least recently used, the caller must hold the lock */
+  void insert(const std::string& key, const Instruction& results, std::size_t bytes);
+
+  /** @brief Remove the least recently used results until the memory bound is met, the caller must hold the lock */
+  void evict();
+
+  /** @brief Get the file the results of a key are written to */
+  std::string getFilePath(const std::string& key) const;
+};
+
+/**
+ * @brief Get the key of the results of a request in a ResultCache
+ * @details This holds the process planner name, the program, the seed, the profile remappings, and the name and state
+ * of the environment.
+ *
+ * A persistent key also holds a hash of the collision geometry, joints and allowed collision matrix of the environment
+ * and of the xml of the profiles, so it matches in another process with the same content. This requires the profiles
+ * to only be TrajOpt plan and composite, OMPL plan and Descartes plan profiles, which can be serialized, and the
+ * collision geometry to not have octrees. Otherwise, or if a persistent key is not requested, the key holds the
+ * revisions of the environment and profiles instead, which restart in every process. The kinematics of the
+ * environment are assumed to follow from its scene graph.
+ * @param key The key
+ * @param persistent Set to true to request a persistent key, set to false if the key is only valid in this process.
+ * The content hashes are remembered per scene graph and revision, and per profile dictionary snapshot, so profiles
+ * must not be modified after they are added.
+ * @param request The request
+ * @param program The formatted program of the request
+ * @param seed The seed the program is planned from
+ * @param env The environment the request is planned with, after its state is set
+ * @param profiles The profiles the request is planned with
+ * @return True if successful, false if the request can not be cached because it has commands or its program is not
+ * supported by getProgramContentKey
+ */
+bool getResultCacheKey(std::string& key,
+                       bool& persistent,
+                       const ProcessPlanningRequest& request,
+                       const Instruction& program,
+                       const Instruction& seed,
+                       const tesseract_environment::Environment& env,
+                       const ProfileDictionary& profiles);
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_RESULT_CACHE_H
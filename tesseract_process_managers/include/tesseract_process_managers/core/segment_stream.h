@@ -0,0 +1,142 @@
+/**
+ * @file segment_stream.h
+ * @brief Stream the completed segments of a process in program order
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_SEGMENT_STREAM_H
+#define TESSERACT_PROCESS_MANAGERS_SEGMENT_STREAM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/core/instruction.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::SegmentStream)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/**
+ * @brief A threadsafe stream of the completed segments of a program (from_start, rasters and transitions)
+ * @details The segments of a program are planned concurrently and finish out of order. A segment is only passed to
+ * the subscribers once every segment before it has completed, so the segments are received in program order and
+ * each one starts where the previous one ends. This allows executing the beginning of a program while the remaining
+ * segments are still planned.
+ *
+ * The subscribers are called without holding the lock of the stream, so they may subscribe, unsubscribe and complete
+ * segments. Only one thread calls the subscribers at a time: a thread completing a segment while another thread is
+ * calling the subscribers returns immediately and the other thread passes the segment as well. The subscribers
+ * should therefore return quickly (e.g. push the segment to a queue).
+ */
+class SegmentStream
+{
+public:
+  using Ptr = std::shared_ptr<SegmentStream>;
+  using ConstPtr = std::shared_ptr<const SegmentStream>;
+
+  /** @brief Called with the index of the segment in the program and a copy of its results */
+  using Callback = std::function<void(std::size_t, const Instruction&)>;
+
+  /**
+   * @brief Subscribe to the segments
+   * @details The segments which were already streamed are passed to the callback before returning, unless another
+   * thread is calling the subscribers in which case that thread passes them
+   * @param callback The callback
+   * @return The id used to unsubscribe
+   */
+  std::size_t subscribe(Callback callback);
+
+  /**
+   * @brief Unsubscribe from the segments
+   * @details A call of the callback which is in progress on another thread is not waited for
+   * @param id The id returned by subscribe
+   */
+  void unsubscribe(std::size_t id);
+
+  /**
+   * @brief Report a part of a segment as complete
+   * @details A segment is copied and streamed once all of its parts are complete, which is used when a segment is
+   * planned as multiple sub-composites (e.g. approach, raster and departure). Reports of a segment which was already
+   * completed are ignored.
+   * @param index The index of the segment in the program
+   * @param segment The results of the segment
+   * @param parts The number of parts of the segment
+   */
+  void complete(std::size_t index, const Instruction& segment, std::size_t parts = 1);
+
+  /**
+   * @brief Get the segments which were streamed
+   * @return A copy of the segments in program order
+   */
+  std::vector<Instruction> getSegments() const;
+
+  /** @brief Get the number of segments which were streamed */
+  std::size_t size() const;
+
+  /** @brief Clear the segments and the subscribers so the stream may be used for another execution */
+  void reset();
+
+protected:
+  /** @brief The segments which were streamed in program order */
+  std::vector<Instruction> segments_;
+
+  /** @brief The completed segments waiting on a previous segment */
+  std::map<std::size_t, Instruction> pending_;
+
+  /** @brief The number of completed parts of the segments which have multiple parts */
+  std::map<std::size_t, std::size_t> parts_;
+
+  struct Subscriber
+  {
+    /** @brief Shared so a call in progress is not affected by unsubscribing */
+    std::shared_ptr<Callback> callback;
+
+    /** @brief The index of the next segment passed to the callback */
+    std::size_t next{ 0 };
+  };
+
+  /** @brief The subscribers by id */
+  std::map<std::size_t, Subscriber> subscribers_;
+
+  /** @brief The id of the next subscriber */
+  std::size_t next_id_{ 0 };
+
+  /** @brief Set while a thread is calling the subscribers */
+  bool dispatching_{ false };
+
+  mutable std::mutex mutex_;
+
+  /** @brief Pass the streamed segments to the subscribers which have not received them, unless already dispatching */
+  void dispatch();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_SEGMENT_STREAM_H
@@ -79,6 +79,9 @@ struct TaskInfoContainer
   /** @brief Get a copy of the task_info_map_ in case it gets resized*/
   std::map<std::size_t, TaskInfo::ConstPtr> getTaskInfoMap() const;
 
+  /** @brief Remove all stored TaskInfos */
+  void clear();
+
 private:
   mutable std::shared_mutex mutex_;
   std::map<std::size_t, TaskInfo::ConstPtr> task_info_map_;
@@ -30,7 +30,10 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <atomic>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/taskflow_interface.h>
@@ -51,6 +54,10 @@ namespace tesseract_planning
  *
  * Note that it does not have ownership of any of its members (except the pointer). This means that if a TaskInput
  * spawns a child that is a subset, it does not have to remain in scope as the references will still be valid
+ *
+ * A TaskInput is copied into every task, so its state is held by shared pointers and copying it does not allocate. The
+ * location of its instructions in the input program is resolved once and cached until the TaskflowInterface is reset.
+ * The results are resolved on every call since tasks replace the content of the results while the process runs.
  */
 struct TaskInput
 {
@@ -120,14 +127,23 @@ struct TaskInput
    * @param index sub-Instruction used to create the TaskInput
    * @return A TaskInput containing a subset of the original's instructions
    */
-  TaskInput operator[](std::size_t index);
+  TaskInput operator[](std::size_t index) const;
+
+  /**
+   * @brief Create a copy working on its own results which can be aborted without aborting this process
+   * @details Used to run alternative branches of a process concurrently, see TaskflowInterface::createBranch. The start
+   * and end instructions are still resolved from the results of this process. The branch can not be indexed.
+   * @param results The results of the branch, must outlive the returned TaskInput
+   * @return The TaskInput of the branch
+   */
+  TaskInput createBranch(Instruction* results) const;
 
   /**
    * @brief Gets the number of instructions contained in the TaskInput
    * @return 1 instruction if not a composite, otherwise size of the composite @todo Should this be -1, becuase
    * composite size could be 1, 0, or other?
    */
-  std::size_t size();
+  std::size_t size() const;
 
   /**
    * @brief Get the process inputs instructions
@@ -160,42 +176,132 @@ struct TaskInput
    */
   void abort();
 
+  /**
+   * @brief Report a segment of the results as complete to the segment stream of the process
+   * @details Only the segments of the program are streamed, so this does nothing for a sub-TaskInput or a branch.
+   * The segment must not be modified once all of its parts are complete.
+   * @param index The index of the segment in the results
+   * @param parts The number of parts of the segment which are reported separately
+   */
+  void completeSegment(std::size_t index, std::size_t parts = 1) const;
+
   void setStartInstruction(Instruction start);
   void setStartInstruction(std::vector<std::size_t> start);
-  Instruction getStartInstruction() const;
+
+  /**
+   * @brief Set the start instruction using indices into the input instructions
+   * @details This is resolved when requested so it remains valid if the content of the input instructions is replaced.
+   * If the indices reference a composite its last plan instruction is used as a start instruction. If the indices are
+   * empty the start instruction of the input instructions is used.
+   * @param start The indices of the instruction in the input instructions
+   */
+  void setStartInstructionFromInput(std::vector<std::size_t> start);
+
+  /**
+   * @brief Get the start instruction
+   * @details The reference is valid until the start instruction is changed or the referenced results are modified
+   * @return The start instruction, a NullInstruction if there is none
+   */
+  const Instruction& getStartInstruction() const;
 
   void setEndInstruction(Instruction end);
   void setEndInstruction(std::vector<std::size_t> end);
-  Instruction getEndInstruction() const;
+
+  /**
+   * @brief Get the end instruction
+   * @details The reference is valid until the end instruction is changed or the referenced results are modified
+   * @return The end instruction, a NullInstruction if there is none
+   */
+  const Instruction& getEndInstruction() const;
 
   void addTaskInfo(const TaskInfo::ConstPtr& task_info);
   TaskInfo::ConstPtr getTaskInfo(const std::size_t& index) const;
   std::map<std::size_t, TaskInfo::ConstPtr> getTaskInfoMap() const;
 
 protected:
+  /** @brief A node of the path from the root instruction to the instruction of a TaskInput */
+  struct Node
+  {
+    Node(std::shared_ptr<const Node> parent, std::size_t index) : parent(std::move(parent)), index(index) {}
+
+    /** @brief The parent node, nullptr if the parent is the root instruction */
+    std::shared_ptr<const Node> parent;
+
+    /** @brief The index of the instruction in the parent composite */
+    std::size_t index;
+
+    /**
+     * @brief The generation of the interface the cached instruction was resolved for
+     * @details This is stored after the instruction so a thread reading the current generation may read the
+     * instruction without locking the mutex
+     */
+    mutable std::atomic<std::size_t> generation{ std::numeric_limits<std::size_t>::max() };
+
+    /** @brief The cached input instruction, nullptr if the path is invalid */
+    mutable std::atomic<const Instruction*> instruction{ nullptr };
+
+    /** @brief Only locked to resolve the instruction when the generation changed */
+    mutable std::mutex mutex;
+  };
+
+  /** @brief A start or end instruction either provided or referenced by indices */
+  struct InstructionReference
+  {
+    /** @brief The provided instruction, if null the instruction is referenced by indices */
+    Instruction instruction{ NullInstruction() };
+
+    /** @brief Indices to the instruction from the root of the input instructions or results */
+    std::vector<std::size_t> indices;
+
+    /** @brief Indicate that the indices are into the input instructions instead of the results */
+    bool from_input{ false };
+
+    /**
+     * @brief The generation of the interface the cached start instruction was created for
+     * @details This is stored after the cached instruction so a thread reading the current generation may read it
+     * without locking the mutex
+     */
+    mutable std::atomic<std::size_t> generation{ std::numeric_limits<std::size_t>::max() };
+
+    /** @brief The start instruction created from the input instructions */
+    mutable Instruction cached{ NullInstruction() };
+
+    /** @brief Only locked to create the cached instruction when the generation changed */
+    mutable std::mutex mutex;
+  };
+
   /** @brief Instructions to be carried out by process */
   const Instruction* instruction_;
 
   /** @brief Results/Seed for this process */
   Instruction* results_;
 
-  /** @brief The indicies used to access this process inputs instructions and results */
-  std::vector<std::size_t> instruction_indice_;
+  /** @brief The results of a branch used instead of the results of this process, nullptr if this is not a branch */
+  Instruction* branch_results_{ nullptr };
 
-  /** @brief This proccess inputs start instruction */
-  Instruction start_instruction_{ NullInstruction() };
+  /** @brief The path used to access this process inputs instructions and results, nullptr for the root */
+  std::shared_ptr<const Node> node_;
 
-  /** @brief Indices to the start instruction in the results data struction */
-  std::vector<std::size_t> start_instruction_indice_;
+  /** @brief This proccess inputs start instruction, nullptr if there is none */
+  std::shared_ptr<const InstructionReference> start_instruction_;
 
-  /** @brief This proccess inputs end instruction */
-  Instruction end_instruction_{ NullInstruction() };
-
-  /** @brief Indices to the end instruction in the results data struction */
-  std::vector<std::size_t> end_instruction_indice_;
+  /** @brief This proccess inputs end instruction, nullptr if there is none */
+  std::shared_ptr<const InstructionReference> end_instruction_;
 
   /** @brief Used to store if process input is aborted which is thread safe */
   TaskflowInterface::Ptr interface_{ std::make_shared<TaskflowInterface>() };
+
+  /**
+   * @brief Resolve the input instruction of a node, cached for the current generation of the interface
+   * @details The node is only locked when the generation changed since it was last resolved
+   */
+  const Instruction* resolveInstruction(const Node& node) const;
+
+  /** @brief Create the start instruction referenced by indices into the input instructions */
+  Instruction createStartInstructionFromInput(const std::vector<std::size_t>& indices) const;
+
+  /** @brief Resolve the results of a node */
+  Instruction* resolveResults(const Node* node) const;
 };
 
 }  // namespace tesseract_planning
@@ -0,0 +1,152 @@
+/**
+ * @file taskflow_cache.h
+ * @brief A cache of generated taskflows which may be re-run
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_TASKFLOW_CACHE_H
+#define TESSERACT_PROCESS_MANAGERS_TASKFLOW_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/taskflow_container.h>
+#include <tesseract_process_managers/core/taskflow_interface.h>
+
+#include <tesseract_motion_planners/core/types.h>
+
+#include <tesseract_command_language/core/instruction.h>
+#include <tesseract_command_language/types.h>
+
+#include <tesseract_environment/core/environment.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A generated taskflow along with the data it was generated with
+ * @details The tasks only store pointers to the data, so the taskflow may be re-run for a new request with the same
+ * program structure by replacing the content of the data.
+ */
+struct CachedTaskflow
+{
+  using Ptr = std::shared_ptr<CachedTaskflow>;
+  using ConstPtr = std::shared_ptr<const CachedTaskflow>;
+
+  /** @brief The key identifying the process planner and program structure the taskflow was generated for */
+  std::string key;
+
+  /** @brief The input instructions referenced by the taskflow */
+  std::shared_ptr<Instruction> input;
+
+  /** @brief The results instructions referenced by the taskflow */
+  std::shared_ptr<Instruction> results;
+
+  /** @brief The global manipulator info referenced by the taskflow */
+  std::shared_ptr<ManipulatorInfo> global_manip_info;
+
+  /** @brief The plan profile remapping referenced by the taskflow */
+  std::shared_ptr<PlannerProfileRemapping> plan_profile_remapping;
+
+  /** @brief The composite profile remapping referenced by the taskflow */
+  std::shared_ptr<PlannerProfileRemapping> composite_profile_remapping;
+
+  /** @brief The environment referenced by the taskflow */
+  tesseract_environment::Environment::Ptr env;
+
+  /** @brief The interface referenced by the taskflow */
+  TaskflowInterface::Ptr interface;
+
+  /** @brief The generated taskflow */
+  TaskflowContainer taskflow_container;
+};
+
+/**
+ * @brief A cache of generated taskflows
+ * @details Taskflows are leased from the cache and are returned once all references to the lease are released. A
+ * returned taskflow is only kept if nothing else holds on to its input or results.
+ * @note To take back leased taskflows this must be owned by a shared pointer, otherwise they are simply deleted.
+ */
+class TaskflowCache : public std::enable_shared_from_this<TaskflowCache>
+{
+public:
+  using Ptr = std::shared_ptr<TaskflowCache>;
+  using ConstPtr = std::shared_ptr<const TaskflowCache>;
+
+  /**
+   * @brief Constructor
+   * @param cache_size The maximum number of taskflows stored in the cache, zero disables the cache
+   */
+  TaskflowCache(std::size_t cache_size = 0);
+
+  /**
+   * @brief Set the maximum number of taskflows stored in the cache
+   * @details If the cache is full the least recently returned taskflow is removed
+   * @param size The size of the cache, zero disables the cache
+   */
+  void setCacheSize(std::size_t size);
+
+  /**
+   * @brief Get the maximum number of taskflows stored in the cache
+   * @return The size of the cache
+   */
+  std::size_t getCacheSize() const;
+
+  /**
+   * @brief Lease a taskflow from the cache
+   * @param key The key identifying the process planner and program structure
+   * @return The leased taskflow, nullptr if the cache does not contain one for the key
+   */
+  CachedTaskflow::Ptr getCachedTaskflow(const std::string& key);
+
+  /**
+   * @brief Lease a newly generated taskflow so it is added to the cache once released
+   * @param taskflow The generated taskflow
+   * @return The leased taskflow
+   */
+  CachedTaskflow::Ptr lease(CachedTaskflow::Ptr taskflow);
+
+  /** @brief Remove all taskflows from the cache */
+  void clear();
+
+protected:
+  /** @brief The assigned cache size */
+  std::size_t cache_size_{ 0 };
+
+  /** @brief The cached taskflows, the most recently returned first */
+  std::list<CachedTaskflow::Ptr> cache_;
+
+  /** @brief The mutex used when reading and writing to cache_ */
+  mutable std::mutex mutex_;
+
+  /**
+   * @brief Return a leased taskflow to the cache
+   * @param taskflow The taskflow being returned
+   */
+  void returnCachedTaskflow(CachedTaskflow::Ptr taskflow);
+};
+}  // namespace tesseract_planning
+#endif  // TESSERACT_PROCESS_MANAGERS_TASKFLOW_CACHE_H
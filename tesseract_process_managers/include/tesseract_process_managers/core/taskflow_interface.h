@@ -29,11 +29,15 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/task_info.h>
+#include <tesseract_process_managers/core/segment_stream.h>
+#include <tesseract_process_managers/core/preemption_gate.h>
+#include <tesseract_motion_planners/core/cancellation_token.h>
 
 #ifdef SWIG
 %shared_ptr(tesseract_planning::TaskflowInterface)
@@ -45,26 +49,97 @@ namespace tesseract_planning
  * @brief This is a thread safe class used for aborting a process along with checking if a process was succesful
  * @details If a process failed then the process has been abort by some child process
  */
-class TaskflowInterface
+class TaskflowInterface : public std::enable_shared_from_this<TaskflowInterface>
 {
 public:
   using Ptr = std::shared_ptr<TaskflowInterface>;
+  using ConstPtr = std::shared_ptr<const TaskflowInterface>;
 
   /**
    * @brief Check if the process was aborted
+   * @details This is called by the tasks before they run, so the process is aborted by the first call after its
+   * deadline has passed
    * @return True if aborted, otherwise false
    */
   bool isAborted() const;
 
+  /**
+   * @brief Check if the process was aborted because its deadline passed
+   * @return True if timed out, otherwise false
+   */
+  bool isTimedOut() const;
+
   /**
    * @brief Check if the process finished without error
    * @return True if the process was not aborted, otherwise false
    */
   bool isSuccessful() const;
 
-  /** @brief Abort the process associated with this interface */
+  /**
+   * @brief Abort the process associated with this interface
+   * @details This also cancels the planners currently solving for the process
+   */
   void abort();
 
+  /**
+   * @brief Reset the interface so it may be used for another execution of the same taskflow
+   * @details This clears the abort flag, the stored TaskInfos and the segment stream and increments the generation. For
+   * a branch only the abort flag of the branch is cleared.
+   */
+  void reset();
+
+  /**
+   * @brief Create an interface for a branch of the process which can be aborted on its own
+   * @details The branch is aborted when it or this process is aborted, but aborting the branch does not abort this
+   * process. The branch shares the TaskInfos, generation and deadline of this process. This is used to run alternative
+   * branches concurrently and abort the remaining branches once one succeeds. The branch also shares the segment
+   * stream.
+   * @note This must be owned by a shared pointer
+   * @return The interface of the branch
+   */
+  TaskflowInterface::Ptr createBranch() const;
+
+  /**
+   * @brief Get the number of times the interface was reset
+   * @details Data cached by the tasks from the instructions of a previous execution is stale once this changes
+   * @return The generation
+   */
+  std::size_t getGeneration() const;
+
+  /**
+   * @brief Get the token cancelled when the process is aborted
+   * @details This is passed to planners through the PlannerRequest so an abort stops a solve in progress
+   * @return The cancellation token
+   */
+  CancellationToken::ConstPtr getCancellationToken() const;
+
+  /**
+   * @brief Set the wall clock time the process must finish by
+   * @details This must be called before the process is run. It is cleared by reset().
+   * @param deadline The deadline
+   */
+  void setDeadline(std::chrono::steady_clock::time_point deadline);
+
+  /**
+   * @brief Get the wall clock time the process must finish by
+   * @return The deadline, std::chrono::steady_clock::time_point::max() if there is none
+   */
+  std::chrono::steady_clock::time_point getDeadline() const;
+
+  /**
+   * @brief Get the stream of the completed segments of the program
+   * @details Segments are only reported by the raster process planners, see TaskInput::completeSegment
+   * @return The segment stream
+   */
+  SegmentStream::Ptr getSegmentStream() const;
+
+  /**
+   * @brief Get the gate holding back the sub-taskflows of the process while it is preempted
+   * @details It is closed and opened by the RequestQueue, see PreemptionGate. A branch shares the gate of its process.
+   * @return The preemption gate
+   */
+  PreemptionGate::Ptr getPreemptionGate() const;
+
   /**
    * @brief Get TaskInfo for a specific task by unique ID
    * @param index Unique ID assigned the task from taskflow
@@ -85,10 +160,29 @@ public:
   TaskInfoContainer::Ptr getTaskInfoContainer() const;
 
 protected:
-  std::atomic<bool> abort_{ false };
+  /** @brief Cancelled when the process is aborted */
+  CancellationToken::Ptr abort_{ std::make_shared<CancellationToken>() };
+
+  /** @brief The deadline of the process */
+  std::chrono::steady_clock::time_point deadline_{ std::chrono::steady_clock::time_point::max() };
+
+  /** @brief Set when the process is aborted because the deadline passed */
+  mutable std::atomic<bool> timed_out_{ false };
+
+  /** @brief Incremented by reset() */
+  std::atomic<std::size_t> generation_{ 0 };
 
   /** @brief Threadsafe container for TaskInfos */
   TaskInfoContainer::Ptr task_infos_{ std::make_shared<TaskInfoContainer>() };
+
+  /** @brief The completed segments of the program */
+  SegmentStream::Ptr segment_stream_{ std::make_shared<SegmentStream>() };
+
+  /** @brief Holds back the sub-taskflows of the process while it is preempted */
+  PreemptionGate::Ptr preemption_gate_{ std::make_shared<PreemptionGate>() };
+
+  /** @brief The interface of the process this is a branch of, nullptr if this is not a branch */
+  TaskflowInterface::ConstPtr parent_;
 };
 
 }  // namespace tesseract_planning
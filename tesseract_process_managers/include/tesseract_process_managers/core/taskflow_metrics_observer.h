@@ -0,0 +1,264 @@
+/**
+ * @file taskflow_metrics_observer.h
+ * @brief A taskflow observer recording the timing of each task per process
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_TASKFLOW_METRICS_OBSERVER_H
+#define TESSERACT_PROCESS_MANAGERS_TASKFLOW_METRICS_OBSERVER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <taskflow/taskflow.hpp>
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/taskflow_container.h>
+#include <tesseract_process_managers/core/taskflow_interface.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_planning::ProcessMetrics)
+%shared_ptr(tesseract_planning::TaskflowMetricsObserver)
+#endif  // SWIG
+
+namespace tesseract_planning
+{
+/** @brief The timing of a single execution of a task */
+struct TaskExecutionMetrics
+{
+  /** @brief The name of the task */
+  std::string name;
+
+  /** @brief The id of the worker that ran the task */
+  std::size_t worker{ 0 };
+
+  /** @brief The time in seconds between the task becoming ready to run and a worker starting it */
+  double queue_wait_time{ 0 };
+
+  /** @brief The time in seconds the task ran for */
+  double wall_time{ 0 };
+};
+
+/**
+ * @brief A histogram of durations with logarithmic buckets
+ * @details Bucket i counts the durations up to 2^i microseconds, the last bucket counts everything larger
+ */
+class TimingHistogram
+{
+public:
+  static constexpr std::size_t BUCKET_COUNT = 32;
+
+  /** @brief Add a duration in seconds */
+  void add(double seconds);
+
+  /** @brief Add the durations of another histogram */
+  void merge(const TimingHistogram& other);
+
+  /** @brief The number of durations added */
+  std::size_t getCount() const;
+
+  /** @brief The sum of the durations in seconds */
+  double getSum() const;
+
+  /** @brief The smallest duration in seconds, zero if empty */
+  double getMin() const;
+
+  /** @brief The largest duration in seconds, zero if empty */
+  double getMax() const;
+
+  /** @brief The mean duration in seconds, zero if empty */
+  double getMean() const;
+
+  /**
+   * @brief Estimate a percentile from the buckets
+   * @param percentile The percentile between zero and one hundred
+   * @return The upper bound of the bucket containing the percentile in seconds, limited to the largest duration
+   */
+  double getPercentile(double percentile) const;
+
+  /** @brief The number of durations in each bucket */
+  const std::array<std::size_t, BUCKET_COUNT>& getBucketCounts() const;
+
+  /** @brief The upper bound in seconds of bucket index */
+  static double getBucketUpperBound(std::size_t index);
+
+private:
+  std::array<std::size_t, BUCKET_COUNT> buckets_{};
+  std::size_t count_{ 0 };
+  double sum_{ 0 };
+  double min_{ 0 };
+  double max_{ 0 };
+};
+
+/** @brief The histograms of the executions of tasks sharing a name */
+struct TaskTimingHistograms
+{
+  /** @brief The time tasks waited to be started after becoming ready */
+  TimingHistogram queue_wait_time;
+
+  /** @brief The time tasks ran for */
+  TimingHistogram wall_time;
+};
+
+/**
+ * @brief Write task histograms as JSON
+ * @param os The output stream
+ * @param histograms The histograms by task name
+ */
+void writeTaskTimingHistograms(std::ostream& os, const std::map<std::string, TaskTimingHistograms>& histograms);
+
+/** @brief A threadsafe record of the tasks executed by a single process */
+class ProcessMetrics
+{
+public:
+  using Ptr = std::shared_ptr<ProcessMetrics>;
+  using ConstPtr = std::shared_ptr<const ProcessMetrics>;
+
+  /** @brief Record the execution of a task */
+  void add(const TaskExecutionMetrics& metrics);
+
+  /** @brief Get a copy of the recorded executions in the order they finished */
+  std::vector<TaskExecutionMetrics> getExecutions() const;
+
+  /** @brief Get a copy of the histograms of the recorded executions by task name */
+  std::map<std::string, TaskTimingHistograms> getHistograms() const;
+
+  /** @brief Remove all recorded executions */
+  void clear();
+
+  /**
+   * @brief Write the recorded executions and histograms as JSON
+   * @param os The output stream
+   */
+  void dump(std::ostream& os) const;
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<TaskExecutionMetrics> executions_;
+  std::map<std::string, TaskTimingHistograms> histograms_;
+};
+
+/**
+ * @brief An executor observer recording the timing of each task of the processes added to it
+ *
+ * Taskflow only reports the task and worker to an observer, so the tasks of a process are looked up by their hash
+ * which is collected from the process's TaskflowContainer when it is added. Taskflow reuses the memory of destroyed
+ * tasks, so a task is only attributed to a process while the process's interface and metrics exist and the interface
+ * has not been reset since the process was added. Tasks that do not belong to an added process are only counted in the
+ * wall time histograms of the observer.
+ *
+ * The histograms of the observer are kept per worker so recording a task only locks the mutex of its worker, which is
+ * only contended while the histograms are read. They are merged when read.
+ *
+ * The time a task becomes ready is the time its last predecessor finished. Tasks without a predecessor in the same
+ * taskflow, like the first task of a composed taskflow, use the time of the last event of the same process instead.
+ */
+class TaskflowMetricsObserver : public tf::ObserverInterface
+{
+public:
+  using Ptr = std::shared_ptr<TaskflowMetricsObserver>;
+  using ConstPtr = std::shared_ptr<const TaskflowMetricsObserver>;
+
+  /**
+   * @brief Record the tasks of a process, this must be called before the process is run
+   * @details The tasks are no longer recorded once the interface or metrics are destroyed or the interface is reset
+   * @param container The container of the taskflow run by the process
+   * @param interface The interface of the process
+   * @param metrics The metrics the tasks are recorded in
+   */
+  void addProcess(const TaskflowContainer& container,
+                  const TaskflowInterface::ConstPtr& interface,
+                  const ProcessMetrics::Ptr& metrics);
+
+  /** @brief Get a copy of the histograms of every task run by the executor by task name */
+  std::map<std::string, TaskTimingHistograms> getHistograms() const;
+
+  /** @brief Remove the histograms of every task run by the executor */
+  void clear();
+
+  /**
+   * @brief Write the histograms of every task run by the executor as JSON
+   * @param os The output stream
+   */
+  void dump(std::ostream& os) const;
+
+  void set_up(size_t num_workers) final;
+
+  void on_entry(size_t w, tf::TaskView tv) final;
+
+  void on_exit(size_t w, tf::TaskView tv) final;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /** @brief The state shared by the tasks of a process */
+  struct Process
+  {
+    std::weak_ptr<const TaskflowInterface> interface;
+    std::size_t generation{ 0 };
+    std::weak_ptr<ProcessMetrics> metrics;
+    std::mutex mutex;
+    Clock::time_point last_event;
+    std::unordered_map<std::size_t, Clock::time_point> ready_times;
+  };
+
+  /** @brief A task being run by a worker */
+  struct RunningTask
+  {
+    std::shared_ptr<Process> process;
+    Clock::time_point start;
+    double queue_wait_time{ 0 };
+  };
+
+  mutable std::shared_mutex processes_mutex_;
+  std::unordered_map<std::size_t, std::shared_ptr<Process>> processes_;
+
+  /** @brief The tasks being run by each worker, only accessed by the worker */
+  std::vector<std::vector<RunningTask>> running_;
+
+  /** @brief The histograms of the tasks run by a worker */
+  struct WorkerHistograms
+  {
+    mutable std::mutex mutex;
+    std::map<std::string, TaskTimingHistograms> histograms;
+  };
+
+  std::vector<std::unique_ptr<WorkerHistograms>> histograms_;
+
+  std::shared_ptr<Process> findProcess(std::size_t task_hash) const;
+
+  /** @brief Check if the process was destroyed or its interface reset since it was added */
+  static bool isExpired(const Process& process);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_TASKFLOW_METRICS_OBSERVER_H
@@ -0,0 +1,75 @@
+/**
+ * @file text_serialization.h
+ * @brief A plain text serialization of command language programs
+ *
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_TEXT_SERIALIZATION_H
+#define TESSERACT_PROCESS_MANAGERS_TEXT_SERIALIZATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <iostream>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/core/instruction.h>
+
+namespace tesseract_planning
+{
+// Values are written as tokens separated by spaces. Strings are prefixed by their length so they may contain any
+// character and doubles are written in hexadecimal so they are read back exactly.
+
+/** @brief Write a string as a length prefixed token */
+void serializeString(std::ostream& os, const std::string& value);
+
+/** @brief Read a string written by serializeString */
+bool deserializeString(std::istream& is, std::string& value);
+
+/** @brief Write a double as a hexadecimal token */
+void serializeDouble(std::ostream& os, double value);
+
+/** @brief Read a double written by serializeDouble */
+bool deserializeDouble(std::istream& is, double& value);
+
+/**
+ * @brief Write an instruction
+ * @details Null, composite, plan and move instructions with cartesian, joint or state waypoints are supported.
+ * External tool center points are not supported since they are not part of the program.
+ * @param os The output stream
+ * @param instruction The instruction
+ * @return True if successful, false if the instruction is not supported
+ */
+bool serializeInstruction(std::ostream& os, const Instruction& instruction);
+
+/**
+ * @brief Read an instruction written by serializeInstruction
+ * @param is The input stream
+ * @param instruction The instruction
+ * @return True if successful, otherwise false
+ */
+bool deserializeInstruction(std::istream& is, Instruction& instruction);
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_TEXT_SERIALIZATION_H
@@ -50,6 +50,24 @@ void successTask(const TaskInput& /*instruction*/,
                  const std::string& message,
                  const TaskflowVoidFn& user_callback = nullptr);
 
+/**
+ * @brief The default success task of a segment of a program (from_start, raster or transition)
+ * @details The segment is reported to the segment stream of the process before calling the user callback, see
+ * TaskInput::completeSegment
+ * @param input The process input of the program
+ * @param segment The index of the segment in the program
+ * @param parts The number of parts of the segment which are planned separately
+ * @param name The name
+ * @param message A detailed message
+ * @param user_callback A user callback function
+ */
+void successTask(const TaskInput& input,
+                 std::size_t segment,
+                 std::size_t parts,
+                 const std::string& name,
+                 const std::string& message,
+                 const TaskflowVoidFn& user_callback = nullptr);
+
 /**
  * @brief The default failure task to be used
  * @details This will call the abort function of the TaskInput provided
@@ -77,6 +95,25 @@ bool isCompositeEmpty(const CompositeInstruction& composite);
  */
 int hasSeedTask(TaskInput input);
 
+/**
+ * @brief Get a string describing the structure of a program
+ * @details This includes the composite tree shape, the instruction and waypoint types, the profile names and the
+ * manipulator info but not the waypoint values
+ * @param instruction The program
+ * @return A string which is identical for programs with the same structure
+ */
+std::string getProgramStructureKey(const Instruction& instruction);
+
+/**
+ * @brief Get a string describing the full content of a program
+ * @details This includes the structure, descriptions, manipulator info and waypoints. Values are written exactly, so
+ * programs have the same key only if they are identical.
+ * @param key The key
+ * @param instruction The program
+ * @return True if successful, false if the program contains instructions or waypoints which are not supported
+ */
+bool getProgramContentKey(std::string& key, const Instruction& instruction);
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_PROCESS_MANAGERS_UTILS_H
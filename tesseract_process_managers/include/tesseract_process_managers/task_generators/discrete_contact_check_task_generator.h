@@ -54,6 +54,9 @@ public:
 
   tesseract_collision::CollisionCheckConfig config;
 
+  /** @brief The maximum number of threads used to check the trajectory (see contactCheckProgram) */
+  std::size_t num_threads{ 1 };
+
   int conditionalProcess(TaskInput input, std::size_t unique_id) const override;
 
   void process(TaskInput input, std::size_t unique_id) const override;
@@ -0,0 +1,68 @@
+/**
+ * @file experience_record_task_generator.h
+ * @brief Record a planned freespace motion in an experience library
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_EXPERIENCE_RECORD_TASK_GENERATOR_H
+#define TESSERACT_PROCESS_MANAGERS_EXPERIENCE_RECORD_TASK_GENERATOR_H
+
+#include <tesseract_process_managers/core/task_generator.h>
+#include <tesseract_process_managers/core/experience_library.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Adds the results of a single segment freespace motion to an experience library
+ * @details This should be placed after the results were validated. Results which are not single segment or contain
+ * cartesian waypoints are skipped without failing the task.
+ */
+class ExperienceRecordTaskGenerator : public TaskGenerator
+{
+public:
+  using UPtr = std::unique_ptr<ExperienceRecordTaskGenerator>;
+
+  ExperienceRecordTaskGenerator(ExperienceLibrary::Ptr library, std::string name = "Experience Record");
+
+  ~ExperienceRecordTaskGenerator() override = default;
+  ExperienceRecordTaskGenerator(const ExperienceRecordTaskGenerator&) = delete;
+  ExperienceRecordTaskGenerator& operator=(const ExperienceRecordTaskGenerator&) = delete;
+  ExperienceRecordTaskGenerator(ExperienceRecordTaskGenerator&&) = delete;
+  ExperienceRecordTaskGenerator& operator=(ExperienceRecordTaskGenerator&&) = delete;
+
+  int conditionalProcess(TaskInput input, std::size_t unique_id) const override;
+
+  void process(TaskInput input, std::size_t unique_id) const override;
+
+private:
+  ExperienceLibrary::Ptr library_;
+};
+
+class ExperienceRecordTaskInfo : public TaskInfo
+{
+public:
+  ExperienceRecordTaskInfo(std::size_t unique_id, std::string name = "Experience Record");
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_EXPERIENCE_RECORD_TASK_GENERATOR_H
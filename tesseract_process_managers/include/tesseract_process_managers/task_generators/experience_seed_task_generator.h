@@ -0,0 +1,96 @@
+/**
+ * @file experience_seed_task_generator.h
+ * @brief Seed a freespace motion with a previously planned trajectory
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_PROCESS_MANAGERS_EXPERIENCE_SEED_TASK_GENERATOR_H
+#define TESSERACT_PROCESS_MANAGERS_EXPERIENCE_SEED_TASK_GENERATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/task_generator.h>
+#include <tesseract_process_managers/core/task_input.h>
+#include <tesseract_process_managers/core/experience_library.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Replaces the seed of a single segment freespace motion with the nearest experience of the library
+ * @details The experience is stretched so its end points match the start and goal of the seed, and is only used if
+ * it passes a discrete collision check. This returns 1 if the seed was replaced, so it can be placed ahead of a
+ * sampling based planner which is only run when it returns 0.
+ */
+class ExperienceSeedTaskGenerator : public TaskGenerator
+{
+public:
+  using UPtr = std::unique_ptr<ExperienceSeedTaskGenerator>;
+
+  /**
+   * @brief Constructor
+   * @param library The experience library
+   * @param collision_margin The margin used to revalidate the experience. The experience is stretched to new end
+   * points and only checked at discrete states, so a positive margin keeps it clear of obstacles between them.
+   * @param name The name of the task
+   */
+  ExperienceSeedTaskGenerator(ExperienceLibrary::ConstPtr library,
+                              double collision_margin = 0.025,
+                              std::string name = "Experience Seed");
+
+  ~ExperienceSeedTaskGenerator() override = default;
+  ExperienceSeedTaskGenerator(const ExperienceSeedTaskGenerator&) = delete;
+  ExperienceSeedTaskGenerator& operator=(const ExperienceSeedTaskGenerator&) = delete;
+  ExperienceSeedTaskGenerator(ExperienceSeedTaskGenerator&&) = delete;
+  ExperienceSeedTaskGenerator& operator=(ExperienceSeedTaskGenerator&&) = delete;
+
+  /** @brief The maximum difference of any joint between the start and goal of the seed and the experience */
+  double tolerance{ 0.1 };
+
+  /** @brief The configuration used to revalidate the experience */
+  tesseract_collision::CollisionCheckConfig config;
+
+  /** @brief The maximum number of threads used to revalidate the experience (see contactCheckProgram) */
+  std::size_t num_threads{ 1 };
+
+  int conditionalProcess(TaskInput input, std::size_t unique_id) const override;
+
+  void process(TaskInput input, std::size_t unique_id) const override;
+
+private:
+  ExperienceLibrary::ConstPtr library_;
+};
+
+class ExperienceSeedTaskInfo : public TaskInfo
+{
+public:
+  ExperienceSeedTaskInfo(std::size_t unique_id, std::string name = "Experience Seed");
+
+  /** @brief The contacts of the experience if it failed revalidation */
+  std::vector<tesseract_collision::ContactResultMap> contact_results;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_PROCESS_MANAGERS_EXPERIENCE_SEED_TASK_GENERATOR_H
@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/taskflow_generator.h>
+#include <tesseract_process_managers/core/experience_library.h>
 #include <tesseract_motion_planners/core/profile_dictionary.h>
 
 namespace tesseract_planning
@@ -43,6 +44,7 @@ enum class FreespaceTaskflowType : int
 {
   DEFAULT = 0,       /**< @brief This will run omp followed by trajopt */
   TRAJOPT_FIRST = 1, /**< @brief This will run trajopt first then if it fails it will run ompl followed by trajopt */
+  RACE = 2,          /**< @brief This will race trajopt against ompl followed by trajopt, the first to succeed wins */
 };
 
 struct FreespaceTaskflowParams
@@ -51,6 +53,15 @@ struct FreespaceTaskflowParams
   bool enable_post_contact_discrete_check{ false };
   bool enable_post_contact_continuous_check{ true };
   bool enable_time_parameterization{ true };
+
+  /**
+   * @brief If provided, the nearest successful motion of the library is tried before running ompl
+   * @details Successful single segment motions are added to the library
+   */
+  ExperienceLibrary::Ptr experience_library;
+
+  /** @brief The collision margin used to revalidate an experience before it replaces the seed */
+  double experience_collision_margin{ 0.025 };
 };
 
 class FreespaceTaskflow : public TaskflowGenerator
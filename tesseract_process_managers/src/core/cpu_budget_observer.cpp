@@ -0,0 +1,39 @@
+/**
+ * @file cpu_budget_observer.cpp
+ * @brief A Taskflow observer which counts the busy workers against a CPU budget
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_process_managers/core/cpu_budget_observer.h>
+
+namespace tesseract_planning
+{
+CPUBudgetObserver::CPUBudgetObserver(CPUBudget& budget) : budget_(budget) {}
+
+void CPUBudgetObserver::set_up(size_t /*num_workers*/) {}
+
+void CPUBudgetObserver::on_entry(size_t /*w*/, tf::TaskView /*tv*/) { budget_.acquire(1); }
+
+void CPUBudgetObserver::on_exit(size_t /*w*/, tf::TaskView /*tv*/) { budget_.release(1); }
+
+}  // namespace tesseract_planning
@@ -0,0 +1,389 @@
+/**
+ * @file experience_library.cpp
+ * @brief A library of previously planned trajectories used to seed new requests
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/experience_library.h>
+#include <tesseract_command_language/command_language.h>
+#include <tesseract_command_language/utils/utils.h>
+
+namespace tesseract_planning
+{
+/** @brief Experiences with start and goal states closer than this are considered the same */
+static const double EXPERIENCE_SAME_STATE_TOLERANCE = 1e-6;
+
+/** @brief Write a name, quoting it if it contains whitespace, quotes or backslashes */
+static void writeName(std::ostream& os, const std::string& name)
+{
+  if (!name.empty() && name.find_first_of(" \t\n\r\v\f\"\\") == std::string::npos)
+  {
+    os << name;
+    return;
+  }
+
+  os << '"';
+  for (char c : name)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (c == '\n')
+      os << "\\n";
+    else
+      os << c;
+  }
+  os << '"';
+}
+
+/** @brief Read a name written by writeName, names of files written without quoting are read up to whitespace */
+static bool readName(std::istream& is, std::string& name)
+{
+  if (!(is >> std::ws))
+    return false;
+
+  if (is.peek() != '"')
+    return static_cast<bool>(is >> name);
+
+  is.get();
+  name.clear();
+  char c{ 0 };
+  while (is.get(c))
+  {
+    if (c == '"')
+      return true;
+
+    if (c == '\\')
+    {
+      if (!is.get(c))
+        return false;
+
+      if (c == 'n')
+        c = '\n';
+    }
+    name.push_back(c);
+  }
+  return false;
+}
+
+/** @brief Write an experience as a single line */
+static void writeExperience(std::ostream& os, const Experience& experience)
+{
+  writeName(os, experience.manipulator);
+  os << " " << experience.revision << " " << experience.trajectory.cols() << " " << experience.trajectory.rows();
+  for (const auto& joint_name : experience.joint_names)
+  {
+    os << " ";
+    writeName(os, joint_name);
+  }
+
+  for (long r = 0; r < experience.trajectory.rows(); ++r)
+    for (long c = 0; c < experience.trajectory.cols(); ++c)
+      os << " " << experience.trajectory(r, c);
+
+  os << "\n";
+}
+
+/** @brief Read an experience written by writeExperience */
+static bool readExperience(Experience& experience, const std::string& line)
+{
+  std::istringstream is(line);
+  long dof{ 0 };
+  long rows{ 0 };
+  if (!readName(is, experience.manipulator) || !(is >> experience.revision >> dof >> rows) || dof <= 0 || rows < 2)
+    return false;
+
+  experience.joint_names.resize(static_cast<std::size_t>(dof));
+  for (auto& joint_name : experience.joint_names)
+    if (!readName(is, joint_name))
+      return false;
+
+  experience.trajectory.resize(rows, dof);
+  for (long r = 0; r < rows; ++r)
+    for (long c = 0; c < dof; ++c)
+      if (!(is >> experience.trajectory(r, c)))
+        return false;
+
+  return true;
+}
+
+/** @brief Write experiences to a file, replacing its content */
+static bool writeExperiences(const std::string& file_path, const std::deque<Experience>& experiences)
+{
+  std::ofstream os(file_path, std::ios::trunc);
+  if (!os)
+    return false;
+
+  os.precision(std::numeric_limits<double>::max_digits10);
+  for (const auto& experience : experiences)
+    writeExperience(os, experience);
+
+  return static_cast<bool>(os);
+}
+
+/**
+ * @brief Read the experiences stored in a file
+ * @param experiences The valid experiences of the file
+ * @param lines The number of lines of the file
+ * @return True if the file could be read, otherwise false
+ */
+static bool readExperiences(std::vector<Experience>& experiences, std::size_t& lines, const std::string& file_path)
+{
+  std::ifstream is(file_path);
+  if (!is)
+    return false;
+
+  lines = 0;
+  std::string line;
+  while (std::getline(is, line))
+  {
+    ++lines;
+    Experience experience;
+    if (readExperience(experience, line))
+      experiences.push_back(std::move(experience));
+    else if (!line.empty())
+      CONSOLE_BRIDGE_logWarn("ExperienceLibrary: Skipping invalid experience in '%s'", file_path.c_str());
+  }
+
+  return true;
+}
+
+/** @brief The largest joint difference of the start and goal states of an experience */
+static double getExperienceDistance(const Experience& experience,
+                                    const Eigen::Ref<const Eigen::VectorXd>& start,
+                                    const Eigen::Ref<const Eigen::VectorXd>& goal)
+{
+  const long last = experience.trajectory.rows() - 1;
+  double start_distance = (experience.trajectory.row(0).transpose() - start).cwiseAbs().maxCoeff();
+  double goal_distance = (experience.trajectory.row(last).transpose() - goal).cwiseAbs().maxCoeff();
+  return std::max(start_distance, goal_distance);
+}
+
+ExperienceLibrary::ExperienceLibrary(std::string file_path, std::size_t max_experiences)
+  : file_path_(std::move(file_path)), max_experiences_(max_experiences)
+{
+  if (file_path_.empty() || !std::ifstream(file_path_).good())
+    return;
+
+  std::vector<Experience> experiences;
+  if (!readExperiences(experiences, file_lines_, file_path_))
+    return;
+
+  for (auto& experience : experiences)
+    addExperience(std::move(experience));
+
+  // Drop replaced, removed and invalid experiences from the file
+  if (file_lines_ != experiences_.size())
+    compact();
+}
+
+bool ExperienceLibrary::add(Experience experience)
+{
+  if (experience.trajectory.rows() < 2 || experience.trajectory.cols() == 0 ||
+      experience.trajectory.cols() != static_cast<long>(experience.joint_names.size()))
+    return false;
+
+  if (file_path_.empty())
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    addExperience(std::move(experience));
+    return true;
+  }
+
+  std::ostringstream line;
+  line.precision(std::numeric_limits<double>::max_digits10);
+  writeExperience(line, experience);
+
+  // The file is written while only holding the file mutex so lookups are not blocked by disk io
+  std::lock_guard<std::mutex> file_lock(file_mutex_);
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    addExperience(std::move(experience));
+  }
+
+  std::ofstream os(file_path_, std::ios::app);
+  os << line.str();
+  if (!os)
+    CONSOLE_BRIDGE_logWarn("ExperienceLibrary: Failed to write experience to '%s'", file_path_.c_str());
+
+  ++file_lines_;
+  if (file_lines_ > 2 * std::max<std::size_t>(max_experiences_, 1))
+    compact();
+
+  return true;
+}
+
+bool ExperienceLibrary::lookup(Experience& experience,
+                               const std::string& manipulator,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::VectorXd>& start,
+                               const Eigen::Ref<const Eigen::VectorXd>& goal,
+                               int revision,
+                               double tolerance) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const Experience* nearest{ nullptr };
+  bool nearest_same_revision{ false };
+  double nearest_distance{ std::numeric_limits<double>::max() };
+  for (const auto& candidate : experiences_)
+  {
+    if (candidate.manipulator != manipulator || candidate.joint_names != joint_names)
+      continue;
+
+    double distance = getExperienceDistance(candidate, start, goal);
+    if (distance > tolerance)
+      continue;
+
+    bool same_revision = (candidate.revision == revision);
+    if (nearest == nullptr || (same_revision && !nearest_same_revision) ||
+        (same_revision == nearest_same_revision && distance < nearest_distance))
+    {
+      nearest = &candidate;
+      nearest_same_revision = same_revision;
+      nearest_distance = distance;
+    }
+  }
+
+  if (nearest == nullptr)
+    return false;
+
+  experience = *nearest;
+  return true;
+}
+
+std::size_t ExperienceLibrary::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return experiences_.size();
+}
+
+void ExperienceLibrary::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  experiences_.clear();
+}
+
+bool ExperienceLibrary::save(const std::string& file_path) const { return writeExperiences(file_path, snapshot()); }
+
+bool ExperienceLibrary::load(const std::string& file_path)
+{
+  std::vector<Experience> experiences;
+  std::size_t lines{ 0 };
+  if (!readExperiences(experiences, lines, file_path))
+    return false;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  for (auto& experience : experiences)
+    addExperience(std::move(experience));
+
+  return true;
+}
+
+const std::string& ExperienceLibrary::getFilePath() const { return file_path_; }
+
+std::deque<Experience> ExperienceLibrary::snapshot() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return experiences_;
+}
+
+void ExperienceLibrary::compact()
+{
+  // Write to a temporary file first so the file is never left partially written
+  const std::string tmp_file_path = file_path_ + ".tmp";
+  std::deque<Experience> experiences = snapshot();
+  if (!writeExperiences(tmp_file_path, experiences) || std::rename(tmp_file_path.c_str(), file_path_.c_str()) != 0)
+  {
+    CONSOLE_BRIDGE_logWarn("ExperienceLibrary: Failed to compact '%s'", file_path_.c_str());
+    std::remove(tmp_file_path.c_str());
+    return;
+  }
+
+  file_lines_ = experiences.size();
+}
+
+void ExperienceLibrary::addExperience(Experience experience)
+{
+  if (max_experiences_ == 0)
+    return;
+
+  const long last = experience.trajectory.rows() - 1;
+  const Eigen::VectorXd start = experience.trajectory.row(0);
+  const Eigen::VectorXd goal = experience.trajectory.row(last);
+  for (auto it = experiences_.begin(); it != experiences_.end(); ++it)
+  {
+    if (it->manipulator == experience.manipulator && it->joint_names == experience.joint_names &&
+        getExperienceDistance(*it, start, goal) < EXPERIENCE_SAME_STATE_TOLERANCE)
+    {
+      experiences_.erase(it);
+      break;
+    }
+  }
+
+  experiences_.push_back(std::move(experience));
+  while (experiences_.size() > max_experiences_)
+    experiences_.pop_front();
+}
+
+bool getExperienceStart(Eigen::VectorXd& start,
+                        const CompositeInstruction& results,
+                        const Instruction& start_instruction)
+{
+  const Instruction* instruction = &start_instruction;
+  if (results.hasStartInstruction())
+    instruction = &results.getStartInstruction();
+
+  const Waypoint* waypoint{ nullptr };
+  if (isCompositeInstruction(*instruction))
+  {
+    const MoveInstruction* mi = getLastMoveInstruction(*instruction->cast_const<CompositeInstruction>());
+    if (mi != nullptr)
+      waypoint = &mi->getWaypoint();
+  }
+  else if (isMoveInstruction(*instruction))
+  {
+    waypoint = &instruction->cast_const<MoveInstruction>()->getWaypoint();
+  }
+  else if (isPlanInstruction(*instruction))
+  {
+    waypoint = &instruction->cast_const<PlanInstruction>()->getWaypoint();
+  }
+
+  if (waypoint == nullptr || !(isStateWaypoint(*waypoint) || isJointWaypoint(*waypoint)))
+    return false;
+
+  start = getJointPosition(*waypoint);
+  return true;
+}
+
+}  // namespace tesseract_planning
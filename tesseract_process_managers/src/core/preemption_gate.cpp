@@ -0,0 +1,93 @@
+/**
+ * @file preemption_gate.cpp
+ * @brief Hold back the sub-taskflows of a process while it is preempted
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_process_managers/core/preemption_gate.h>
+
+namespace tesseract_planning
+{
+PreemptionGate::PreemptionGate()
+{
+  tf::Task resume = resume_.emplace([]() {}).name("Resume");
+  resume.release(semaphore_);
+}
+
+void PreemptionGate::add(tf::Taskflow& taskflow, tf::Task input)
+{
+  // Both paths are weak edges so the input task runs once, either directly or after being resumed
+  PreemptionGate::Ptr gate = shared_from_this();
+  tf::Task check = taskflow.emplace([gate]() { return (gate->park() ? 1 : 0); }).name("Preemption Gate");
+  tf::Task parked = taskflow.emplace([]() { return 0; }).name("Preempted");
+  parked.acquire(semaphore_);
+  check.precede(input, parked);
+  parked.precede(input);
+}
+
+std::shared_future<void> PreemptionGate::open(tf::Executor& executor)
+{
+  std::size_t parked{ 0 };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = false;
+    parked = parked_;
+    parked_ = 0;
+  }
+
+  if (parked == 0)
+    return std::shared_future<void>();
+
+  // Runs of the same taskflow are serialized, so the semaphore gains exactly one unit for each parked sub-taskflow
+  return executor.run_n(resume_, parked).share();
+}
+
+void PreemptionGate::close()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  closed_ = true;
+}
+
+bool PreemptionGate::isClosed() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+std::size_t PreemptionGate::getParked() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return parked_;
+}
+
+bool PreemptionGate::park()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!closed_)
+    return false;
+
+  ++parked_;
+  return true;
+}
+
+}  // namespace tesseract_planning
@@ -24,6 +24,11 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_process_managers/core/process_environment_cache.h>
 
 namespace tesseract_planning
@@ -32,57 +37,161 @@ ProcessEnvironmentCache::ProcessEnvironmentCache(tesseract_environment::Environm
                                                  std::size_t cache_size)
   : env_(std::move(env)), cache_size_(cache_size)
 {
+  refill_thread_ = std::thread(&ProcessEnvironmentCache::refillLoop, this);
+}
+
+ProcessEnvironmentCache::~ProcessEnvironmentCache()
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    refill_stop_ = true;
+  }
+  refill_cv_.notify_all();
+
+  if (refill_thread_.joinable())
+    refill_thread_.join();
 }
 
 void ProcessEnvironmentCache::setCacheSize(long size)
 {
-  std::unique_lock<std::shared_mutex> lock(cache_mutex_);
-  cache_size_ = static_cast<std::size_t>(size);
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    cache_size_ = static_cast<std::size_t>(size);
+    while (cache_.size() > cache_size_)
+      cache_.pop_front();
+  }
+  requestRefill();
 }
 
-long ProcessEnvironmentCache::getCacheSize() const { return static_cast<long>(cache_size_); }
+long ProcessEnvironmentCache::getCacheSize() const
+{
+  std::shared_lock<std::shared_mutex> lock(cache_mutex_);
+  return static_cast<long>(cache_size_);
+}
+
+tesseract_environment::Environment::ConstPtr ProcessEnvironmentCache::getEnvironment() const { return env_; }
 
 void ProcessEnvironmentCache::refreshCache()
 {
-  std::unique_lock<std::shared_mutex> lock(cache_mutex_);
-  tesseract_environment::Environment::Ptr env;
-
-  int rev = env_->getRevision();
-  if (rev != cache_env_revision_ || cache_.empty())
+  std::size_t missing{ 0 };
   {
-    env = env_->clone();
-    cache_env_revision_ = rev;
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    if (cache_.size() < cache_size_)
+      missing = cache_size_ - cache_.size();
   }
 
-  if (env != nullptr)
-  {
-    cache_.clear();
-    for (std::size_t i = 0; i < cache_size_; ++i)
-      cache_.push_back(env->clone());
-  }
-  else if (cache_.size() <= 2)
+  // Clone outside of the lock so leasing is not blocked, cached environments of an older revision are updated when
+  // they are leased
+  for (std::size_t i = 0; i < missing; ++i)
   {
-    for (std::size_t i = (cache_.size() - 1); i < cache_size_; ++i)
-      cache_.push_back(cache_.front()->clone());
+    tesseract_environment::Environment::Ptr env = env_->clone();
+
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    if (cache_.size() >= cache_size_)
+      break;
+
+    cache_.push_front(env);
   }
 }
 
 tesseract_environment::Environment::Ptr ProcessEnvironmentCache::getCachedEnvironment()
 {
-  // This is to make sure the cached items are updated if needed
-  refreshCache();
+  tesseract_environment::Environment::Ptr t;
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    if (!cache_.empty())
+    {
+      t = cache_.back();
+      cache_.pop_back();
+    }
+  }
+  requestRefill();
+
+  // The leased environment is no longer in the cache so it is updated without holding the lock
+  if (t != nullptr && !updateEnvironment(*t))
+  {
+    CONSOLE_BRIDGE_logDebug("ProcessEnvironmentCache: Failed to update cached environment, removing from cache!");
+    t = nullptr;
+  }
 
+  // The cache is exhausted so clone one
+  if (t == nullptr)
+  {
+    CONSOLE_BRIDGE_logDebug("ProcessEnvironmentCache: Cache is empty, cloning environment!");
+    t = env_->clone();
+  }
+
+  // Update to the current joint values
   tesseract_environment::EnvState current_state;
   current_state = *(env_->getCurrentState());
+  t->setState(current_state.joints);
+
+  // The environment is returned to the cache once all references to the lease are released
+  int lease_revision = t->getRevision();
+  std::weak_ptr<ProcessEnvironmentCache> weak_this = weak_from_this();
+  return tesseract_environment::Environment::Ptr(
+      t.get(), [weak_this, lease_revision, t](tesseract_environment::Environment* /*env*/) mutable {
+        if (auto cache = weak_this.lock())
+          cache->returnCachedEnvironment(std::move(t), lease_revision);
+
+        t = nullptr;
+      });
+}
+
+bool ProcessEnvironmentCache::updateEnvironment(tesseract_environment::Environment& env) const
+{
+  int rev = env_->getRevision();
+  int env_rev = env.getRevision();
+  if (env_rev == rev)
+    return true;
+
+  if (env_rev > rev)
+    return false;
+
+  tesseract_environment::Commands history = env_->getCommandHistory();
+  if (static_cast<std::size_t>(rev) != history.size())
+    return false;
+
+  tesseract_environment::Commands delta(history.begin() + env_rev, history.end());
+  return env.applyCommands(delta);
+}
 
+void ProcessEnvironmentCache::returnCachedEnvironment(tesseract_environment::Environment::Ptr env, int lease_revision)
+{
+  // Commands were applied to the environment while it was leased so it no longer matches the source history
+  if (env->getRevision() != lease_revision)
+    return;
+
+  // A returned environment is leased next, replacing the oldest clone of the refill thread if the cache is full
   std::unique_lock<std::shared_mutex> lock(cache_mutex_);
-  tesseract_environment::Environment::Ptr t = cache_.back();
+  cache_.push_back(std::move(env));
+  while (cache_.size() > cache_size_)
+    cache_.pop_front();
+}
 
-  // Update to the current joint values
-  t->setState(current_state.joints);
+void ProcessEnvironmentCache::requestRefill()
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    refill_requested_ = true;
+  }
+  refill_cv_.notify_one();
+}
+
+void ProcessEnvironmentCache::refillLoop()
+{
+  while (true)
+  {
+    {
+      std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+      refill_cv_.wait(lock, [this]() { return refill_stop_ || refill_requested_; });
+      if (refill_stop_)
+        return;
 
-  cache_.pop_back();
+      refill_requested_ = false;
+    }
 
-  return t;
+    refreshCache();
+  }
 }
 }  // namespace tesseract_planning
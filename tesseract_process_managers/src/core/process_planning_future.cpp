@@ -30,12 +30,14 @@ namespace tesseract_planning
 void ProcessPlanningFuture::clear()
 {
   interface = nullptr;
+  metrics = nullptr;
   input = nullptr;
   results = nullptr;
   global_manip_info = nullptr;
   plan_profile_remapping = nullptr;
   composite_profile_remapping = nullptr;
   taskflow_container.clear();
+  cached_taskflow = nullptr;
 }
 
 bool ProcessPlanningFuture::ready() const
@@ -55,4 +57,11 @@ ProcessPlanningFuture::waitUntil(const std::chrono::time_point<std::chrono::high
 {
   return process_future.wait_until(abs);
 }
+
+std::size_t ProcessPlanningFuture::subscribe(SegmentStream::Callback callback) const
+{
+  return interface->getSegmentStream()->subscribe(std::move(callback));
+}
+
+void ProcessPlanningFuture::unsubscribe(std::size_t id) const { interface->getSegmentStream()->unsubscribe(id); }
 }  // namespace tesseract_planning
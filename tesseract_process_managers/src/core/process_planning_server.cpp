@@ -27,12 +27,15 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/task_info.h>
 #include <tesseract_process_managers/core/process_planning_server.h>
 #include <tesseract_process_managers/core/debug_observer.h>
+#include <tesseract_process_managers/core/taskflow_metrics_observer.h>
 #include <tesseract_process_managers/core/default_process_planners.h>
+#include <tesseract_process_managers/core/utils.h>
 
 #include <tesseract_motion_planners/descartes/profile/descartes_profile.h>
 #include <tesseract_motion_planners/trajopt/profile/trajopt_profile.h>
@@ -50,6 +53,9 @@ ProcessPlanningServer::ProcessPlanningServer(EnvironmentCache::Ptr cache, size_t
 {
   /** @todo Need to figure out if these can associated with an individual run versus global */
   executor_->make_observer<DebugObserver>("ProcessPlanningObserver");
+  metrics_observer_ = executor_->make_observer<TaskflowMetricsObserver>();
+  budget_observer_ = executor_->make_observer<CPUBudgetObserver>();
+  request_queue_ = std::make_shared<RequestQueue>(executor_);
 }
 
 ProcessPlanningServer::ProcessPlanningServer(tesseract_environment::Environment::ConstPtr environment,
@@ -60,6 +66,9 @@ ProcessPlanningServer::ProcessPlanningServer(tesseract_environment::Environment:
 {
   /** @todo Need to figure out if these can associated with an individual run versus global */
   executor_->make_observer<DebugObserver>("ProcessPlanningObserver");
+  metrics_observer_ = executor_->make_observer<TaskflowMetricsObserver>();
+  budget_observer_ = executor_->make_observer<CPUBudgetObserver>();
+  request_queue_ = std::make_shared<RequestQueue>(executor_);
 }
 
 void ProcessPlanningServer::registerProcessPlanner(const std::string& name, TaskflowGenerator::UPtr generator)
@@ -112,39 +121,136 @@ ProcessPlanningFuture ProcessPlanningServer::run(const ProcessPlanningRequest& r
 {
   CONSOLE_BRIDGE_logInform("Tesseract Planning Server Recieved Request!");
   ProcessPlanningFuture response;
-  response.plan_profile_remapping = std::make_unique<const PlannerProfileRemapping>(request.plan_profile_remapping);
-  response.composite_profile_remapping =
-      std::make_unique<const PlannerProfileRemapping>(request.composite_profile_remapping);
+  std::function<void()> on_finished;
+  tf::Taskflow* taskflow = prepareRequest(response, on_finished, request, nullptr, profiles_->getSnapshot());
+  if (taskflow != nullptr)
+    response.process_future = request_queue_->submit(
+        *taskflow, response.interface, request.priority, request.preemptible, std::move(on_finished));
 
-  response.input = std::make_unique<Instruction>(request.instructions);
+  return response;
+}
+
+std::vector<ProcessPlanningFuture> ProcessPlanningServer::runBatch(const std::vector<ProcessPlanningRequest>& requests)
+{
+  CONSOLE_BRIDGE_logInform("Tesseract Planning Server Recieved Batch of %zu Requests!", requests.size());
+  std::vector<ProcessPlanningFuture> responses(requests.size());
+  if (requests.empty())
+    return responses;
+
+  // The requests without an environment state or commands only read the environment, so they share one snapshot
+  // which is leased when the first of them is found
+  tesseract_environment::Environment::Ptr snapshot;
+  ProfileDictionary::ConstPtr profiles = profiles_->getSnapshot();
+
+  std::vector<tf::Taskflow*> taskflows;
+  std::vector<TaskflowInterface::Ptr> interfaces;
+  std::vector<std::function<void()>> on_finished;
+  std::vector<std::size_t> indices;
+  ProcessPlanningPriority priority = ProcessPlanningPriority::LOW;
+  bool preemptible = true;
+  for (std::size_t i = 0; i < requests.size(); ++i)
+  {
+    const ProcessPlanningRequest& request = requests[i];
+    const bool read_only = (request.env_state == nullptr && request.commands.empty());
+    if (read_only && snapshot == nullptr)
+      snapshot = cache_->getCachedEnvironment();
+
+    std::function<void()> callback;
+    tf::Taskflow* taskflow =
+        prepareRequest(responses[i], callback, request, read_only ? snapshot : nullptr, profiles);
+    if (taskflow == nullptr)
+      continue;
+
+    taskflows.push_back(taskflow);
+    interfaces.push_back(responses[i].interface);
+    on_finished.push_back(std::move(callback));
+    indices.push_back(i);
+    priority = std::max(priority, request.priority);
+    preemptible = preemptible && request.preemptible;
+  }
+
+  if (taskflows.empty())
+    return responses;
+
+  std::vector<std::future<void>> futures =
+      request_queue_->submit(taskflows, interfaces, priority, preemptible, on_finished);
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    responses[indices[i]].process_future = std::move(futures[i]);
+
+  return responses;
+}
+
+tf::Taskflow* ProcessPlanningServer::prepareRequest(ProcessPlanningFuture& response,
+                                                    std::function<void()>& on_finished,
+                                                    const ProcessPlanningRequest& request,
+                                                    tesseract_environment::Environment::Ptr env,
+                                                    const ProfileDictionary::ConstPtr& profiles)
+{
+  auto plan_profile_remapping = std::make_shared<PlannerProfileRemapping>(request.plan_profile_remapping);
+  auto composite_profile_remapping = std::make_shared<PlannerProfileRemapping>(request.composite_profile_remapping);
+  response.plan_profile_remapping = plan_profile_remapping;
+  response.composite_profile_remapping = composite_profile_remapping;
+
+  response.input = std::make_shared<Instruction>(request.instructions);
   auto* composite_program = response.input->cast<CompositeInstruction>();
-  ManipulatorInfo mi = composite_program->getManipulatorInfo();
-  response.global_manip_info = std::make_unique<const ManipulatorInfo>(mi);
+  auto global_manip_info = std::make_shared<ManipulatorInfo>(composite_program->getManipulatorInfo());
+  response.global_manip_info = global_manip_info;
 
   bool has_seed{ false };
   if (!isNullInstruction(request.seed))
   {
     has_seed = true;
-    response.results = std::make_unique<Instruction>(request.seed);
+    response.results = std::make_shared<Instruction>(request.seed);
   }
   else
   {
-    response.results = std::make_unique<Instruction>(generateSkeletonSeed(*composite_program));
+    response.results = std::make_shared<Instruction>(generateSkeletonSeed(*composite_program));
   }
 
   auto it = process_planners_.find(request.name);
   if (it == process_planners_.end())
   {
     CONSOLE_BRIDGE_logError("Requested motion Process Pipeline (aka. Taskflow) is not supported!");
-    return response;
+    return nullptr;
   }
 
-  tesseract_environment::Environment::Ptr tc = cache_->getCachedEnvironment();
+  // A generated taskflow is only cached if it owns its environment, since cached taskflows modify its state
+  const bool shared_env = (env != nullptr);
+  tesseract_environment::Environment::ConstPtr source_env = shared_env ? env : cache_->getEnvironment();
+
+  // The taskflow references the environment so it is not reused if commands were applied
+  std::string taskflow_key;
+  CachedTaskflow::Ptr cached_taskflow;
+  if (request.commands.empty() && taskflow_cache_->getCacheSize() > 0 && source_env != nullptr)
+  {
+    taskflow_key = request.name + ";" + std::to_string(has_seed) + ";" + std::to_string(source_env->getRevision()) +
+                   ";" + std::to_string(profiles->getRevision()) + ";" + getProgramStructureKey(*response.input);
+    cached_taskflow = taskflow_cache_->getCachedTaskflow(taskflow_key);
+  }
+
+  // A cached taskflow brings its own environment so one is only leased on a miss
+  tesseract_environment::Environment::Ptr tc;
+  if (cached_taskflow != nullptr)
+  {
+    tc = cached_taskflow->env;
+    if (request.env_state == nullptr)
+      tc->setState(source_env->getCurrentState()->joints);
+  }
+  else
+  {
+    tc = shared_env ? std::move(env) : cache_->getCachedEnvironment();
+  }
 
   // Set the env state if provided
   if (request.env_state != nullptr)
     tc->setState(request.env_state->joints);
 
+  // The request is captured before its program is formatted and its commands are applied
+  RequestRecorder::Ptr recorder = request_recorder_;
+  RequestBundle::Ptr bundle;
+  if (recorder != nullptr)
+    bundle = std::make_shared<RequestBundle>(captureRequestBundle(request, *tc, *profiles));
+
   // This makes sure the Joint and State Waypoints match the same order as the kinematics
   if (formatProgram(*composite_program, *tc))
   {
@@ -154,19 +260,92 @@ ProcessPlanningFuture ProcessPlanningServer::run(const ProcessPlanningRequest& r
   if (!request.commands.empty() && !tc->applyCommands(request.commands))
   {
     CONSOLE_BRIDGE_logInform("Tesseract Planning Server Finished Request!");
-    return response;
+    return nullptr;
+  }
+
+  // An identical request planned with the same profiles and environment returns the cached results immediately
+  std::string result_key;
+  ResultCache::Ptr result_cache = result_cache_;
+  bool result_persistent = (result_cache != nullptr && !result_cache->getDirectory().empty());
+  if (result_cache != nullptr &&
+      getResultCacheKey(result_key, result_persistent, request, *response.input, *response.results, *tc, *profiles) &&
+      result_cache->get(*response.results, result_key, result_persistent))
+  {
+    CONSOLE_BRIDGE_logDebug("Tesseract Planning Server: Returning cached results!");
+    response.interface = std::make_shared<TaskflowInterface>();
+    std::promise<void> promise;
+    response.process_future = promise.get_future();
+    promise.set_value();
+    return nullptr;
   }
 
-  TaskInput task_input(tc,
-                       response.input.get(),
-                       *(response.global_manip_info),
-                       *(response.plan_profile_remapping),
-                       *(response.composite_profile_remapping),
-                       response.results.get(),
-                       has_seed,
-                       profiles_);
-  response.interface = task_input.getTaskInterface();
-  response.taskflow_container = it->second->generateTaskflow(task_input, nullptr, nullptr);
+  tf::Taskflow* taskflow{ nullptr };
+  if (cached_taskflow != nullptr)
+  {
+    CONSOLE_BRIDGE_logDebug("Tesseract Planning Server: Reusing cached taskflow!");
+
+    // Replace the content of the data referenced by the cached taskflow
+    *(cached_taskflow->input) = std::move(*response.input);
+    *(cached_taskflow->results) = std::move(*response.results);
+    *(cached_taskflow->global_manip_info) = std::move(*global_manip_info);
+    *(cached_taskflow->plan_profile_remapping) = std::move(*plan_profile_remapping);
+    *(cached_taskflow->composite_profile_remapping) = std::move(*composite_profile_remapping);
+    cached_taskflow->interface->reset();
+
+    response.input = cached_taskflow->input;
+    response.results = cached_taskflow->results;
+    response.global_manip_info = cached_taskflow->global_manip_info;
+    response.plan_profile_remapping = cached_taskflow->plan_profile_remapping;
+    response.composite_profile_remapping = cached_taskflow->composite_profile_remapping;
+    response.interface = cached_taskflow->interface;
+    response.cached_taskflow = cached_taskflow;
+    taskflow = cached_taskflow->taskflow_container.taskflow.get();
+  }
+  else
+  {
+    TaskInput task_input(tc,
+                         response.input.get(),
+                         *(response.global_manip_info),
+                         *(response.plan_profile_remapping),
+                         *(response.composite_profile_remapping),
+                         response.results.get(),
+                         has_seed,
+                         profiles);
+    response.interface = task_input.getTaskInterface();
+    response.taskflow_container = it->second->generateTaskflow(task_input, nullptr, nullptr);
+    taskflow = response.taskflow_container.taskflow.get();
+
+    if (!taskflow_key.empty() && !shared_env)
+    {
+      cached_taskflow = std::make_shared<CachedTaskflow>();
+      cached_taskflow->key = taskflow_key;
+      cached_taskflow->input = response.input;
+      cached_taskflow->results = response.results;
+      cached_taskflow->global_manip_info = global_manip_info;
+      cached_taskflow->plan_profile_remapping = plan_profile_remapping;
+      cached_taskflow->composite_profile_remapping = composite_profile_remapping;
+      cached_taskflow->env = tc;
+      cached_taskflow->interface = response.interface;
+      cached_taskflow->taskflow_container = std::move(response.taskflow_container);
+      response.cached_taskflow = taskflow_cache_->lease(cached_taskflow);
+    }
+  }
+
+  if (request.timeout > 0)
+  {
+    auto timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(request.timeout));
+    response.interface->setDeadline(std::chrono::steady_clock::now() + timeout);
+  }
+
+  if (request.profile)
+  {
+    response.metrics = std::make_shared<ProcessMetrics>();
+    if (cached_taskflow != nullptr)
+      metrics_observer_->addProcess(cached_taskflow->taskflow_container, response.interface, response.metrics);
+    else
+      metrics_observer_->addProcess(response.taskflow_container, response.interface, response.metrics);
+  }
 
   // Dump taskflow graph before running
   if (console_bridge::getLogLevel() >= console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
@@ -174,17 +353,55 @@ ProcessPlanningFuture ProcessPlanningServer::run(const ProcessPlanningRequest& r
     std::ofstream out_data;
     out_data.open(tesseract_common::getTempPath() + request.name + "-" + tesseract_common::getTimestampString() +
                   ".dot");
-    response.taskflow_container.taskflow->dump(out_data);
+    taskflow->dump(out_data);
     out_data.close();
   }
 
-  response.process_future = executor_->run(*(response.taskflow_container.taskflow));
-  return response;
+  // The results are only cached if the process succeeded
+  if (!result_key.empty())
+  {
+    on_finished = [result_cache,
+                   result_key,
+                   result_persistent,
+                   interface = response.interface,
+                   results = response.results]() {
+      if (interface->isSuccessful())
+        result_cache->put(result_key, *results, result_persistent);
+    };
+  }
+
+  if (bundle != nullptr)
+  {
+    on_finished = [recorder,
+                   bundle,
+                   start = std::chrono::steady_clock::now(),
+                   interface = response.interface,
+                   callback = std::move(on_finished)]() {
+      if (callback)
+        callback();
+
+      bundle->duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      bundle->successful = interface->isSuccessful();
+      recorder->record(*bundle);
+    };
+  }
+
+  return taskflow;
 }
 
 std::future<void> ProcessPlanningServer::run(tf::Taskflow& taskflow) { return executor_->run(taskflow); }
 
-void ProcessPlanningServer::waitForAll() { executor_->wait_for_all(); }
+void ProcessPlanningServer::waitForAll()
+{
+  request_queue_->waitForAll();
+  executor_->wait_for_all();
+}
+
+void ProcessPlanningServer::setTaskflowCacheSize(std::size_t size) { taskflow_cache_->setCacheSize(size); }
+
+std::size_t ProcessPlanningServer::getTaskflowCacheSize() const { return taskflow_cache_->getCacheSize(); }
+
+TaskflowMetricsObserver::ConstPtr ProcessPlanningServer::getTaskflowMetrics() const { return metrics_observer_; }
 
 void ProcessPlanningServer::enableTaskflowProfiling()
 {
@@ -201,6 +418,21 @@ void ProcessPlanningServer::disableTaskflowProfiling()
   }
 }
 
+void ProcessPlanningServer::setResultCache(ResultCache::Ptr cache) { result_cache_ = std::move(cache); }
+
+ResultCache::Ptr ProcessPlanningServer::getResultCache() const { return result_cache_; }
+
+void ProcessPlanningServer::setRequestRecorder(RequestRecorder::Ptr recorder)
+{
+  request_recorder_ = std::move(recorder);
+}
+
+RequestRecorder::Ptr ProcessPlanningServer::getRequestRecorder() const { return request_recorder_; }
+
+RequestQueue::Ptr ProcessPlanningServer::getRequestQueue() { return request_queue_; }
+
+RequestQueue::ConstPtr ProcessPlanningServer::getRequestQueue() const { return request_queue_; }
+
 ProfileDictionary::Ptr ProcessPlanningServer::getProfiles() { return profiles_; }
 
 ProfileDictionary::ConstPtr ProcessPlanningServer::getProfiles() const { return profiles_; }
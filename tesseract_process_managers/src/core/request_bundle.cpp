@@ -0,0 +1,343 @@
+/**
+ * @file request_bundle.cpp
+ * @brief Capture a process planning request so it can be replayed offline
+ *
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <ompl/util/RandomNumbers.h>
+#include <fstream>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/utils.h>
+#include <tesseract_process_managers/core/request_bundle.h>
+#include <tesseract_process_managers/core/text_serialization.h>
+#include <tesseract_motion_planners/trajopt/serialize.h>
+#include <tesseract_motion_planners/trajopt/deserialize.h>
+#include <tesseract_motion_planners/ompl/serialize.h>
+#include <tesseract_motion_planners/ompl/deserialize.h>
+#include <tesseract_motion_planners/descartes/serialize.h>
+#include <tesseract_motion_planners/descartes/deserialize.h>
+
+namespace tesseract_planning
+{
+/** @brief The first line of a bundle file */
+static const std::string BUNDLE_FILE_HEADER = "tesseract_request_bundle 1";
+
+/** @brief Get the xml of the profiles of a type by name */
+template <typename ProfileType>
+static std::map<std::string, std::string> getProfilesXML(const ProfileDictionary& profiles)
+{
+  std::map<std::string, std::string> xml;
+  auto entry = profiles.getProfileEntryPtr<ProfileType>();
+  if (entry == nullptr)
+    return xml;
+
+  for (const auto& profile : *entry)
+    xml[profile.first] = toXMLString(*profile.second);
+
+  return xml;
+}
+
+/** @brief Parse the xml of profiles and add them to a profile dictionary */
+template <typename ProfileType, typename DefaultProfileType>
+static bool addProfilesXML(ProfileDictionary& profiles,
+                           const std::map<std::string, std::string>& xml,
+                           DefaultProfileType (*parse)(const std::string&))
+{
+  for (const auto& profile : xml)
+  {
+    try
+    {
+      profiles.addProfile<ProfileType>(profile.first, std::make_shared<DefaultProfileType>(parse(profile.second)));
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("Failed to parse bundle profile '%s': %s", profile.first.c_str(), e.what());
+      return false;
+    }
+  }
+  return true;
+}
+
+static void writeJoints(std::ostream& os, const std::unordered_map<std::string, double>& joints)
+{
+  // The joints are sorted so the file does not depend on the order of the hash map
+  std::map<std::string, double> sorted(joints.begin(), joints.end());
+  os << sorted.size() << " ";
+  for (const auto& joint : sorted)
+  {
+    serializeString(os, joint.first);
+    serializeDouble(os, joint.second);
+  }
+}
+
+static bool readJoints(std::istream& is, std::unordered_map<std::string, double>& joints)
+{
+  std::size_t size{ 0 };
+  if (!(is >> size))
+    return false;
+
+  joints.clear();
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    std::string name;
+    double value{ 0 };
+    if (!deserializeString(is, name) || !deserializeDouble(is, value))
+      return false;
+
+    joints[name] = value;
+  }
+  return true;
+}
+
+static void writeRemapping(std::ostream& os, const PlannerProfileRemapping& remapping)
+{
+  std::map<std::string, std::map<std::string, std::string>> sorted;
+  for (const auto& planner : remapping)
+    sorted[planner.first].insert(planner.second.begin(), planner.second.end());
+
+  os << sorted.size() << " ";
+  for (const auto& planner : sorted)
+  {
+    serializeString(os, planner.first);
+    os << planner.second.size() << " ";
+    for (const auto& profile : planner.second)
+    {
+      serializeString(os, profile.first);
+      serializeString(os, profile.second);
+    }
+  }
+}
+
+static bool readRemapping(std::istream& is, PlannerProfileRemapping& remapping)
+{
+  std::size_t planner_count{ 0 };
+  if (!(is >> planner_count))
+    return false;
+
+  remapping.clear();
+  for (std::size_t i = 0; i < planner_count; ++i)
+  {
+    std::string planner;
+    std::size_t profile_count{ 0 };
+    if (!deserializeString(is, planner) || !(is >> profile_count))
+      return false;
+
+    auto& profiles = remapping[planner];
+    for (std::size_t j = 0; j < profile_count; ++j)
+    {
+      std::string from, to;
+      if (!deserializeString(is, from) || !deserializeString(is, to))
+        return false;
+
+      profiles[from] = to;
+    }
+  }
+  return true;
+}
+
+static void writeProfiles(std::ostream& os, const std::map<std::string, std::string>& profiles)
+{
+  os << profiles.size() << " ";
+  for (const auto& profile : profiles)
+  {
+    serializeString(os, profile.first);
+    serializeString(os, profile.second);
+  }
+}
+
+static bool readProfiles(std::istream& is, std::map<std::string, std::string>& profiles)
+{
+  std::size_t size{ 0 };
+  if (!(is >> size))
+    return false;
+
+  profiles.clear();
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    std::string name, xml;
+    if (!deserializeString(is, name) || !deserializeString(is, xml))
+      return false;
+
+    profiles[name] = xml;
+  }
+  return true;
+}
+
+RequestBundle captureRequestBundle(const ProcessPlanningRequest& request,
+                                   const tesseract_environment::Environment& env,
+                                   const ProfileDictionary& profiles)
+{
+  RequestBundle bundle;
+  bundle.request = request;
+  bundle.request.commands.clear();
+  bundle.command_count = request.commands.size();
+  bundle.scene_graph_name = env.getSceneGraph()->getName();
+  bundle.environment_revision = env.getRevision();
+  bundle.environment_state = env.getCurrentState()->joints;
+  bundle.profiles_revision = profiles.getRevision();
+  bundle.trajopt_plan_profiles = getProfilesXML<TrajOptPlanProfile>(profiles);
+  bundle.trajopt_composite_profiles = getProfilesXML<TrajOptCompositeProfile>(profiles);
+  bundle.ompl_plan_profiles = getProfilesXML<OMPLPlanProfile>(profiles);
+  bundle.descartes_plan_profiles = getProfilesXML<DescartesPlanProfile<double>>(profiles);
+  bundle.ompl_seed = ompl::RNG::getSeed();
+  return bundle;
+}
+
+bool saveRequestBundle(const RequestBundle& bundle, const std::string& file_path)
+{
+  const ProcessPlanningRequest& request = bundle.request;
+  std::stringstream data;
+  data << BUNDLE_FILE_HEADER << "\n";
+  serializeString(data, request.name);
+  if (!serializeInstruction(data, request.instructions) || !serializeInstruction(data, request.seed))
+  {
+    CONSOLE_BRIDGE_logError("Failed to write bundle, the program is not supported: %s", file_path.c_str());
+    return false;
+  }
+
+  data << (request.env_state != nullptr ? 1 : 0) << " ";
+  if (request.env_state != nullptr)
+    writeJoints(data, request.env_state->joints);
+
+  writeRemapping(data, request.plan_profile_remapping);
+  writeRemapping(data, request.composite_profile_remapping);
+  data << (request.profile ? 1 : 0) << " ";
+  serializeDouble(data, request.timeout);
+  data << static_cast<int>(request.priority) << " " << (request.preemptible ? 1 : 0) << " ";
+  data << bundle.command_count << " ";
+
+  serializeString(data, bundle.scene_graph_name);
+  data << bundle.environment_revision << " ";
+  writeJoints(data, bundle.environment_state);
+
+  data << bundle.profiles_revision << " ";
+  writeProfiles(data, bundle.trajopt_plan_profiles);
+  writeProfiles(data, bundle.trajopt_composite_profiles);
+  writeProfiles(data, bundle.ompl_plan_profiles);
+  writeProfiles(data, bundle.descartes_plan_profiles);
+
+  data << bundle.ompl_seed << " ";
+  serializeDouble(data, bundle.duration);
+  data << (bundle.successful ? 1 : 0) << "\n";
+
+  std::ofstream file(file_path, std::ios::trunc);
+  if (!file.is_open() || !(file << data.rdbuf()))
+  {
+    CONSOLE_BRIDGE_logError("Failed to write bundle: %s", file_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool loadRequestBundle(RequestBundle& bundle, const std::string& file_path)
+{
+  std::ifstream file(file_path);
+  std::string header;
+  if (!file.is_open() || !std::getline(file, header) || header != BUNDLE_FILE_HEADER)
+  {
+    CONSOLE_BRIDGE_logError("Failed to read bundle, the file is missing or not a bundle: %s", file_path.c_str());
+    return false;
+  }
+
+  RequestBundle result;
+  ProcessPlanningRequest& request = result.request;
+  int has_env_state{ 0 }, profile{ 0 }, priority{ 0 }, preemptible{ 0 }, successful{ 0 };
+  bool ok = deserializeString(file, request.name) && deserializeInstruction(file, request.instructions) &&
+            deserializeInstruction(file, request.seed) && static_cast<bool>(file >> has_env_state);
+
+  if (ok && has_env_state != 0)
+  {
+    auto env_state = std::make_shared<tesseract_environment::EnvState>();
+    ok = readJoints(file, env_state->joints);
+    request.env_state = env_state;
+  }
+
+  ok = ok && readRemapping(file, request.plan_profile_remapping) &&
+       readRemapping(file, request.composite_profile_remapping) && static_cast<bool>(file >> profile) &&
+       deserializeDouble(file, request.timeout) && static_cast<bool>(file >> priority >> preemptible) &&
+       static_cast<bool>(file >> result.command_count) && deserializeString(file, result.scene_graph_name) &&
+       static_cast<bool>(file >> result.environment_revision) && readJoints(file, result.environment_state) &&
+       static_cast<bool>(file >> result.profiles_revision) && readProfiles(file, result.trajopt_plan_profiles) &&
+       readProfiles(file, result.trajopt_composite_profiles) && readProfiles(file, result.ompl_plan_profiles) &&
+       readProfiles(file, result.descartes_plan_profiles) && static_cast<bool>(file >> result.ompl_seed) &&
+       deserializeDouble(file, result.duration) && static_cast<bool>(file >> successful);
+
+  if (!ok || priority < static_cast<int>(ProcessPlanningPriority::LOW) ||
+      priority > static_cast<int>(ProcessPlanningPriority::HIGH))
+  {
+    CONSOLE_BRIDGE_logError("Failed to read bundle, the file is corrupt: %s", file_path.c_str());
+    return false;
+  }
+
+  request.profile = (profile != 0);
+  request.priority = static_cast<ProcessPlanningPriority>(priority);
+  request.preemptible = (preemptible != 0);
+  result.successful = (successful != 0);
+  bundle = std::move(result);
+  return true;
+}
+
+bool addRequestBundleProfiles(ProfileDictionary& profiles, const RequestBundle& bundle)
+{
+  return (addProfilesXML<TrajOptPlanProfile>(profiles, bundle.trajopt_plan_profiles, trajOptPlanFromXMLString) &&
+          addProfilesXML<TrajOptCompositeProfile>(
+              profiles, bundle.trajopt_composite_profiles, trajOptCompositeFromXMLString) &&
+          addProfilesXML<OMPLPlanProfile>(profiles, bundle.ompl_plan_profiles, omplPlanFromXMLString) &&
+          addProfilesXML<DescartesPlanProfile<double>>(
+              profiles, bundle.descartes_plan_profiles, descartesPlanFromXMLString));
+}
+
+RequestRecorder::RequestRecorder(std::string directory, double min_duration)
+  : directory_(std::move(directory)), min_duration_(min_duration)
+{
+}
+
+std::string RequestRecorder::record(const RequestBundle& bundle)
+{
+  if (bundle.duration < min_duration_)
+    return std::string();
+
+  // The index keeps the names unique when several bundles are written within the same second
+  const std::string file_path = directory_ + "/" + bundle.request.name + "-" + tesseract_common::getTimestampString() +
+                                "-" + std::to_string(index_++) + ".bundle";
+  if (!saveRequestBundle(bundle, file_path))
+    return std::string();
+
+  ++count_;
+  CONSOLE_BRIDGE_logInform("Recorded request taking %f seconds: %s", bundle.duration, file_path.c_str());
+  return file_path;
+}
+
+const std::string& RequestRecorder::getDirectory() const { return directory_; }
+
+double RequestRecorder::getMinDuration() const { return min_duration_; }
+
+std::size_t RequestRecorder::getCount() const { return count_; }
+
+}  // namespace tesseract_planning
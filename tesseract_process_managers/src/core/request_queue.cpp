@@ -0,0 +1,315 @@
+/**
+ * @file request_queue.cpp
+ * @brief Admission control of the process planning requests run by an executor
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+#include <chrono>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/request_queue.h>
+
+namespace tesseract_planning
+{
+RequestQueue::RequestQueue(std::shared_ptr<tf::Executor> executor) : executor_(std::move(executor)) {}
+
+RequestQueue::~RequestQueue() { waitForAll(); }
+
+std::future<void> RequestQueue::submit(tf::Taskflow& taskflow,
+                                       TaskflowInterface::Ptr interface,
+                                       ProcessPlanningPriority priority,
+                                       bool preemptible,
+                                       std::function<void()> on_finished)
+{
+  return std::move(
+      submit({ &taskflow }, { std::move(interface) }, priority, preemptible, { std::move(on_finished) }).front());
+}
+
+std::vector<std::future<void>> RequestQueue::submit(const std::vector<tf::Taskflow*>& taskflows,
+                                                    const std::vector<TaskflowInterface::Ptr>& interfaces,
+                                                    ProcessPlanningPriority priority,
+                                                    bool preemptible,
+                                                    const std::vector<std::function<void()>>& on_finished)
+{
+  assert(taskflows.size() == interfaces.size());
+  assert(on_finished.empty() || taskflows.size() == on_finished.size());
+  auto request = std::make_shared<QueuedRequest>();
+  request->priority = priority;
+  request->preemptible = preemptible;
+  request->interfaces = interfaces;
+  request->on_finished = on_finished;
+  request->on_finished.resize(taskflows.size());
+  request->promises.resize(taskflows.size());
+
+  // The request reports it finished from its last task, so the next requests start without waiting on the future
+  QueuedRequest* request_ptr = request.get();
+  tf::Task finish = request->taskflow.emplace([this, request_ptr]() { finished(*request_ptr); }).name("Finished");
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(taskflows.size());
+  for (std::size_t i = 0; i < taskflows.size(); ++i)
+  {
+    std::promise<void>* promise = &request->promises[i];
+    const std::function<void()>* callback = &request->on_finished[i];
+    futures.push_back(promise->get_future());
+
+    tf::Task process = request->taskflow.composed_of(*taskflows[i]).name(taskflows[i]->name());
+    tf::Task done = request->taskflow.emplace([promise, callback]() {
+      if (*callback)
+        (*callback)();
+
+      promise->set_value();
+    });
+    done.name("Done");
+    process.precede(done);
+    done.precede(finish);
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this]() { return (max_queued_ == 0 || queueDepth() < max_queued_); });
+  queued_[static_cast<std::size_t>(priority)].push_back(std::move(request));
+  dispatch();
+  return futures;
+}
+
+void RequestQueue::waitForAll()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this]() { return (queueDepth() == 0 && inFlight() == 0); });
+  std::list<std::shared_ptr<QueuedRequest>> started = started_;
+  lock.unlock();
+
+  // The executor may still be finishing the taskflows after their last task ran. The futures of resuming the parked
+  // sub-taskflows are no longer modified once the requests finished.
+  for (const auto& request : started)
+  {
+    request->run_future.wait();
+    for (const auto& resumed : request->resumed)
+      resumed.wait();
+  }
+}
+
+void RequestQueue::setMaxInFlight(std::size_t max_in_flight)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_in_flight_ = max_in_flight;
+    dispatch();
+  }
+  changed_.notify_all();
+}
+
+std::size_t RequestQueue::getMaxInFlight() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_in_flight_;
+}
+
+void RequestQueue::setMaxInFlight(ProcessPlanningPriority priority, std::size_t max_in_flight)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_class_in_flight_[static_cast<std::size_t>(priority)] = max_in_flight;
+    dispatch();
+  }
+  changed_.notify_all();
+}
+
+std::size_t RequestQueue::getMaxInFlight(ProcessPlanningPriority priority) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_class_in_flight_[static_cast<std::size_t>(priority)];
+}
+
+void RequestQueue::setMaxQueued(std::size_t max_queued)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_queued_ = max_queued;
+  }
+  changed_.notify_all();
+}
+
+std::size_t RequestQueue::getMaxQueued() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_queued_;
+}
+
+std::size_t RequestQueue::getQueueDepth() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queueDepth();
+}
+
+std::size_t RequestQueue::getQueueDepth(ProcessPlanningPriority priority) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queued_[static_cast<std::size_t>(priority)].size();
+}
+
+std::size_t RequestQueue::getInFlight() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return inFlight();
+}
+
+std::size_t RequestQueue::getInFlight(ProcessPlanningPriority priority) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return in_flight_[static_cast<std::size_t>(priority)];
+}
+
+std::size_t RequestQueue::getPreempted() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::size_t preempted = 0;
+  for (const auto& queue : queued_)
+    for (const auto& request : queue)
+      if (request->preemptible && isPreempted(request->priority))
+        ++preempted;
+
+  for (const auto& request : started_)
+    if (request->preempted)
+      ++preempted;
+
+  return preempted;
+}
+
+void RequestQueue::dispatch()
+{
+  // Release the requests the executor is done with
+  started_.remove_if([this](const std::shared_ptr<QueuedRequest>& request) { return isReleased(*request); });
+
+  start();
+  updatePreemptionGates();
+}
+
+void RequestQueue::start()
+{
+  // Higher priority classes first, a lower class may only use the slots a higher class can not use because of its
+  // own limit. A preemptible request holds the requests of its class behind it while it is preempted, so a class is
+  // started in submission order.
+  for (std::size_t i = PRIORITY_COUNT; i-- > 0;)
+  {
+    std::deque<std::shared_ptr<QueuedRequest>>& queue = queued_[i];
+    while (!queue.empty() && (max_class_in_flight_[i] == 0 || in_flight_[i] < max_class_in_flight_[i]))
+    {
+      if (max_in_flight_ != 0 && inFlight() >= max_in_flight_)
+        return;
+
+      if (queue.front()->preemptible && isPreempted(queue.front()->priority))
+        break;
+
+      std::shared_ptr<QueuedRequest> request = std::move(queue.front());
+      queue.pop_front();
+      ++in_flight_[i];
+      request->run_future = executor_->run(request->taskflow).share();
+      started_.push_back(std::move(request));
+    }
+  }
+}
+
+void RequestQueue::updatePreemptionGates()
+{
+  for (const auto& request : started_)
+  {
+    // The gates of a finished request are opened so its taskflows may be run again
+    bool preempted = (request->preemptible && !request->finished && isPreempted(request->priority));
+    if (preempted == request->preempted)
+      continue;
+
+    request->preempted = preempted;
+    for (const auto& interface : request->interfaces)
+    {
+      if (interface == nullptr)
+        continue;
+
+      PreemptionGate::Ptr gate = interface->getPreemptionGate();
+      if (preempted)
+      {
+        gate->close();
+        continue;
+      }
+
+      std::shared_future<void> resumed = gate->open(*executor_);
+      if (resumed.valid())
+        request->resumed.push_back(std::move(resumed));
+    }
+  }
+}
+
+bool RequestQueue::isReleased(const QueuedRequest& request) const
+{
+  if (request.run_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    return false;
+
+  for (const auto& resumed : request.resumed)
+    if (resumed.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      return false;
+
+  return true;
+}
+
+void RequestQueue::finished(QueuedRequest& request)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --in_flight_[static_cast<std::size_t>(request.priority)];
+    request.finished = true;
+    dispatch();
+  }
+  changed_.notify_all();
+}
+
+bool RequestQueue::isPreempted(ProcessPlanningPriority priority) const
+{
+  for (auto i = static_cast<std::size_t>(priority) + 1; i < PRIORITY_COUNT; ++i)
+    if (in_flight_[i] > 0)
+      return true;
+
+  return false;
+}
+
+std::size_t RequestQueue::queueDepth() const
+{
+  std::size_t depth = 0;
+  for (const auto& queue : queued_)
+    depth += queue.size();
+
+  return depth;
+}
+
+std::size_t RequestQueue::inFlight() const
+{
+  std::size_t in_flight = 0;
+  for (std::size_t count : in_flight_)
+    in_flight += count;
+
+  return in_flight;
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,616 @@
+/**
+ * @file result_cache.cpp
+ * @brief A cache of planning results keyed by the content of the request
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <typeindex>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/result_cache.h>
+#include <tesseract_process_managers/core/text_serialization.h>
+#include <tesseract_process_managers/core/utils.h>
+#include <tesseract_command_language/command_language.h>
+#include <tesseract_geometry/geometries.h>
+#include <tesseract_motion_planners/trajopt/serialize.h>
+#include <tesseract_motion_planners/ompl/serialize.h>
+#include <tesseract_motion_planners/descartes/serialize.h>
+
+namespace tesseract_planning
+{
+/** @brief The first line of the files written to the directory of a cache */
+static const std::string RESULT_FILE_HEADER = "tesseract_result_cache 2";
+
+/** @brief The number of environments and profile dictionaries whose content hashes are remembered */
+static const std::size_t CONTENT_HASH_MEMO_SIZE = 16;
+
+/** @brief The initial value of a 64 bit FNV-1a hash */
+static const std::uint64_t HASH_OFFSET_BASIS = 14695981039346656037ULL;
+
+/** @brief Add a string to a 64 bit FNV-1a hash */
+static void hashString(std::uint64_t& hash, const std::string& data)
+{
+  for (char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+}
+
+/** @brief The 64 bit FNV-1a hash of a string */
+static std::uint64_t hashKey(const std::string& key)
+{
+  std::uint64_t hash = HASH_OFFSET_BASIS;
+  hashString(hash, key);
+  return hash;
+}
+
+/** @brief Write the rotation and translation of a transform */
+static void writeTransform(std::ostream& os, const Eigen::Isometry3d& transform)
+{
+  for (Eigen::Index i = 0; i < 3; ++i)
+    for (Eigen::Index j = 0; j < 4; ++j)
+      serializeDouble(os, transform.matrix()(i, j));
+}
+
+/** @brief Write the content of a geometry, false if its type is not supported */
+static bool writeGeometry(std::ostream& os, const tesseract_geometry::Geometry& geometry)
+{
+  using tesseract_geometry::GeometryType;
+  os << static_cast<int>(geometry.getType()) << " ";
+  switch (geometry.getType())
+  {
+    case GeometryType::SPHERE:
+    {
+      serializeDouble(os, static_cast<const tesseract_geometry::Sphere&>(geometry).getRadius());
+      return true;
+    }
+    case GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(geometry);
+      serializeDouble(os, cylinder.getRadius());
+      serializeDouble(os, cylinder.getLength());
+      return true;
+    }
+    case GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(geometry);
+      serializeDouble(os, capsule.getRadius());
+      serializeDouble(os, capsule.getLength());
+      return true;
+    }
+    case GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(geometry);
+      serializeDouble(os, cone.getRadius());
+      serializeDouble(os, cone.getLength());
+      return true;
+    }
+    case GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(geometry);
+      serializeDouble(os, box.getX());
+      serializeDouble(os, box.getY());
+      serializeDouble(os, box.getZ());
+      return true;
+    }
+    case GeometryType::PLANE:
+    {
+      const auto& plane = static_cast<const tesseract_geometry::Plane&>(geometry);
+      serializeDouble(os, plane.getA());
+      serializeDouble(os, plane.getB());
+      serializeDouble(os, plane.getC());
+      serializeDouble(os, plane.getD());
+      return true;
+    }
+    case GeometryType::MESH:
+    case GeometryType::CONVEX_MESH:
+    case GeometryType::SDF_MESH:
+    {
+      const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(geometry);
+      os << mesh.getVertices()->size() << " ";
+      for (const auto& vertex : *mesh.getVertices())
+        for (Eigen::Index i = 0; i < 3; ++i)
+          serializeDouble(os, vertex(i));
+
+      const Eigen::VectorXi& faces = *mesh.getFaces();
+      os << faces.size() << " ";
+      for (Eigen::Index i = 0; i < faces.size(); ++i)
+        os << faces(i) << " ";
+
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Remembers the content hashes of the last objects they were computed for
+ * @details An object is identified by its address and a revision which changes whenever its content changes. Objects
+ * are only referenced weakly, so a new object at the address of a destroyed one never matches.
+ */
+class ContentHashMemo
+{
+public:
+  /**
+   * @brief Find the hash of an object
+   * @param supported False if the hash could not be computed
+   * @return True if found, otherwise false
+   */
+  bool find(bool& supported, std::uint64_t& hash, const std::shared_ptr<const void>& object, std::size_t revision)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : entries_)
+    {
+      if (entry.revision == revision && entry.object.lock() == object)
+      {
+        supported = entry.supported;
+        hash = entry.hash;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief Remember the hash of an object, forgetting the oldest if the memo is full */
+  void insert(bool supported, std::uint64_t hash, const std::shared_ptr<const void>& object, std::size_t revision)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(), [](const Entry& e) { return e.object.expired(); }),
+                   entries_.end());
+    if (entries_.size() >= CONTENT_HASH_MEMO_SIZE)
+      entries_.pop_front();
+
+    entries_.push_back(Entry{ object, revision, supported, hash });
+  }
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<const void> object;
+    std::size_t revision;
+    bool supported;
+    std::uint64_t hash;
+  };
+
+  std::mutex mutex_;
+  std::deque<Entry> entries_;
+};
+
+/**
+ * @brief Compute a hash of the links, joints and allowed collision matrix of an environment
+ * @return False if the environment has geometry which is not supported, e.g. an octree
+ */
+static bool computeEnvironmentContentHash(std::uint64_t& hash, const tesseract_environment::Environment& env)
+{
+  auto scene_graph = env.getSceneGraph();
+
+  // Everything is sorted by name so the hash does not depend on the order of the scene graph
+  std::map<std::string, tesseract_scene_graph::Link::ConstPtr> links;
+  for (const auto& link : scene_graph->getLinks())
+    links[link->getName()] = link;
+
+  std::map<std::string, tesseract_scene_graph::Joint::ConstPtr> joints;
+  for (const auto& joint : scene_graph->getJoints())
+    joints[joint->getName()] = joint;
+
+  hash = HASH_OFFSET_BASIS;
+  std::stringstream ss;
+  ss << links.size() << " ";
+  for (const auto& link : links)
+  {
+    serializeString(ss, link.first);
+    ss << link.second->collision.size() << " ";
+    for (const auto& collision : link.second->collision)
+    {
+      writeTransform(ss, collision->origin);
+      if (collision->geometry == nullptr || !writeGeometry(ss, *collision->geometry))
+        return false;
+    }
+
+    // Each link is added separately so meshes are not all held in memory at once
+    hashString(hash, ss.str());
+    ss.str("");
+  }
+
+  ss << joints.size() << " ";
+  for (const auto& joint : joints)
+  {
+    serializeString(ss, joint.first);
+    ss << static_cast<int>(joint.second->type) << " ";
+    serializeString(ss, joint.second->parent_link_name);
+    serializeString(ss, joint.second->child_link_name);
+    writeTransform(ss, joint.second->parent_to_joint_origin_transform);
+    for (Eigen::Index i = 0; i < 3; ++i)
+      serializeDouble(ss, joint.second->axis(i));
+
+    ss << (joint.second->limits != nullptr ? 1 : 0) << " ";
+    if (joint.second->limits != nullptr)
+    {
+      serializeDouble(ss, joint.second->limits->lower);
+      serializeDouble(ss, joint.second->limits->upper);
+      serializeDouble(ss, joint.second->limits->velocity);
+    }
+  }
+
+  std::set<std::pair<std::string, std::string>> allowed;
+  for (const auto& entry : scene_graph->getAllowedCollisionMatrix()->getAllAllowedCollisions())
+    allowed.insert(std::minmax(entry.first.first, entry.first.second));
+
+  ss << allowed.size() << " ";
+  for (const auto& pair : allowed)
+  {
+    serializeString(ss, pair.first);
+    serializeString(ss, pair.second);
+  }
+
+  hashString(hash, ss.str());
+  return true;
+}
+
+/** @brief Write the xml of the profiles of a type sorted by name, false if one can not be serialized */
+template <typename ProfileType>
+static bool writeProfilesXML(std::ostream& os, const ProfileDictionary& profiles)
+{
+  std::map<std::string, std::string> xml;
+  auto entry = profiles.getProfileEntryPtr<ProfileType>();
+  if (entry != nullptr)
+  {
+    try
+    {
+      for (const auto& profile : *entry)
+        xml[profile.first] = toXMLString(*profile.second);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logDebug("ResultCache: Failed to serialize profile: %s", e.what());
+      return false;
+    }
+  }
+
+  os << xml.size() << " ";
+  for (const auto& profile : xml)
+  {
+    serializeString(os, profile.first);
+    serializeString(os, profile.second);
+  }
+  return true;
+}
+
+/**
+ * @brief Compute a hash of the serialized profiles
+ * @return False if the profiles have a type which can not be serialized
+ */
+static bool computeProfilesContentHash(std::uint64_t& hash, const ProfileDictionary& profiles)
+{
+  static const std::set<std::type_index> serializable{ std::type_index(typeid(TrajOptPlanProfile)),
+                                                       std::type_index(typeid(TrajOptCompositeProfile)),
+                                                       std::type_index(typeid(OMPLPlanProfile)),
+                                                       std::type_index(typeid(DescartesPlanProfile<double>)) };
+  for (const auto& type : profiles.getProfileEntryTypes())
+  {
+    if (serializable.find(type) == serializable.end())
+      return false;
+  }
+
+  std::stringstream ss;
+  if (!writeProfilesXML<TrajOptPlanProfile>(ss, profiles) || !writeProfilesXML<TrajOptCompositeProfile>(ss, profiles) ||
+      !writeProfilesXML<OMPLPlanProfile>(ss, profiles) || !writeProfilesXML<DescartesPlanProfile<double>>(ss, profiles))
+    return false;
+
+  hash = hashKey(ss.str());
+  return true;
+}
+
+/** @brief Get the hash of computeEnvironmentContentHash, it is only computed once per scene graph and revision */
+static bool getEnvironmentContentHash(std::uint64_t& hash, const tesseract_environment::Environment& env)
+{
+  static ContentHashMemo memo;
+  std::shared_ptr<const void> scene_graph = env.getSceneGraph();
+  const auto revision = static_cast<std::size_t>(env.getRevision());
+  bool supported{ false };
+  if (memo.find(supported, hash, scene_graph, revision))
+    return supported;
+
+  supported = computeEnvironmentContentHash(hash, env);
+  memo.insert(supported, hash, scene_graph, revision);
+  return supported;
+}
+
+/** @brief Get the hash of computeProfilesContentHash, it is only computed once per profiles and revision */
+static bool getProfilesContentHash(std::uint64_t& hash, const ProfileDictionary& profiles)
+{
+  static ContentHashMemo memo;
+  std::shared_ptr<const void> id = profiles.getSnapshotId();
+  const std::size_t revision = profiles.getRevision();
+  bool supported{ false };
+  if (memo.find(supported, hash, id, revision))
+    return supported;
+
+  supported = computeProfilesContentHash(hash, profiles);
+  memo.insert(supported, hash, id, revision);
+  return supported;
+}
+
+ResultCache::ResultCache(std::size_t max_bytes, std::string directory)
+  : max_bytes_(max_bytes), directory_(std::move(directory))
+{
+}
+
+bool ResultCache::get(Instruction& results, const std::string& key, bool persistent)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      results = it->second->results;
+      ++hits_;
+      return true;
+    }
+  }
+
+  // The file is only used if it holds the same key, not just the same hash
+  Instruction file_results{ NullInstruction() };
+  std::string file_key, header;
+  std::ifstream file;
+  if (persistent && !directory_.empty())
+    file.open(getFilePath(key));
+
+  if (!file.is_open() || !std::getline(file, header) || header != RESULT_FILE_HEADER ||
+      !deserializeString(file, file_key) || file_key != key || !deserializeInstruction(file, file_results))
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++misses_;
+    return false;
+  }
+
+  std::string content_key;
+  std::size_t bytes = key.size();
+  if (getProgramContentKey(content_key, file_results))
+    bytes += content_key.size();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  insert(key, file_results, bytes);
+  results = std::move(file_results);
+  ++hits_;
+  return true;
+}
+
+bool ResultCache::put(const std::string& key, const Instruction& results, bool persistent)
+{
+  // The content key is used as the approximate size of the results
+  std::string content_key;
+  if (!getProgramContentKey(content_key, results))
+    return false;
+
+  const std::size_t bytes = key.size() + content_key.size();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (bytes > max_bytes_)
+      return false;
+
+    insert(key, results, bytes);
+  }
+
+  if (!persistent || directory_.empty())
+    return true;
+
+  std::stringstream data;
+  data << RESULT_FILE_HEADER << "\n";
+  serializeString(data, key);
+  if (!serializeInstruction(data, results))
+  {
+    CONSOLE_BRIDGE_logDebug("ResultCache: Results are not supported by the directory, only keeping them in memory");
+    return true;
+  }
+
+  // Write to a temporary file first so a concurrent read never sees a partial file
+  const std::string file_path = getFilePath(key);
+  static std::atomic<std::size_t> tmp_count{ 0 };
+  const std::string tmp_path = file_path + ".tmp" + std::to_string(tmp_count++);
+  std::ofstream file(tmp_path, std::ios::trunc);
+  if (!file.is_open() || !(file << data.rdbuf()))
+  {
+    CONSOLE_BRIDGE_logError("ResultCache: Failed to write file: %s", tmp_path.c_str());
+    return true;
+  }
+  file.close();
+
+  if (std::rename(tmp_path.c_str(), file_path.c_str()) != 0)
+  {
+    CONSOLE_BRIDGE_logError("ResultCache: Failed to write file: %s", file_path.c_str());
+    std::remove(tmp_path.c_str());
+  }
+  return true;
+}
+
+void ResultCache::setMaxBytes(std::size_t max_bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_bytes_ = max_bytes;
+  evict();
+}
+
+std::size_t ResultCache::getMaxBytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_bytes_;
+}
+
+std::size_t ResultCache::getBytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_;
+}
+
+std::size_t ResultCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void ResultCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+const std::string& ResultCache::getDirectory() const { return directory_; }
+
+std::size_t ResultCache::getHits() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+std::size_t ResultCache::getMisses() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+void ResultCache::insert(const std::string& key, const Instruction& results, std::size_t bytes)
+{
+  auto it = index_.find(key);
+  if (it != index_.end())
+  {
+    // The index refers to the key of the entry, so it is removed first
+    auto entry = it->second;
+    bytes_ -= entry->bytes;
+    index_.erase(it);
+    entries_.erase(entry);
+  }
+
+  entries_.push_front(Entry{ key, results, bytes });
+  index_[entries_.front().key] = entries_.begin();
+  bytes_ += bytes;
+  evict();
+}
+
+void ResultCache::evict()
+{
+  while (bytes_ > max_bytes_ && !entries_.empty())
+  {
+    bytes_ -= entries_.back().bytes;
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+std::string ResultCache::getFilePath(const std::string& key) const
+{
+  std::array<char, 17> name{};
+  std::snprintf(name.data(), name.size(), "%016llx", static_cast<unsigned long long>(hashKey(key)));
+  return directory_ + "/" + name.data() + ".result";
+}
+
+bool getResultCacheKey(std::string& key,
+                       bool& persistent,
+                       const ProcessPlanningRequest& request,
+                       const Instruction& program,
+                       const Instruction& seed,
+                       const tesseract_environment::Environment& env,
+                       const ProfileDictionary& profiles)
+{
+  // Commands can not be compared, so requests applying them are never cached
+  if (!request.commands.empty())
+    return false;
+
+  std::string program_key, seed_key;
+  if (!getProgramContentKey(program_key, program) || !getProgramContentKey(seed_key, seed))
+    return false;
+
+  std::stringstream ss;
+  serializeString(ss, request.name);
+  serializeString(ss, program_key);
+  serializeString(ss, seed_key);
+
+  // The remappings are sorted so the key does not depend on the order of the hash maps
+  for (const auto* remapping : { &request.plan_profile_remapping, &request.composite_profile_remapping })
+  {
+    std::map<std::string, std::map<std::string, std::string>> sorted;
+    for (const auto& planner : *remapping)
+      sorted[planner.first].insert(planner.second.begin(), planner.second.end());
+
+    ss << sorted.size() << " ";
+    for (const auto& planner : sorted)
+    {
+      serializeString(ss, planner.first);
+      ss << planner.second.size() << " ";
+      for (const auto& profile : planner.second)
+      {
+        serializeString(ss, profile.first);
+        serializeString(ss, profile.second);
+      }
+    }
+  }
+
+  // The revisions restart in every process, so keys read by other processes hold the content instead
+  std::uint64_t env_hash{ 0 }, profiles_hash{ 0 };
+  if (persistent && (!getEnvironmentContentHash(env_hash, env) || !getProfilesContentHash(profiles_hash, profiles)))
+  {
+    CONSOLE_BRIDGE_logDebug("ResultCache: The environment or profiles are not supported by the directory, only "
+                            "keeping the results in memory");
+    persistent = false;
+  }
+
+  if (persistent)
+    ss << "content " << env_hash << " " << profiles_hash << " ";
+  else
+    ss << "revision " << env.getRevision() << " " << profiles.getRevision() << " ";
+
+  serializeString(ss, env.getSceneGraph()->getName());
+
+  std::map<std::string, double> joints;
+  for (const auto& joint : env.getCurrentState()->joints)
+    joints.insert(joint);
+
+  ss << joints.size() << " ";
+  for (const auto& joint : joints)
+  {
+    serializeString(ss, joint.first);
+    serializeDouble(ss, joint.second);
+  }
+
+  key = ss.str();
+  return true;
+}
+
+}  // namespace tesseract_planning
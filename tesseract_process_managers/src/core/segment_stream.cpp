@@ -0,0 +1,136 @@
+/**
+ * @file segment_stream.cpp
+ * @brief Stream the completed segments of a process in program order
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_process_managers/core/segment_stream.h>
+
+namespace tesseract_planning
+{
+std::size_t SegmentStream::subscribe(Callback callback)
+{
+  std::size_t id{ 0 };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    id = next_id_++;
+    subscribers_[id].callback = std::make_shared<Callback>(std::move(callback));
+  }
+
+  dispatch();
+  return id;
+}
+
+void SegmentStream::unsubscribe(std::size_t id)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  subscribers_.erase(id);
+}
+
+void SegmentStream::complete(std::size_t index, const Instruction& segment, std::size_t parts)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index < segments_.size() || pending_.find(index) != pending_.end())
+      return;
+
+    if (parts > 1)
+    {
+      std::size_t& completed = parts_[index];
+      if (++completed < parts)
+        return;
+
+      parts_.erase(index);
+    }
+
+    pending_.emplace(index, segment);
+
+    // Stream the segments for which every previous segment is complete
+    for (auto it = pending_.begin(); it != pending_.end() && it->first == segments_.size(); it = pending_.erase(it))
+      segments_.push_back(std::move(it->second));
+  }
+
+  dispatch();
+}
+
+void SegmentStream::dispatch()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (dispatching_)
+    return;
+
+  dispatching_ = true;
+  while (true)
+  {
+    // Pass the earliest segment a subscriber has not received, copied so the lock can be released while calling it
+    Subscriber* subscriber{ nullptr };
+    for (auto& s : subscribers_)
+      if (s.second.next < segments_.size() && (subscriber == nullptr || s.second.next < subscriber->next))
+        subscriber = &s.second;
+
+    if (subscriber == nullptr)
+      break;
+
+    std::shared_ptr<Callback> callback = subscriber->callback;
+    std::size_t index = subscriber->next++;
+    Instruction segment = segments_[index];
+    lock.unlock();
+
+    try
+    {
+      (*callback)(index, segment);
+    }
+    catch (...)
+    {
+      lock.lock();
+      dispatching_ = false;
+      throw;
+    }
+
+    lock.lock();
+  }
+  dispatching_ = false;
+}
+
+std::vector<Instruction> SegmentStream::getSegments() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return segments_;
+}
+
+std::size_t SegmentStream::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return segments_.size();
+}
+
+void SegmentStream::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  segments_.clear();
+  pending_.clear();
+  parts_.clear();
+  subscribers_.clear();
+}
+
+}  // namespace tesseract_planning
@@ -48,4 +48,10 @@ std::map<std::size_t, TaskInfo::ConstPtr> TaskInfoContainer::getTaskInfoMap() co
   return task_info_map_;
 }
 
+void TaskInfoContainer::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  task_info_map_.clear();
+}
+
 }  // namespace tesseract_planning
@@ -33,13 +33,41 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_process_managers/core/task_input.h>
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/instruction_type.h>
+#include <tesseract_command_language/plan_instruction.h>
 #include <tesseract_command_language/utils/utils.h>
+#include <tesseract_command_language/utils/get_instruction_utils.h>
 
 namespace tesseract_planning
 {
 static const ManipulatorInfo EMPTY_MANIPULATOR_INFO;
 static const PlannerProfileRemapping EMPTY_PROFILE_MAPPING;
 
+/**
+ * @brief Get the last move instruction of a composite
+ * @details Unlike getLastMoveInstruction this returns the Instruction holding it so it can be returned by reference
+ */
+static const Instruction* getLastMoveInstructionReference(const CompositeInstruction& composite)
+{
+  for (std::size_t i = composite.size(); i-- > 0;)
+  {
+    const Instruction& instruction = composite.at(i);
+    if (isMoveInstruction(instruction))
+      return &instruction;
+
+    if (isCompositeInstruction(instruction))
+    {
+      const Instruction* lmi = getLastMoveInstructionReference(*(instruction.cast_const<CompositeInstruction>()));
+      if (lmi != nullptr)
+        return lmi;
+    }
+  }
+
+  if (composite.hasStartInstruction() && isMoveInstruction(composite.getStartInstruction()))
+    return &(composite.getStartInstruction());
+
+  return nullptr;
+}
+
 TaskInput::TaskInput(tesseract_environment::Environment::ConstPtr env,
                      const Instruction* instruction,
                      const ManipulatorInfo& manip_info,
@@ -110,73 +138,46 @@ TaskInput::TaskInput(tesseract_environment::Environment::ConstPtr env,
 {
 }
 
-TaskInput TaskInput::operator[](std::size_t index)
+TaskInput TaskInput::operator[](std::size_t index) const
 {
   TaskInput pi(*this);
-  pi.instruction_indice_.push_back(index);
+  pi.node_ = std::make_shared<const Node>(node_, index);
 
   return pi;
 }
 
-std::size_t TaskInput::size()
+TaskInput TaskInput::createBranch(Instruction* results) const
 {
-  const Instruction* ci = instruction_;
-  for (const auto& i : instruction_indice_)
-  {
-    if (isCompositeInstruction(*ci))
-    {
-      const auto* composite = ci->cast_const<CompositeInstruction>();
-      ci = &(composite->at(i));
-    }
-    else
-    {
-      return 0;
-    }
-  }
+  TaskInput pi(*this);
+  pi.branch_results_ = results;
+  pi.interface_ = interface_->createBranch();
 
-  if (isCompositeInstruction(*ci))
-  {
-    const auto* composite = ci->cast_const<CompositeInstruction>();
-    return composite->size();
-  }
+  return pi;
+}
+
+std::size_t TaskInput::size() const
+{
+  const Instruction* ci = getInstruction();
+  if (ci != nullptr && isCompositeInstruction(*ci))
+    return ci->cast_const<CompositeInstruction>()->size();
 
   return 0;
 }
 
 const Instruction* TaskInput::getInstruction() const
 {
-  const Instruction* ci = instruction_;
-  for (const auto& i : instruction_indice_)
-  {
-    if (isCompositeInstruction(*ci))
-    {
-      const auto* composite = ci->cast_const<CompositeInstruction>();
-      ci = &(composite->at(i));
-    }
-    else
-    {
-      return nullptr;
-    }
-  }
-  return ci;
+  if (node_ == nullptr)
+    return instruction_;
+
+  return resolveInstruction(*node_);
 }
 
 Instruction* TaskInput::getResults()
 {
-  Instruction* ci = results_;
-  for (const auto& i : instruction_indice_)
-  {
-    if (isCompositeInstruction(*ci))
-    {
-      auto* composite = ci->cast<CompositeInstruction>();
-      ci = &(composite->at(i));
-    }
-    else
-    {
-      return nullptr;
-    }
-  }
-  return ci;
+  if (branch_results_ != nullptr)
+    return branch_results_;
+
+  return resolveResults(node_.get());
 }
 
 TaskflowInterface::Ptr TaskInput::getTaskInterface() { return interface_; }
@@ -185,89 +186,194 @@ bool TaskInput::isAborted() const { return interface_->isAborted(); }
 
 void TaskInput::abort() { interface_->abort(); }
 
+void TaskInput::completeSegment(std::size_t index, std::size_t parts) const
+{
+  if (node_ != nullptr || branch_results_ != nullptr || !isCompositeInstruction(*results_))
+    return;
+
+  const auto* ci = results_->cast_const<CompositeInstruction>();
+  if (index < ci->size())
+    interface_->getSegmentStream()->complete(index, ci->at(index), parts);
+}
+
 void TaskInput::setStartInstruction(Instruction start)
 {
-  start_instruction_ = start;
-  start_instruction_indice_.clear();
+  auto reference = std::make_shared<InstructionReference>();
+  reference->instruction = std::move(start);
+  start_instruction_ = reference;
 }
 
 void TaskInput::setStartInstruction(std::vector<std::size_t> start)
 {
-  start_instruction_indice_ = start;
-  start_instruction_ = NullInstruction();
+  auto reference = std::make_shared<InstructionReference>();
+  reference->indices = std::move(start);
+  start_instruction_ = reference;
 }
 
-Instruction TaskInput::getStartInstruction() const
+void TaskInput::setStartInstructionFromInput(std::vector<std::size_t> start)
 {
-  if (!isNullInstruction(start_instruction_))
-    return start_instruction_;
+  auto reference = std::make_shared<InstructionReference>();
+  reference->indices = std::move(start);
+  reference->from_input = true;
+  start_instruction_ = reference;
+}
 
-  if (start_instruction_indice_.empty())
-    return NullInstruction();
+const Instruction& TaskInput::getStartInstruction() const
+{
+  static const Instruction null_instruction{ NullInstruction() };
+  if (start_instruction_ == nullptr)
+    return null_instruction;
 
-  Instruction* ci = results_;
-  for (const auto& i : start_instruction_indice_)
+  const InstructionReference& start = *start_instruction_;
+  if (!isNullInstruction(start.instruction))
+    return start.instruction;
+
+  if (start.from_input)
   {
-    if (isCompositeInstruction(*ci))
+    // The input instructions do not change while the process runs so the start instruction is only created once
+    const std::size_t generation = interface_->getGeneration();
+    if (start.generation.load(std::memory_order_acquire) == generation)
+      return start.cached;
+
+    std::lock_guard<std::mutex> lock(start.mutex);
+    if (start.generation.load(std::memory_order_relaxed) != generation)
     {
-      auto* composite = ci->cast<CompositeInstruction>();
-      ci = &(composite->at(i));
-    }
-    else
-    {
-      return NullInstruction();
+      start.cached = createStartInstructionFromInput(start.indices);
+      start.generation.store(generation, std::memory_order_release);
     }
+
+    return start.cached;
+  }
+
+  if (start.indices.empty())
+    return null_instruction;
+
+  Instruction* ci = results_;
+  for (const auto& i : start.indices)
+  {
+    if (!isCompositeInstruction(*ci))
+      return null_instruction;
+
+    ci = &(ci->cast<CompositeInstruction>()->at(i));
   }
 
   if (isCompositeInstruction(*ci))
-    return *getLastMoveInstruction(*(ci->cast<CompositeInstruction>()));
+  {
+    const Instruction* lmi = getLastMoveInstructionReference(*(ci->cast_const<CompositeInstruction>()));
+    return (lmi != nullptr) ? *lmi : null_instruction;
+  }
 
   return *ci;
 }
 
 void TaskInput::setEndInstruction(Instruction end)
 {
-  end_instruction_ = end;
-  end_instruction_indice_.clear();
+  auto reference = std::make_shared<InstructionReference>();
+  reference->instruction = std::move(end);
+  end_instruction_ = reference;
 }
 
 void TaskInput::setEndInstruction(std::vector<std::size_t> end)
 {
-  end_instruction_indice_ = end;
-  end_instruction_ = NullInstruction();
+  auto reference = std::make_shared<InstructionReference>();
+  reference->indices = std::move(end);
+  end_instruction_ = reference;
 }
 
-Instruction TaskInput::getEndInstruction() const
+const Instruction& TaskInput::getEndInstruction() const
 {
-  if (!isNullInstruction(end_instruction_))
-    return end_instruction_;
+  static const Instruction null_instruction{ NullInstruction() };
+  if (end_instruction_ == nullptr)
+    return null_instruction;
 
-  if (end_instruction_indice_.empty())
-    return NullInstruction();
+  const InstructionReference& end = *end_instruction_;
+  if (!isNullInstruction(end.instruction))
+    return end.instruction;
+
+  if (end.indices.empty())
+    return null_instruction;
 
   Instruction* ci = results_;
-  for (const auto& i : end_instruction_indice_)
+  for (const auto& i : end.indices)
+  {
+    if (!isCompositeInstruction(*ci))
+      return null_instruction;
+
+    ci = &(ci->cast<CompositeInstruction>()->at(i));
+  }
+
+  if (isCompositeInstruction(*ci))
+    return ci->cast<CompositeInstruction>()->getStartInstruction();
+
+  return *ci;
+}
+
+const Instruction* TaskInput::resolveInstruction(const Node& node) const
+{
+  // Every task resolves its instruction on each call so only a change of generation locks the node
+  const std::size_t generation = interface_->getGeneration();
+  if (node.generation.load(std::memory_order_acquire) == generation)
+    return node.instruction.load(std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(node.mutex);
+  if (node.generation.load(std::memory_order_relaxed) == generation)
+    return node.instruction.load(std::memory_order_relaxed);
+
+  const Instruction* parent = (node.parent == nullptr) ? instruction_ : resolveInstruction(*node.parent);
+  const Instruction* instruction = nullptr;
+  if (parent != nullptr && isCompositeInstruction(*parent))
+    instruction = &(parent->cast_const<CompositeInstruction>()->at(node.index));
+
+  node.instruction.store(instruction, std::memory_order_relaxed);
+  node.generation.store(generation, std::memory_order_release);
+  return instruction;
+}
+
+Instruction TaskInput::createStartInstructionFromInput(const std::vector<std::size_t>& indices) const
+{
+  const Instruction* ci = instruction_;
+  if (indices.empty())
   {
     if (isCompositeInstruction(*ci))
-    {
-      auto* composite = ci->cast<CompositeInstruction>();
-      ci = &(composite->at(i));
-    }
-    else
-    {
+      return ci->cast_const<CompositeInstruction>()->getStartInstruction();
+
+    return NullInstruction();
+  }
+
+  for (const auto& i : indices)
+  {
+    if (!isCompositeInstruction(*ci))
       return NullInstruction();
-    }
+
+    ci = &(ci->cast_const<CompositeInstruction>()->at(i));
   }
 
   if (isCompositeInstruction(*ci))
   {
-    auto* composite = ci->cast<CompositeInstruction>();
-    return composite->getStartInstruction();
+    const auto* li = getLastPlanInstruction(*(ci->cast_const<CompositeInstruction>()));
+    if (li == nullptr)
+      return NullInstruction();
+
+    Instruction start = *li;
+    start.cast<PlanInstruction>()->setPlanType(PlanInstructionType::START);
+    return start;
   }
 
   return *ci;
 }
 
+Instruction* TaskInput::resolveResults(const Node* node) const
+{
+  if (node == nullptr)
+    return results_;
+
+  Instruction* parent = resolveResults(node->parent.get());
+  if (parent == nullptr || !isCompositeInstruction(*parent))
+    return nullptr;
+
+  return &(parent->cast<CompositeInstruction>()->at(node->index));
+}
+
 void TaskInput::addTaskInfo(const TaskInfo::ConstPtr& task_info)
 {
   interface_->getTaskInfoContainer()->addTaskInfo(task_info);
@@ -0,0 +1,100 @@
+/**
+ * @file taskflow_cache.cpp
+ * @brief A cache of generated taskflows which may be re-run
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/taskflow_cache.h>
+
+namespace tesseract_planning
+{
+TaskflowCache::TaskflowCache(std::size_t cache_size) : cache_size_(cache_size) {}
+
+void TaskflowCache::setCacheSize(std::size_t size)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cache_size_ = size;
+  while (cache_.size() > cache_size_)
+    cache_.pop_back();
+}
+
+std::size_t TaskflowCache::getCacheSize() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return cache_size_;
+}
+
+CachedTaskflow::Ptr TaskflowCache::getCachedTaskflow(const std::string& key)
+{
+  CachedTaskflow::Ptr taskflow;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = std::find_if(
+        cache_.begin(), cache_.end(), [&key](const CachedTaskflow::Ptr& cached) { return cached->key == key; });
+    if (it == cache_.end())
+      return nullptr;
+
+    taskflow = *it;
+    cache_.erase(it);
+  }
+
+  return lease(taskflow);
+}
+
+CachedTaskflow::Ptr TaskflowCache::lease(CachedTaskflow::Ptr taskflow)
+{
+  std::weak_ptr<TaskflowCache> weak_this = weak_from_this();
+  return CachedTaskflow::Ptr(taskflow.get(), [weak_this, taskflow](CachedTaskflow* /*cached*/) mutable {
+    if (auto cache = weak_this.lock())
+      cache->returnCachedTaskflow(std::move(taskflow));
+
+    taskflow = nullptr;
+  });
+}
+
+void TaskflowCache::clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cache_.clear();
+}
+
+void TaskflowCache::returnCachedTaskflow(CachedTaskflow::Ptr taskflow)
+{
+  // The data is reused by the next lease so it must not be shared with anything else
+  if (taskflow->input.use_count() > 1 || taskflow->results.use_count() > 1)
+    return;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (cache_size_ == 0)
+    return;
+
+  cache_.push_front(std::move(taskflow));
+  while (cache_.size() > cache_size_)
+    cache_.pop_back();
+}
+}  // namespace tesseract_planning
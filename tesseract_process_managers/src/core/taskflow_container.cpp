@@ -30,7 +30,9 @@ namespace tesseract_planning
 {
 void TaskflowContainer::clear()
 {
-  taskflow->clear();
+  if (taskflow != nullptr)
+    taskflow->clear();
+
   taskflow = nullptr;
   outputs.clear();
 
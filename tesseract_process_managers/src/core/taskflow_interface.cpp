@@ -24,16 +24,82 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_process_managers/core/task_info.h>
 #include <tesseract_process_managers/core/taskflow_interface.h>
 
 namespace tesseract_planning
 {
-bool TaskflowInterface::isAborted() const { return abort_; }
+bool TaskflowInterface::isAborted() const
+{
+  if (abort_->isCancelled())
+    return true;
+
+  // The deadline of the parent is only checked by calling isAborted
+  if (parent_ != nullptr && parent_->isAborted())
+    return true;
+
+  if (deadline_ != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline_)
+  {
+    timed_out_ = true;
+    abort_->cancel();
+    return true;
+  }
+
+  return false;
+}
+
+bool TaskflowInterface::isTimedOut() const { return timed_out_ || (parent_ != nullptr && parent_->isTimedOut()); }
+
+bool TaskflowInterface::isSuccessful() const { return !abort_->isCancelled(); }
+
+void TaskflowInterface::abort() { abort_->cancel(); }
+
+void TaskflowInterface::reset()
+{
+  abort_->reset();
+  timed_out_ = false;
+  if (parent_ != nullptr)
+    return;
+
+  deadline_ = std::chrono::steady_clock::time_point::max();
+  ++generation_;
+  task_infos_->clear();
+  segment_stream_->reset();
+}
+
+TaskflowInterface::Ptr TaskflowInterface::createBranch() const
+{
+  auto branch = std::make_shared<TaskflowInterface>();
+  branch->parent_ = shared_from_this();
+  branch->abort_ = std::make_shared<CancellationToken>(abort_);
+  branch->task_infos_ = task_infos_;
+  branch->segment_stream_ = segment_stream_;
+  branch->preemption_gate_ = preemption_gate_;
+  return branch;
+}
+
+std::size_t TaskflowInterface::getGeneration() const
+{
+  return (parent_ != nullptr) ? parent_->getGeneration() : generation_.load();
+}
+
+SegmentStream::Ptr TaskflowInterface::getSegmentStream() const { return segment_stream_; }
+
+PreemptionGate::Ptr TaskflowInterface::getPreemptionGate() const { return preemption_gate_; }
 
-bool TaskflowInterface::isSuccessful() const { return !abort_; }
+CancellationToken::ConstPtr TaskflowInterface::getCancellationToken() const { return abort_; }
 
-void TaskflowInterface::abort() { abort_ = true; }
+void TaskflowInterface::setDeadline(std::chrono::steady_clock::time_point deadline) { deadline_ = deadline; }
+
+std::chrono::steady_clock::time_point TaskflowInterface::getDeadline() const
+{
+  return (parent_ != nullptr) ? std::min(deadline_, parent_->getDeadline()) : deadline_;
+}
 
 TaskInfo::ConstPtr TaskflowInterface::getTaskInfo(const std::size_t& index) const
 {
@@ -0,0 +1,378 @@
+/**
+ * @file taskflow_metrics_observer.cpp
+ * @brief A taskflow observer recording the timing of each task per process
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/taskflow_metrics_observer.h>
+
+namespace tesseract_planning
+{
+/** @brief Write a string as a quoted JSON string */
+static void writeJSONString(std::ostream& os, const std::string& str)
+{
+  os << '"';
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (c == '\n')
+      os << "\\n";
+    else
+      os << c;
+  }
+  os << '"';
+}
+
+static void writeTimingHistogram(std::ostream& os, const TimingHistogram& histogram)
+{
+  os << "{\"count\":" << histogram.getCount() << ",\"sum\":" << histogram.getSum() << ",\"min\":" << histogram.getMin()
+     << ",\"max\":" << histogram.getMax() << ",\"mean\":" << histogram.getMean()
+     << ",\"p50\":" << histogram.getPercentile(50) << ",\"p90\":" << histogram.getPercentile(90)
+     << ",\"p99\":" << histogram.getPercentile(99) << ",\"buckets\":[";
+
+  // Only the non empty buckets are written as [upper bound, count] pairs, the last bucket has no upper bound
+  bool first = true;
+  const auto& counts = histogram.getBucketCounts();
+  for (std::size_t i = 0; i < counts.size(); ++i)
+  {
+    if (counts[i] == 0)
+      continue;
+
+    if (!first)
+      os << ",";
+    first = false;
+
+    os << "[";
+    if (i + 1 < counts.size())
+      os << TimingHistogram::getBucketUpperBound(i);
+    else
+      os << "null";
+    os << "," << counts[i] << "]";
+  }
+  os << "]}";
+}
+
+void writeTaskTimingHistograms(std::ostream& os, const std::map<std::string, TaskTimingHistograms>& histograms)
+{
+  os << "{";
+  bool first = true;
+  for (const auto& histogram : histograms)
+  {
+    if (!first)
+      os << ",";
+    first = false;
+
+    writeJSONString(os, histogram.first);
+    os << ":{\"queue_wait_time\":";
+    writeTimingHistogram(os, histogram.second.queue_wait_time);
+    os << ",\"wall_time\":";
+    writeTimingHistogram(os, histogram.second.wall_time);
+    os << "}";
+  }
+  os << "}";
+}
+
+void TimingHistogram::add(double seconds)
+{
+  seconds = std::max(seconds, 0.0);
+  const double microseconds = seconds * 1e6;
+  std::size_t index = 0;
+  if (microseconds > 1)
+    index = std::min(static_cast<std::size_t>(std::ceil(std::log2(microseconds))), BUCKET_COUNT - 1);
+
+  ++buckets_[index];
+  min_ = (count_ == 0) ? seconds : std::min(min_, seconds);
+  max_ = (count_ == 0) ? seconds : std::max(max_, seconds);
+  sum_ += seconds;
+  ++count_;
+}
+
+void TimingHistogram::merge(const TimingHistogram& other)
+{
+  if (other.count_ == 0)
+    return;
+
+  for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+    buckets_[i] += other.buckets_[i];
+
+  min_ = (count_ == 0) ? other.min_ : std::min(min_, other.min_);
+  max_ = (count_ == 0) ? other.max_ : std::max(max_, other.max_);
+  sum_ += other.sum_;
+  count_ += other.count_;
+}
+
+std::size_t TimingHistogram::getCount() const { return count_; }
+
+double TimingHistogram::getSum() const { return sum_; }
+
+double TimingHistogram::getMin() const { return min_; }
+
+double TimingHistogram::getMax() const { return max_; }
+
+double TimingHistogram::getMean() const { return (count_ == 0) ? 0 : sum_ / static_cast<double>(count_); }
+
+double TimingHistogram::getPercentile(double percentile) const
+{
+  if (count_ == 0)
+    return 0;
+
+  percentile = std::min(std::max(percentile, 0.0), 100.0);
+  const auto rank = std::max<std::size_t>(
+      1, static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_))));
+
+  std::size_t cumulative = 0;
+  for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+  {
+    cumulative += buckets_[i];
+    if (cumulative >= rank)
+      return std::min(getBucketUpperBound(i), max_);
+  }
+
+  return max_;
+}
+
+const std::array<std::size_t, TimingHistogram::BUCKET_COUNT>& TimingHistogram::getBucketCounts() const
+{
+  return buckets_;
+}
+
+double TimingHistogram::getBucketUpperBound(std::size_t index)
+{
+  if (index + 1 >= BUCKET_COUNT)
+    return std::numeric_limits<double>::infinity();
+
+  return std::ldexp(1e-6, static_cast<int>(index));
+}
+
+void ProcessMetrics::add(const TaskExecutionMetrics& metrics)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  executions_.push_back(metrics);
+  TaskTimingHistograms& histograms = histograms_[metrics.name];
+  histograms.queue_wait_time.add(metrics.queue_wait_time);
+  histograms.wall_time.add(metrics.wall_time);
+}
+
+std::vector<TaskExecutionMetrics> ProcessMetrics::getExecutions() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return executions_;
+}
+
+std::map<std::string, TaskTimingHistograms> ProcessMetrics::getHistograms() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return histograms_;
+}
+
+void ProcessMetrics::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  executions_.clear();
+  histograms_.clear();
+}
+
+void ProcessMetrics::dump(std::ostream& os) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  os << "{\"executions\":[";
+  for (std::size_t i = 0; i < executions_.size(); ++i)
+  {
+    const TaskExecutionMetrics& execution = executions_[i];
+    if (i > 0)
+      os << ",";
+
+    os << "{\"name\":";
+    writeJSONString(os, execution.name);
+    os << ",\"worker\":" << execution.worker << ",\"queue_wait_time\":" << execution.queue_wait_time
+       << ",\"wall_time\":" << execution.wall_time << "}";
+  }
+  os << "],\"histograms\":";
+  writeTaskTimingHistograms(os, histograms_);
+  os << "}";
+}
+
+/** @brief Collect the hash of every task in the container and the containers it composes */
+static void getTaskHashes(std::vector<std::size_t>& hashes, const TaskflowContainer& container)
+{
+  if (container.taskflow != nullptr)
+    container.taskflow->for_each_task([&hashes](tf::Task task) { hashes.push_back(task.hash_value()); });
+
+  for (const auto& child : container.containers)
+    getTaskHashes(hashes, child);
+}
+
+void TaskflowMetricsObserver::addProcess(const TaskflowContainer& container,
+                                         const TaskflowInterface::ConstPtr& interface,
+                                         const ProcessMetrics::Ptr& metrics)
+{
+  auto process = std::make_shared<Process>();
+  process->interface = interface;
+  process->generation = interface->getGeneration();
+  process->metrics = metrics;
+  process->last_event = Clock::now();
+
+  std::vector<std::size_t> hashes;
+  getTaskHashes(hashes, container);
+
+  std::unique_lock<std::shared_mutex> lock(processes_mutex_);
+
+  // Forget the tasks of processes which were destroyed or reset
+  for (auto it = processes_.begin(); it != processes_.end();)
+  {
+    if (isExpired(*it->second))
+      it = processes_.erase(it);
+    else
+      ++it;
+  }
+
+  for (const std::size_t hash : hashes)
+    processes_[hash] = process;
+}
+
+std::map<std::string, TaskTimingHistograms> TaskflowMetricsObserver::getHistograms() const
+{
+  std::map<std::string, TaskTimingHistograms> histograms;
+  for (const auto& worker : histograms_)
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    for (const auto& histogram : worker->histograms)
+    {
+      TaskTimingHistograms& merged = histograms[histogram.first];
+      merged.queue_wait_time.merge(histogram.second.queue_wait_time);
+      merged.wall_time.merge(histogram.second.wall_time);
+    }
+  }
+
+  return histograms;
+}
+
+void TaskflowMetricsObserver::clear()
+{
+  for (auto& worker : histograms_)
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->histograms.clear();
+  }
+}
+
+void TaskflowMetricsObserver::dump(std::ostream& os) const { writeTaskTimingHistograms(os, getHistograms()); }
+
+void TaskflowMetricsObserver::set_up(size_t num_workers)
+{
+  running_.resize(num_workers);
+  histograms_.resize(num_workers);
+  for (auto& worker : histograms_)
+    worker = std::make_unique<WorkerHistograms>();
+}
+
+void TaskflowMetricsObserver::on_entry(size_t w, tf::TaskView tv)
+{
+  RunningTask task;
+  task.start = Clock::now();
+  task.process = findProcess(tv.hash_value());
+  if (task.process != nullptr)
+  {
+    std::lock_guard<std::mutex> lock(task.process->mutex);
+    Clock::time_point ready = task.process->last_event;
+    auto it = task.process->ready_times.find(tv.hash_value());
+    if (it != task.process->ready_times.end())
+    {
+      ready = it->second;
+      task.process->ready_times.erase(it);
+    }
+    task.queue_wait_time = std::max(std::chrono::duration<double>(task.start - ready).count(), 0.0);
+    task.process->last_event = std::max(task.process->last_event, task.start);
+  }
+
+  // Composed taskflows may run nested on the same worker so each worker keeps a stack
+  running_[w].push_back(std::move(task));
+}
+
+void TaskflowMetricsObserver::on_exit(size_t w, tf::TaskView tv)
+{
+  if (running_[w].empty())
+    return;
+
+  RunningTask task = std::move(running_[w].back());
+  running_[w].pop_back();
+
+  Clock::time_point end = Clock::now();
+  TaskExecutionMetrics metrics;
+  metrics.name = tv.name();
+  metrics.worker = w;
+  metrics.queue_wait_time = task.queue_wait_time;
+  metrics.wall_time = std::chrono::duration<double>(end - task.start).count();
+
+  if (task.process != nullptr)
+  {
+    {
+      std::lock_guard<std::mutex> lock(task.process->mutex);
+      tv.for_each_successor([&task, end](tf::TaskView successor) {
+        Clock::time_point& ready = task.process->ready_times[successor.hash_value()];
+        ready = std::max(ready, end);
+      });
+      task.process->last_event = std::max(task.process->last_event, end);
+    }
+
+    if (ProcessMetrics::Ptr process_metrics = task.process->metrics.lock())
+      process_metrics->add(metrics);
+  }
+
+  // Only the worker records into its histograms so the lock is only contended while they are read
+  WorkerHistograms& worker = *histograms_[w];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  TaskTimingHistograms& histograms = worker.histograms[metrics.name];
+  if (task.process != nullptr)
+    histograms.queue_wait_time.add(metrics.queue_wait_time);
+  histograms.wall_time.add(metrics.wall_time);
+}
+
+std::shared_ptr<TaskflowMetricsObserver::Process> TaskflowMetricsObserver::findProcess(std::size_t task_hash) const
+{
+  std::shared_lock<std::shared_mutex> lock(processes_mutex_);
+  auto it = processes_.find(task_hash);
+  if (it == processes_.end() || isExpired(*it->second))
+    return nullptr;
+
+  return it->second;
+}
+
+bool TaskflowMetricsObserver::isExpired(const Process& process)
+{
+  if (process.metrics.expired())
+    return true;
+
+  TaskflowInterface::ConstPtr interface = process.interface.lock();
+  return (interface == nullptr || interface->getGeneration() != process.generation);
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,399 @@
+/**
+ * @file text_serialization.cpp
+ * @brief A plain text serialization of command language programs
+ *
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/core/text_serialization.h>
+#include <tesseract_command_language/command_language.h>
+
+namespace tesseract_planning
+{
+void serializeString(std::ostream& os, const std::string& value) { os << value.size() << ":" << value << " "; }
+
+void serializeDouble(std::ostream& os, double value)
+{
+  std::array<char, 32> buffer{};
+  std::snprintf(buffer.data(), buffer.size(), "%a", value);
+  os << buffer.data() << " ";
+}
+
+static void writeVector(std::ostream& os, const Eigen::Ref<const Eigen::VectorXd>& values)
+{
+  os << values.size() << " ";
+  for (Eigen::Index i = 0; i < values.size(); ++i)
+    serializeDouble(os, values[i]);
+}
+
+static void writeNames(std::ostream& os, const std::vector<std::string>& names)
+{
+  os << names.size() << " ";
+  for (const auto& name : names)
+    serializeString(os, name);
+}
+
+static void writeTransform(std::ostream& os, const Eigen::Isometry3d& transform)
+{
+  for (Eigen::Index i = 0; i < 16; ++i)
+    serializeDouble(os, transform.matrix().data()[i]);
+}
+
+static bool writeManipulatorInfo(std::ostream& os, const ManipulatorInfo& info)
+{
+  if (info.tcp.isExternal())
+    return false;
+
+  serializeString(os, info.manipulator);
+  serializeString(os, info.manipulator_ik_solver);
+  serializeString(os, info.working_frame);
+  if (info.tcp.isString())
+  {
+    os << "S ";
+    serializeString(os, info.tcp.getString());
+  }
+  else if (info.tcp.isTransform())
+  {
+    os << "T ";
+    writeTransform(os, info.tcp.getTransform());
+  }
+  else
+  {
+    os << "E ";
+  }
+  return true;
+}
+
+static bool writeWaypoint(std::ostream& os, const Waypoint& waypoint)
+{
+  if (isCartesianWaypoint(waypoint))
+  {
+    const auto* cwp = waypoint.cast_const<CartesianWaypoint>();
+    os << "C ";
+    writeTransform(os, cwp->waypoint);
+    writeVector(os, cwp->lower_tolerance);
+    writeVector(os, cwp->upper_tolerance);
+    return true;
+  }
+
+  if (isJointWaypoint(waypoint))
+  {
+    const auto* jwp = waypoint.cast_const<JointWaypoint>();
+    os << "J ";
+    writeNames(os, jwp->joint_names);
+    writeVector(os, jwp->waypoint);
+    writeVector(os, jwp->lower_tolerance);
+    writeVector(os, jwp->upper_tolerance);
+    return true;
+  }
+
+  if (isStateWaypoint(waypoint))
+  {
+    const auto* swp = waypoint.cast_const<StateWaypoint>();
+    os << "S ";
+    writeNames(os, swp->joint_names);
+    writeVector(os, swp->position);
+    writeVector(os, swp->velocity);
+    writeVector(os, swp->acceleration);
+    return true;
+  }
+
+  return false;
+}
+
+bool serializeInstruction(std::ostream& os, const Instruction& instruction)
+{
+  if (isNullInstruction(instruction))
+  {
+    os << "N ";
+    return true;
+  }
+
+  if (isCompositeInstruction(instruction))
+  {
+    const auto* ci = instruction.cast_const<CompositeInstruction>();
+    os << "C " << static_cast<int>(ci->getOrder()) << " ";
+    serializeString(os, ci->getProfile());
+    serializeString(os, ci->getDescription());
+    if (!writeManipulatorInfo(os, ci->getManipulatorInfo()))
+      return false;
+
+    os << (ci->hasStartInstruction() ? 1 : 0) << " ";
+    if (ci->hasStartInstruction() && !serializeInstruction(os, ci->getStartInstruction()))
+      return false;
+
+    os << ci->size() << " ";
+    for (const auto& child : *ci)
+      if (!serializeInstruction(os, child))
+        return false;
+
+    return true;
+  }
+
+  if (isPlanInstruction(instruction))
+  {
+    const auto* pi = instruction.cast_const<PlanInstruction>();
+    os << "P " << static_cast<int>(pi->getPlanType()) << " ";
+    serializeString(os, pi->getProfile());
+    serializeString(os, pi->getDescription());
+    return (writeManipulatorInfo(os, pi->getManipulatorInfo()) && writeWaypoint(os, pi->getWaypoint()));
+  }
+
+  if (isMoveInstruction(instruction))
+  {
+    const auto* mi = instruction.cast_const<MoveInstruction>();
+    os << "M " << static_cast<int>(mi->getMoveType()) << " ";
+    serializeString(os, mi->getProfile());
+    serializeString(os, mi->getDescription());
+    return (writeManipulatorInfo(os, mi->getManipulatorInfo()) && writeWaypoint(os, mi->getWaypoint()));
+  }
+
+  return false;
+}
+
+bool deserializeString(std::istream& is, std::string& value)
+{
+  std::size_t size{ 0 };
+  if (!(is >> size) || is.get() != ':')
+    return false;
+
+  value.resize(size);
+  return (size == 0 || static_cast<bool>(is.read(&value[0], static_cast<std::streamsize>(size))));
+}
+
+bool deserializeDouble(std::istream& is, double& value)
+{
+  std::string token;
+  if (!(is >> token))
+    return false;
+
+  char* end{ nullptr };
+  value = std::strtod(token.c_str(), &end);
+  return (end == token.c_str() + token.size());
+}
+
+static bool readVector(std::istream& is, Eigen::VectorXd& values)
+{
+  long size{ 0 };
+  if (!(is >> size) || size < 0)
+    return false;
+
+  values.resize(size);
+  for (long i = 0; i < size; ++i)
+    if (!deserializeDouble(is, values[i]))
+      return false;
+
+  return true;
+}
+
+static bool readNames(std::istream& is, std::vector<std::string>& names)
+{
+  std::size_t size{ 0 };
+  if (!(is >> size))
+    return false;
+
+  names.resize(size);
+  for (auto& name : names)
+    if (!deserializeString(is, name))
+      return false;
+
+  return true;
+}
+
+static bool readTransform(std::istream& is, Eigen::Isometry3d& transform)
+{
+  for (Eigen::Index i = 0; i < 16; ++i)
+    if (!deserializeDouble(is, transform.matrix().data()[i]))
+      return false;
+
+  return true;
+}
+
+static bool readManipulatorInfo(std::istream& is, ManipulatorInfo& info)
+{
+  std::string tcp_type;
+  if (!deserializeString(is, info.manipulator) || !deserializeString(is, info.manipulator_ik_solver) ||
+      !deserializeString(is, info.working_frame) || !(is >> tcp_type))
+    return false;
+
+  if (tcp_type == "S")
+  {
+    std::string name;
+    if (!deserializeString(is, name))
+      return false;
+
+    info.tcp = ToolCenterPoint(name);
+  }
+  else if (tcp_type == "T")
+  {
+    Eigen::Isometry3d transform;
+    if (!readTransform(is, transform))
+      return false;
+
+    info.tcp = ToolCenterPoint(transform);
+  }
+  else if (tcp_type != "E")
+  {
+    return false;
+  }
+  return true;
+}
+
+static bool readWaypoint(std::istream& is, Waypoint& waypoint)
+{
+  std::string type;
+  if (!(is >> type))
+    return false;
+
+  if (type == "C")
+  {
+    Eigen::Isometry3d transform;
+    Eigen::VectorXd lower_tolerance, upper_tolerance;
+    if (!readTransform(is, transform) || !readVector(is, lower_tolerance) || !readVector(is, upper_tolerance))
+      return false;
+
+    CartesianWaypoint cwp(transform);
+    cwp.lower_tolerance = lower_tolerance;
+    cwp.upper_tolerance = upper_tolerance;
+    waypoint = cwp;
+    return true;
+  }
+
+  if (type == "J")
+  {
+    std::vector<std::string> joint_names;
+    Eigen::VectorXd values, lower_tolerance, upper_tolerance;
+    if (!readNames(is, joint_names) || !readVector(is, values) || !readVector(is, lower_tolerance) ||
+        !readVector(is, upper_tolerance))
+      return false;
+
+    JointWaypoint jwp(joint_names, values);
+    jwp.lower_tolerance = lower_tolerance;
+    jwp.upper_tolerance = upper_tolerance;
+    waypoint = jwp;
+    return true;
+  }
+
+  if (type == "S")
+  {
+    std::vector<std::string> joint_names;
+    Eigen::VectorXd position, velocity, acceleration;
+    if (!readNames(is, joint_names) || !readVector(is, position) || !readVector(is, velocity) ||
+        !readVector(is, acceleration))
+      return false;
+
+    StateWaypoint swp(joint_names, position);
+    swp.velocity = velocity;
+    swp.acceleration = acceleration;
+    waypoint = swp;
+    return true;
+  }
+
+  return false;
+}
+
+bool deserializeInstruction(std::istream& is, Instruction& instruction)
+{
+  std::string type;
+  if (!(is >> type))
+    return false;
+
+  if (type == "N")
+  {
+    instruction = NullInstruction();
+    return true;
+  }
+
+  int sub_type{ 0 };
+  std::string profile, description;
+  ManipulatorInfo info;
+  if (!(is >> sub_type) || !deserializeString(is, profile) || !deserializeString(is, description) ||
+      !readManipulatorInfo(is, info))
+    return false;
+
+  if (type == "C")
+  {
+    CompositeInstruction ci(profile, static_cast<CompositeInstructionOrder>(sub_type), info);
+    ci.setDescription(description);
+
+    int has_start{ 0 };
+    if (!(is >> has_start))
+      return false;
+
+    if (has_start != 0)
+    {
+      Instruction start{ NullInstruction() };
+      if (!deserializeInstruction(is, start))
+        return false;
+
+      ci.setStartInstruction(start);
+    }
+
+    std::size_t size{ 0 };
+    if (!(is >> size))
+      return false;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      Instruction child{ NullInstruction() };
+      if (!deserializeInstruction(is, child))
+        return false;
+
+      ci.push_back(child);
+    }
+
+    instruction = ci;
+    return true;
+  }
+
+  Waypoint waypoint{ NullWaypoint() };
+  if (!readWaypoint(is, waypoint))
+    return false;
+
+  if (type == "P")
+  {
+    PlanInstruction pi(waypoint, static_cast<PlanInstructionType>(sub_type), profile, info);
+    pi.setDescription(description);
+    instruction = pi;
+    return true;
+  }
+
+  if (type == "M")
+  {
+    MoveInstruction mi(waypoint, static_cast<MoveInstructionType>(sub_type), profile, info);
+    mi.setDescription(description);
+    instruction = mi;
+    return true;
+  }
+
+  return false;
+}
+
+}  // namespace tesseract_planning
@@ -25,7 +25,17 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <cstdio>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_process_managers/core/utils.h>
+#include <tesseract_command_language/instruction_type.h>
+#include <tesseract_command_language/plan_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/command_language.h>
 
 namespace tesseract_planning
 {
@@ -39,6 +49,17 @@ void successTask(const TaskInput& /*instruction*/,
     user_callback();
 }
 
+void successTask(const TaskInput& input,
+                 std::size_t segment,
+                 std::size_t parts,
+                 const std::string& name,
+                 const std::string& message,
+                 const TaskflowVoidFn& user_callback)
+{
+  input.completeSegment(segment, parts);
+  successTask(input, name, message, user_callback);
+}
+
 void failureTask(TaskInput instruction,
                  const std::string& name,
                  const std::string& message,
@@ -88,4 +109,219 @@ int hasSeedTask(TaskInput input)
   }
   return 1;
 }
+
+/** @brief Strings are prefixed by their length so they may contain any character */
+static void appendContentKey(std::string& key, const std::string& value)
+{
+  key += std::to_string(value.size()) + ":" + value;
+}
+
+/** @brief Doubles are written in hexadecimal so they are exact */
+static void appendContentKey(std::string& key, double value)
+{
+  std::array<char, 32> buffer{};
+  std::snprintf(buffer.data(), buffer.size(), "%a,", value);
+  key += buffer.data();
+}
+
+static void appendContentKey(std::string& key, const Eigen::Ref<const Eigen::VectorXd>& values)
+{
+  key += "V" + std::to_string(values.size()) + "(";
+  for (Eigen::Index i = 0; i < values.size(); ++i)
+    appendContentKey(key, values[i]);
+  key += ")";
+}
+
+static void appendContentKey(std::string& key, const std::vector<std::string>& values)
+{
+  key += "S" + std::to_string(values.size()) + "(";
+  for (const auto& value : values)
+    appendContentKey(key, value);
+  key += ")";
+}
+
+static void appendContentKey(std::string& key, const Eigen::Isometry3d& transform)
+{
+  key += "T(";
+  for (Eigen::Index i = 0; i < 16; ++i)
+    appendContentKey(key, transform.matrix().data()[i]);
+  key += ")";
+}
+
+static void appendContentKey(std::string& key, const ManipulatorInfo& info)
+{
+  key += "MI(";
+  appendContentKey(key, info.manipulator);
+  appendContentKey(key, info.manipulator_ik_solver);
+  appendContentKey(key, info.working_frame);
+  if (info.tcp.isString())
+  {
+    key += "S";
+    appendContentKey(key, info.tcp.getString());
+  }
+  else if (info.tcp.isTransform())
+  {
+    appendContentKey(key, info.tcp.getTransform());
+  }
+
+  if (info.tcp.isExternal())
+  {
+    key += "E";
+    appendContentKey(key, info.tcp.getExternalFrame());
+  }
+  key += ")";
+}
+
+/** @brief Only the waypoint type is part of the structure, the waypoint values are not */
+static void appendWaypointTypeKey(std::string& key, const Waypoint& waypoint)
+{
+  if (isCartesianWaypoint(waypoint))
+    key += "c";
+  else if (isJointWaypoint(waypoint))
+    key += "j";
+  else if (isStateWaypoint(waypoint))
+    key += "s";
+  else
+    key += "w" + std::to_string(waypoint.getType());
+}
+
+static void appendProgramStructureKey(std::string& key, const Instruction& instruction)
+{
+  if (isCompositeInstruction(instruction))
+  {
+    const auto* composite = instruction.cast_const<CompositeInstruction>();
+    key += "C";
+    appendContentKey(key, composite->getProfile());
+    appendContentKey(key, composite->getManipulatorInfo());
+    if (composite->hasStartInstruction())
+      appendProgramStructureKey(key, composite->getStartInstruction());
+
+    key += "[";
+    for (const auto& i : *composite)
+      appendProgramStructureKey(key, i);
+    key += "]";
+  }
+  else if (isPlanInstruction(instruction))
+  {
+    const auto* pi = instruction.cast_const<PlanInstruction>();
+    key += "P" + std::to_string(static_cast<int>(pi->getPlanType()));
+    appendContentKey(key, pi->getProfile());
+    appendWaypointTypeKey(key, pi->getWaypoint());
+    appendContentKey(key, pi->getManipulatorInfo());
+  }
+  else if (isMoveInstruction(instruction))
+  {
+    const auto* mi = instruction.cast_const<MoveInstruction>();
+    key += "M" + std::to_string(static_cast<int>(mi->getMoveType()));
+    appendContentKey(key, mi->getProfile());
+    appendWaypointTypeKey(key, mi->getWaypoint());
+    appendContentKey(key, mi->getManipulatorInfo());
+  }
+  else
+  {
+    key += "I" + std::to_string(instruction.getType());
+  }
+}
+
+std::string getProgramStructureKey(const Instruction& instruction)
+{
+  std::string key;
+  appendProgramStructureKey(key, instruction);
+  return key;
+}
+
+static bool appendContentKey(std::string& key, const Waypoint& waypoint)
+{
+  if (isCartesianWaypoint(waypoint))
+  {
+    const auto* cwp = waypoint.cast_const<CartesianWaypoint>();
+    key += "CW(";
+    appendContentKey(key, cwp->waypoint);
+    appendContentKey(key, cwp->lower_tolerance);
+    appendContentKey(key, cwp->upper_tolerance);
+  }
+  else if (isJointWaypoint(waypoint))
+  {
+    const auto* jwp = waypoint.cast_const<JointWaypoint>();
+    key += "JW(";
+    appendContentKey(key, jwp->joint_names);
+    appendContentKey(key, jwp->waypoint);
+    appendContentKey(key, jwp->lower_tolerance);
+    appendContentKey(key, jwp->upper_tolerance);
+  }
+  else if (isStateWaypoint(waypoint))
+  {
+    const auto* swp = waypoint.cast_const<StateWaypoint>();
+    key += "SW(";
+    appendContentKey(key, swp->joint_names);
+    appendContentKey(key, swp->position);
+    appendContentKey(key, swp->velocity);
+    appendContentKey(key, swp->acceleration);
+  }
+  else
+  {
+    return false;
+  }
+
+  key += ")";
+  return true;
+}
+
+static bool appendProgramContentKey(std::string& key, const Instruction& instruction)
+{
+  if (isCompositeInstruction(instruction))
+  {
+    const auto* composite = instruction.cast_const<CompositeInstruction>();
+    key += "C" + std::to_string(static_cast<int>(composite->getOrder())) + "(";
+    appendContentKey(key, composite->getProfile());
+    appendContentKey(key, composite->getDescription());
+    appendContentKey(key, composite->getManipulatorInfo());
+    if (composite->hasStartInstruction() && !appendProgramContentKey(key, composite->getStartInstruction()))
+      return false;
+
+    key += "[";
+    for (const auto& i : *composite)
+      if (!appendProgramContentKey(key, i))
+        return false;
+    key += "])";
+  }
+  else if (isPlanInstruction(instruction))
+  {
+    const auto* pi = instruction.cast_const<PlanInstruction>();
+    key += "P" + std::to_string(static_cast<int>(pi->getPlanType())) + "(";
+    appendContentKey(key, pi->getProfile());
+    appendContentKey(key, pi->getDescription());
+    appendContentKey(key, pi->getManipulatorInfo());
+    if (!appendContentKey(key, pi->getWaypoint()))
+      return false;
+    key += ")";
+  }
+  else if (isMoveInstruction(instruction))
+  {
+    const auto* mi = instruction.cast_const<MoveInstruction>();
+    key += "M" + std::to_string(static_cast<int>(mi->getMoveType())) + "(";
+    appendContentKey(key, mi->getProfile());
+    appendContentKey(key, mi->getDescription());
+    appendContentKey(key, mi->getManipulatorInfo());
+    if (!appendContentKey(key, mi->getWaypoint()))
+      return false;
+    key += ")";
+  }
+  else if (isNullInstruction(instruction))
+  {
+    key += "N";
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool getProgramContentKey(std::string& key, const Instruction& instruction)
+{
+  key.clear();
+  return appendProgramContentKey(key, instruction);
+}
 }  // namespace tesseract_planning
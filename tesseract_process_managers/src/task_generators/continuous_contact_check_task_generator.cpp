@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_process_managers/task_generators/continuous_contact_check_task_generator.h>
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 
 namespace tesseract_planning
 {
@@ -84,21 +85,12 @@ int ContinuousContactCheckTaskGenerator::conditionalProcess(TaskInput input, std
   manager->setCollisionMarginData(config.collision_margin_data);
 
   // Set the active links based on the manipulator
-  std::vector<std::string> active_links_manip;
-  {
-    tesseract_environment::AdjacencyMap::Ptr adjacency_map_manip =
-        std::make_shared<tesseract_environment::AdjacencyMap>(input.env->getSceneGraph(),
-                                                              input.env->getManipulatorManager()
-                                                                  ->getFwdKinematicSolver(input.manip_info.manipulator)
-                                                                  ->getActiveLinkNames(),
-                                                              input.env->getCurrentState()->link_transforms);
-    active_links_manip = adjacency_map_manip->getActiveLinkNames();
-  }
-  manager->setActiveCollisionObjects(active_links_manip);
+  auto fwd_kin = input.env->getManipulatorManager()->getFwdKinematicSolver(input.manip_info.manipulator);
+  manager->setActiveCollisionObjects(KinematicMetadataCache::get(*input.env, *fwd_kin)->active_link_names);
 
   const auto* ci = input_results->cast_const<CompositeInstruction>();
   std::vector<tesseract_collision::ContactResultMap> contacts;
-  if (contactCheckProgram(contacts, *manager, *state_solver, *ci, config))
+  if (contactCheckProgram(contacts, *manager, *state_solver, *ci, config, num_threads))
   {
     CONSOLE_BRIDGE_logInform("Results are not contact free for process input: %s!",
                              input_results->getDescription().c_str());
@@ -0,0 +1,137 @@
+/**
+ * @file experience_record_task_generator.cpp
+ * @brief Record a planned freespace motion in an experience library
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/task_generators/experience_record_task_generator.h>
+#include <tesseract_command_language/command_language.h>
+
+namespace tesseract_planning
+{
+ExperienceRecordTaskGenerator::ExperienceRecordTaskGenerator(ExperienceLibrary::Ptr library, std::string name)
+  : TaskGenerator(std::move(name)), library_(std::move(library))
+{
+}
+
+int ExperienceRecordTaskGenerator::conditionalProcess(TaskInput input, std::size_t unique_id) const
+{
+  if (input.isAborted())
+    return 0;
+
+  auto info = std::make_shared<ExperienceRecordTaskInfo>(unique_id, name_);
+  info->return_value = 0;
+  input.addTaskInfo(info);
+
+  // --------------------
+  // Check that inputs are valid
+  // --------------------
+  Instruction* input_results = input.getResults();
+  if (!isCompositeInstruction(*input_results))
+  {
+    info->message = "Input results to ExperienceRecordTaskGenerator must be a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return 0;
+  }
+
+  // Results which can not be used by the ExperienceSeedTaskGenerator are skipped
+  info->return_value = 1;
+  const auto* ci = input_results->cast_const<CompositeInstruction>();
+  Eigen::VectorXd start;
+  if (ci->size() != 1 || !isCompositeInstruction(ci->at(0)) ||
+      !getExperienceStart(start, *ci, input.getStartInstruction()))
+  {
+    info->message = "ExperienceRecordTaskGenerator only records single segment results starting from a joint state";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 1;
+  }
+
+  const ManipulatorInfo manip_info = ci->getManipulatorInfo().getCombined(input.manip_info);
+  auto fwd_kin = input.env->getManipulatorManager()->getFwdKinematicSolver(manip_info.manipulator);
+  if (fwd_kin == nullptr)
+  {
+    info->message = "ExperienceRecordTaskGenerator failed to get the kinematics of manipulator: " +
+                    manip_info.manipulator;
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 1;
+  }
+
+  const auto* segment = ci->at(0).cast_const<CompositeInstruction>();
+  const auto dof = static_cast<long>(fwd_kin->numJoints());
+
+  if (start.size() != dof)
+  {
+    info->message = "ExperienceRecordTaskGenerator start state does not match the manipulator";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 1;
+  }
+
+  Experience experience;
+  experience.manipulator = manip_info.manipulator;
+  experience.joint_names = fwd_kin->getJointNames();
+  experience.revision = input.env->getRevision();
+  experience.trajectory.resize(static_cast<long>(segment->size()) + 1, dof);
+  experience.trajectory.row(0) = start.transpose();
+
+  long row = 1;
+  for (const Instruction& instruction : *segment)
+  {
+    if (!isMoveInstruction(instruction) ||
+        !isStateWaypoint(instruction.cast_const<MoveInstruction>()->getWaypoint()) ||
+        instruction.cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>()->position.size() != dof)
+    {
+      info->message = "ExperienceRecordTaskGenerator only records results of state waypoints";
+      CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+      return 1;
+    }
+
+    const auto* swp = instruction.cast_const<MoveInstruction>()->getWaypoint().cast_const<StateWaypoint>();
+    experience.trajectory.row(row++) = swp->position.transpose();
+  }
+
+  if (!library_->add(std::move(experience)))
+  {
+    info->message = "ExperienceRecordTaskGenerator results are not a valid experience";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 1;
+  }
+
+  CONSOLE_BRIDGE_logDebug("Experience record succeeded");
+  return 1;
+}
+
+void ExperienceRecordTaskGenerator::process(TaskInput input, std::size_t unique_id) const
+{
+  conditionalProcess(input, unique_id);
+}
+
+ExperienceRecordTaskInfo::ExperienceRecordTaskInfo(std::size_t unique_id, std::string name)
+  : TaskInfo(unique_id, std::move(name))
+{
+}
+}  // namespace tesseract_planning
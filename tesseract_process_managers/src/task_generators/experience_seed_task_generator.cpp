@@ -0,0 +1,207 @@
+/**
+ * @file experience_seed_task_generator.cpp
+ * @brief Seed a freespace motion with a previously planned trajectory
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_process_managers/task_generators/experience_seed_task_generator.h>
+#include <tesseract_command_language/command_language.h>
+#include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Insert states along the segments of a trajectory so it has the requested number of steps
+ * @details The states of the trajectory are kept and the inserted states are spread evenly over its segments
+ * @param trajectory The trajectory
+ * @param steps The number of steps, must not be less than the number of segments of the trajectory
+ * @return The trajectory with steps + 1 states
+ */
+static tesseract_common::TrajArray upsampleTrajectory(const tesseract_common::TrajArray& trajectory, long steps)
+{
+  const long segments = trajectory.rows() - 1;
+  assert(steps >= segments);
+
+  tesseract_common::TrajArray result(steps + 1, trajectory.cols());
+  long row = 0;
+  for (long s = 0; s < segments; ++s)
+  {
+    const long segment_steps = steps / segments + ((s < steps % segments) ? 1 : 0);
+    for (long i = 0; i < segment_steps; ++i)
+    {
+      double t = static_cast<double>(i) / static_cast<double>(segment_steps);
+      result.row(row++) = (1 - t) * trajectory.row(s) + t * trajectory.row(s + 1);
+    }
+  }
+  result.row(row) = trajectory.row(segments);
+
+  return result;
+}
+
+ExperienceSeedTaskGenerator::ExperienceSeedTaskGenerator(ExperienceLibrary::ConstPtr library,
+                                                         double collision_margin,
+                                                         std::string name)
+  : TaskGenerator(std::move(name)), library_(std::move(library))
+{
+  config.type = tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE;
+  config.longest_valid_segment_length = 0.05;
+  config.collision_margin_data = tesseract_collision::CollisionMarginData(collision_margin);
+}
+
+int ExperienceSeedTaskGenerator::conditionalProcess(TaskInput input, std::size_t unique_id) const
+{
+  if (input.isAborted())
+    return 0;
+
+  auto info = std::make_shared<ExperienceSeedTaskInfo>(unique_id, name_);
+  info->return_value = 0;
+  input.addTaskInfo(info);
+
+  // --------------------
+  // Check that inputs are valid
+  // --------------------
+  Instruction* input_results = input.getResults();
+  if (!isCompositeInstruction(*input_results))
+  {
+    info->message = "Input seed to ExperienceSeedTaskGenerator must be a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return 0;
+  }
+
+  // Only single segment motions are seeded since an experience does not pass through intermediate waypoints
+  auto* ci = input_results->cast<CompositeInstruction>();
+  Eigen::VectorXd start;
+  if (ci->size() != 1 || !isCompositeInstruction(ci->at(0)) ||
+      !getExperienceStart(start, *ci, input.getStartInstruction()))
+  {
+    info->message = "ExperienceSeedTaskGenerator only supports single segment seeds starting from a joint state";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 0;
+  }
+
+  const auto* segment = ci->at(0).cast_const<CompositeInstruction>();
+  const MoveInstruction* last_move = getLastMoveInstruction(*segment);
+  if (last_move == nullptr || !isStateWaypoint(last_move->getWaypoint()))
+  {
+    info->message = "ExperienceSeedTaskGenerator requires the seed to end in a state waypoint";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 0;
+  }
+  const Eigen::VectorXd& goal = last_move->getWaypoint().cast_const<StateWaypoint>()->position;
+
+  const ManipulatorInfo manip_info = ci->getManipulatorInfo().getCombined(input.manip_info);
+  auto fwd_kin = input.env->getManipulatorManager()->getFwdKinematicSolver(manip_info.manipulator);
+  if (fwd_kin == nullptr)
+  {
+    info->message = "ExperienceSeedTaskGenerator failed to get the kinematics of manipulator: " +
+                    manip_info.manipulator;
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return 0;
+  }
+
+  const std::vector<std::string>& joint_names = fwd_kin->getJointNames();
+  Experience experience;
+  if (start.size() != goal.size() || goal.size() != static_cast<long>(joint_names.size()) ||
+      !library_->lookup(
+          experience, manip_info.manipulator, joint_names, start, goal, input.env->getRevision(), tolerance))
+  {
+    info->message = "No experience found";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    return 0;
+  }
+
+  // Keep every state of the experience while providing at least as many states as the seed
+  const long steps = std::max(static_cast<long>(segment->size()), experience.trajectory.rows() - 1);
+  tesseract_common::TrajArray trajectory = upsampleTrajectory(experience.trajectory, steps);
+
+  // Stretch the trajectory so its end points match the seed
+  const Eigen::VectorXd start_offset = start - trajectory.row(0).transpose();
+  const Eigen::VectorXd goal_offset = goal - trajectory.row(steps).transpose();
+  for (long i = 0; i <= steps; ++i)
+  {
+    double t = static_cast<double>(i) / static_cast<double>(steps);
+    trajectory.row(i) += ((1 - t) * start_offset + t * goal_offset).transpose();
+  }
+
+  CompositeInstruction new_segment(segment->getProfile(), segment->getOrder(), segment->getManipulatorInfo());
+  new_segment.setDescription(segment->getDescription());
+  new_segment.setStartInstruction(segment->getStartInstruction());
+  for (long i = 1; i <= steps; ++i)
+  {
+    MoveInstruction move_instruction(StateWaypoint(joint_names, trajectory.row(i).transpose()),
+                                     last_move->getMoveType());
+    move_instruction.setManipulatorInfo(last_move->getManipulatorInfo());
+    move_instruction.setDescription(last_move->getDescription());
+    move_instruction.setProfile(last_move->getProfile());
+    new_segment.push_back(move_instruction);
+  }
+
+  // --------------------
+  // Revalidate the experience
+  // --------------------
+  CompositeInstruction program(ci->getProfile(), ci->getOrder(), ci->getManipulatorInfo());
+  MoveInstruction start_instruction(StateWaypoint(joint_names, start), last_move->getMoveType());
+  start_instruction.setManipulatorInfo(last_move->getManipulatorInfo());
+  program.setStartInstruction(start_instruction);
+  program.push_back(new_segment);
+
+  tesseract_environment::StateSolver::Ptr state_solver = input.env->getStateSolver();
+  tesseract_collision::DiscreteContactManager::Ptr manager = input.env->getDiscreteContactManager();
+  manager->setCollisionMarginData(config.collision_margin_data);
+
+  // Set the active links based on the manipulator
+  manager->setActiveCollisionObjects(KinematicMetadataCache::get(*input.env, *fwd_kin)->active_link_names);
+
+  std::vector<tesseract_collision::ContactResultMap> contacts;
+  if (contactCheckProgram(contacts, *manager, *state_solver, program, config, num_threads))
+  {
+    info->message = "Experience is not contact free";
+    CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+    info->contact_results = contacts;
+    return 0;
+  }
+
+  ci->at(0) = Instruction(new_segment);
+
+  CONSOLE_BRIDGE_logDebug("Experience seed succeeded");
+  info->return_value = 1;
+  return 1;
+}
+
+void ExperienceSeedTaskGenerator::process(TaskInput input, std::size_t unique_id) const
+{
+  conditionalProcess(input, unique_id);
+}
+
+ExperienceSeedTaskInfo::ExperienceSeedTaskInfo(std::size_t unique_id, std::string name)
+  : TaskInfo(unique_id, std::move(name))
+{
+}
+}  // namespace tesseract_planning
@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_process_managers/task_generators/fix_state_collision_task_generator.h>
 #include <tesseract_command_language/utils/utils.h>
 #include <tesseract_command_language/utils/filter_functions.h>
+#include <tesseract_motion_planners/core/kinematic_metadata_cache.h>
 
 namespace tesseract_planning
 {
@@ -51,10 +52,7 @@ bool StateInCollision(const Eigen::Ref<const Eigen::VectorXd>& start_pos,
 
   std::vector<ContactResultMap> collisions;
   DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
-  AdjacencyMap::Ptr adjacency_map = std::make_shared<tesseract_environment::AdjacencyMap>(
-      env->getSceneGraph(), kin->getActiveLinkNames(), env->getCurrentState()->link_transforms);
-
-  manager->setActiveCollisionObjects(adjacency_map->getActiveLinkNames());
+  manager->setActiveCollisionObjects(KinematicMetadataCache::get(*env, *kin)->active_link_names);
   manager->setCollisionMarginData(profile.collision_check_config.collision_margin_data);
   collisions.clear();
 
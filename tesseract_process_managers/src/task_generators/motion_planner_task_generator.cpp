@@ -75,8 +75,8 @@ int MotionPlannerTaskGenerator::conditionalProcess(TaskInput input, std::size_t
   instructions.setManipulatorInfo(instructions.getManipulatorInfo().getCombined(input.manip_info));
 
   // If the start and end waypoints need to be updated prior to planning
-  Instruction start_instruction = input.getStartInstruction();
-  Instruction end_instruction = input.getEndInstruction();
+  const Instruction& start_instruction = input.getStartInstruction();
+  const Instruction& end_instruction = input.getEndInstruction();
 
   if (!isNullInstruction(start_instruction))
   {
@@ -101,7 +101,7 @@ int MotionPlannerTaskGenerator::conditionalProcess(TaskInput input, std::size_t
       }
       else if (isMoveInstruction(start_instruction))
       {
-        auto* lmi = start_instruction.cast<MoveInstruction>();
+        const auto* lmi = start_instruction.cast_const<MoveInstruction>();
         PlanInstruction si(
             lmi->getWaypoint(), PlanInstructionType::START, lmi->getProfile(), lmi->getManipulatorInfo());
         instructions.setStartInstruction(si);
@@ -148,6 +148,8 @@ int MotionPlannerTaskGenerator::conditionalProcess(TaskInput input, std::size_t
   request.instructions = instructions;
   request.plan_profile_remapping = input.plan_profile_remapping;
   request.composite_profile_remapping = input.composite_profile_remapping;
+  request.cancellation_token = input.getTaskInterface()->getCancellationToken();
+  request.deadline = input.getTaskInterface()->getDeadline();
 
   // --------------------
   // Fill out response
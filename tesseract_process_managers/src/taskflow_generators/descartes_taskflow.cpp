@@ -83,11 +83,8 @@ TaskflowContainer DescartesTaskflow::generateTaskflow(TaskInput input, TaskflowV
   auto interpolator = std::make_shared<SimpleMotionPlanner>("Interpolator");
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<SimplePlannerPlanProfile>())
-      interpolator->plan_profiles = input.profiles->getProfileEntry<SimplePlannerPlanProfile>();
-
-    if (input.profiles->hasProfileEntry<SimplePlannerCompositeProfile>())
-      interpolator->composite_profiles = input.profiles->getProfileEntry<SimplePlannerCompositeProfile>();
+    interpolator->shared_plan_profiles = input.profiles->getProfileEntryPtr<SimplePlannerPlanProfile>();
+    interpolator->shared_composite_profiles = input.profiles->getProfileEntryPtr<SimplePlannerCompositeProfile>();
   }
   auto interpolator_generator = std::make_unique<MotionPlannerTaskGenerator>(interpolator);
   interpolator_generator->assignConditionalTask(input, interpolator_task);
@@ -98,8 +95,7 @@ TaskflowContainer DescartesTaskflow::generateTaskflow(TaskInput input, TaskflowV
   descartes_planner->problem_generator = &DefaultDescartesProblemGenerator<double>;
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<DescartesPlanProfile<double>>())
-      descartes_planner->plan_profiles = input.profiles->getProfileEntry<DescartesPlanProfile<double>>();
+    descartes_planner->shared_plan_profiles = input.profiles->getProfileEntryPtr<DescartesPlanProfile<double>>();
   }
   auto descartes_generator = std::make_unique<MotionPlannerTaskGenerator>(descartes_planner);
   descartes_generator->assignConditionalTask(input, descartes_task);
@@ -26,6 +26,9 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_process_managers/core/utils.h>
@@ -35,6 +38,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_process_managers/task_generators/discrete_contact_check_task_generator.h>
 #include <tesseract_process_managers/task_generators/iterative_spline_parameterization_task_generator.h>
 #include <tesseract_process_managers/task_generators/seed_min_length_task_generator.h>
+#include <tesseract_process_managers/task_generators/experience_seed_task_generator.h>
+#include <tesseract_process_managers/task_generators/experience_record_task_generator.h>
 
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_profile.h>
@@ -49,6 +54,120 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 using namespace tesseract_planning;
 
+/**
+ * @brief The state shared by the tasks of branches racing to solve the same process
+ * @details Each branch works on its own copy of the results. The first branch to succeed copies its results into the
+ * results of the process and aborts the other branches.
+ */
+class FreespaceRace
+{
+public:
+  using Ptr = std::shared_ptr<FreespaceRace>;
+
+  /** @brief The index of the successor of a finished branch */
+  enum Result : int
+  {
+    WON = 0,    /**< @brief The branch succeeded first */
+    LOST = 1,   /**< @brief Another branch succeeded or is still running */
+    FAILED = 2  /**< @brief This was the last branch and none succeeded */
+  };
+
+  FreespaceRace(std::size_t branch_count)
+    : results_(branch_count, Instruction(NullInstruction())), interfaces_(branch_count)
+  {
+  }
+
+  /**
+   * @brief Create the input of a branch
+   * @param input The input of the process
+   * @param branch The index of the branch
+   * @return The input of the branch
+   */
+  TaskInput createBranch(const TaskInput& input, std::size_t branch)
+  {
+    TaskInput branch_input = input.createBranch(&results_[branch]);
+    interfaces_[branch] = branch_input.getTaskInterface();
+    return branch_input;
+  }
+
+  /**
+   * @brief Start the race by copying the results of the process to each branch
+   * @param input The input of the process
+   */
+  void start(TaskInput input)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    winner_ = -1;
+    finished_ = 0;
+    for (std::size_t i = 0; i < results_.size(); ++i)
+    {
+      results_[i] = *input.getResults();
+      interfaces_[i]->reset();
+    }
+  }
+
+  /**
+   * @brief Finish a branch
+   * @param input The input of the process
+   * @param branch The index of the branch
+   * @param success Indicate if the branch succeeded
+   * @return The index of the successor to run
+   */
+  int finish(TaskInput input, std::size_t branch, bool success)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++finished_;
+    if (winner_ >= 0)
+      return LOST;
+
+    if (success)
+    {
+      winner_ = static_cast<int>(branch);
+      *input.getResults() = results_[branch];
+      for (std::size_t i = 0; i < interfaces_.size(); ++i)
+        if (i != branch)
+          interfaces_[i]->abort();
+
+      return WON;
+    }
+
+    return (finished_ == results_.size()) ? FAILED : LOST;
+  }
+
+private:
+  std::mutex mutex_;
+
+  /** @brief The results of each branch, not resized after construction since the branch inputs point into it */
+  std::vector<Instruction> results_;
+  std::vector<TaskflowInterface::Ptr> interfaces_;
+  int winner_{ -1 };
+  std::size_t finished_{ 0 };
+};
+
+static MotionPlannerTaskGenerator::UPtr createTrajOptGenerator(const TaskInput& input)
+{
+  auto trajopt_planner = std::make_shared<TrajOptMotionPlanner>();
+  trajopt_planner->problem_generator = &DefaultTrajoptProblemGenerator;
+  if (input.profiles)
+  {
+    trajopt_planner->shared_plan_profiles = input.profiles->getProfileEntryPtr<TrajOptPlanProfile>();
+    trajopt_planner->shared_composite_profiles = input.profiles->getProfileEntryPtr<TrajOptCompositeProfile>();
+    trajopt_planner->shared_solver_profiles = input.profiles->getProfileEntryPtr<TrajOptSolverProfile>();
+  }
+  return std::make_unique<MotionPlannerTaskGenerator>(trajopt_planner);
+}
+
+static TaskGenerator::UPtr createContactCheckGenerator(const FreespaceTaskflowParams& params)
+{
+  if (params.enable_post_contact_continuous_check)
+    return std::make_unique<ContinuousContactCheckTaskGenerator>();
+
+  if (params.enable_post_contact_discrete_check)
+    return std::make_unique<DiscreteContactCheckTaskGenerator>();
+
+  return nullptr;
+}
+
 FreespaceTaskflow::FreespaceTaskflow(FreespaceTaskflowParams params, std::string name) : name_(name), params_(params) {}
 
 const std::string& FreespaceTaskflow::getName() const { return name_; }
@@ -65,6 +184,8 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
   std::string name = name_;
   if (params_.type == FreespaceTaskflowType::TRAJOPT_FIRST)
     name += "(TrajOpt First)";
+  else if (params_.type == FreespaceTaskflowType::RACE)
+    name += "(Race)";
   else
     name += "(Default)";
 
@@ -96,11 +217,8 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
   auto interpolator = std::make_shared<SimpleMotionPlanner>("Interpolator");
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<SimplePlannerPlanProfile>())
-      interpolator->plan_profiles = input.profiles->getProfileEntry<SimplePlannerPlanProfile>();
-
-    if (input.profiles->hasProfileEntry<SimplePlannerCompositeProfile>())
-      interpolator->composite_profiles = input.profiles->getProfileEntry<SimplePlannerCompositeProfile>();
+    interpolator->shared_plan_profiles = input.profiles->getProfileEntryPtr<SimplePlannerPlanProfile>();
+    interpolator->shared_composite_profiles = input.profiles->getProfileEntryPtr<SimplePlannerCompositeProfile>();
   }
   auto interpolator_generator = std::make_unique<MotionPlannerTaskGenerator>(interpolator);
   interpolator_generator->assignConditionalTask(input, interpolator_task);
@@ -110,44 +228,48 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
   seed_min_length_generator->assignTask(input, seed_min_length_task);
   container.generators.push_back(std::move(seed_min_length_generator));
 
+  // When racing, ompl followed by trajopt runs on one branch while trajopt alone runs on another branch
+  FreespaceRace::Ptr race;
+  if (params_.type == FreespaceTaskflowType::RACE)
+    race = std::make_shared<FreespaceRace>(2);
+
+  TaskInput ompl_input = (race != nullptr) ? race->createBranch(input, 1) : input;
+
   auto ompl_planner = std::make_shared<OMPLMotionPlanner>();
   ompl_planner->problem_generator = &DefaultOMPLProblemGenerator;
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<OMPLPlanProfile>())
-      ompl_planner->plan_profiles = input.profiles->getProfileEntry<OMPLPlanProfile>();
+    ompl_planner->shared_plan_profiles = input.profiles->getProfileEntryPtr<OMPLPlanProfile>();
   }
   auto ompl_generator = std::make_unique<MotionPlannerTaskGenerator>(ompl_planner);
-  ompl_generator->assignTask(input, ompl_task);
+  ompl_generator->assignTask(ompl_input, ompl_task);
   container.generators.push_back(std::move(ompl_generator));
 
-  auto trajopt_planner = std::make_shared<TrajOptMotionPlanner>();
-  trajopt_planner->problem_generator = &DefaultTrajoptProblemGenerator;
-  if (input.profiles)
-  {
-    if (input.profiles->hasProfileEntry<TrajOptPlanProfile>())
-      trajopt_planner->plan_profiles = input.profiles->getProfileEntry<TrajOptPlanProfile>();
-
-    if (input.profiles->hasProfileEntry<TrajOptCompositeProfile>())
-      trajopt_planner->composite_profiles = input.profiles->getProfileEntry<TrajOptCompositeProfile>();
-
-    if (input.profiles->hasProfileEntry<TrajOptSolverProfile>())
-      trajopt_planner->solver_profiles = input.profiles->getProfileEntry<TrajOptSolverProfile>();
-  }
-  auto trajopt_generator = std::make_unique<MotionPlannerTaskGenerator>(trajopt_planner);
-  trajopt_generator->assignConditionalTask(input, trajopt_task);
+  auto trajopt_generator = createTrajOptGenerator(ompl_input);
+  trajopt_generator->assignConditionalTask(ompl_input, trajopt_task);
   container.generators.push_back(std::move(trajopt_generator));
 
-  TaskGenerator::UPtr contact_check_generator;
-  bool has_contact_check = (params_.enable_post_contact_continuous_check || params_.enable_post_contact_discrete_check);
-  if (has_contact_check)
+  // Try the experience library before running ompl and record successful results before calling done
+  tf::Task ompl_entry_task = ompl_task;
+  tf::Task finish_task = done_task;
+  if (params_.experience_library != nullptr)
   {
-    if (params_.enable_post_contact_continuous_check)
-      contact_check_generator = std::make_unique<ContinuousContactCheckTaskGenerator>();
-    else if (params_.enable_post_contact_discrete_check)
-      contact_check_generator = std::make_unique<DiscreteContactCheckTaskGenerator>();
+    ompl_entry_task = container.taskflow->placeholder();
+    auto experience_seed_generator = std::make_unique<ExperienceSeedTaskGenerator>(
+        params_.experience_library, params_.experience_collision_margin);
+    experience_seed_generator->assignConditionalTask(ompl_input, ompl_entry_task);
+    container.generators.push_back(std::move(experience_seed_generator));
+
+    finish_task = container.taskflow->placeholder();
+    auto experience_record_generator = std::make_unique<ExperienceRecordTaskGenerator>(params_.experience_library);
+    experience_record_generator->assignTask(input, finish_task);
+    container.generators.push_back(std::move(experience_record_generator));
+    finish_task.precede(done_task);
   }
 
+  TaskGenerator::UPtr contact_check_generator = createContactCheckGenerator(params_);
+  bool has_contact_check = (contact_check_generator != nullptr);
+
   TaskGenerator::UPtr time_parameterization_generator;
   if (params_.enable_time_parameterization)
     time_parameterization_generator = std::make_unique<IterativeSplineParameterizationTaskGenerator>();
@@ -159,31 +281,20 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
     tf::Task trajopt_second_task = container.taskflow->placeholder();
 
     // Setup TrajOpt
-    auto trajopt_planner2 = std::make_shared<TrajOptMotionPlanner>();
-    trajopt_planner2->problem_generator = &DefaultTrajoptProblemGenerator;
-    if (input.profiles)
-    {
-      if (input.profiles->hasProfileEntry<TrajOptPlanProfile>())
-        trajopt_planner2->plan_profiles = input.profiles->getProfileEntry<TrajOptPlanProfile>();
-
-      if (input.profiles->hasProfileEntry<TrajOptCompositeProfile>())
-        trajopt_planner2->composite_profiles = input.profiles->getProfileEntry<TrajOptCompositeProfile>();
-
-      if (input.profiles->hasProfileEntry<TrajOptSolverProfile>())
-        trajopt_planner2->solver_profiles = input.profiles->getProfileEntry<TrajOptSolverProfile>();
-    }
-    TaskGenerator::UPtr trajopt_generator2 = std::make_unique<MotionPlannerTaskGenerator>(trajopt_planner2);
+    TaskGenerator::UPtr trajopt_generator2 = createTrajOptGenerator(input);
     trajopt_generator2->assignConditionalTask(input, trajopt_second_task);
     container.generators.push_back(std::move(trajopt_generator2));
 
     ompl_task.precede(trajopt_second_task);
+    if (params_.experience_library != nullptr)
+      ompl_entry_task.precede(ompl_task, trajopt_second_task);
 
     // Add Final Continuous Contact Check of trajectory and Time parameterization trajectory
     if (has_contact_check && params_.enable_time_parameterization)
     {
       tf::Task contact_task = container.taskflow->placeholder();
       contact_check_generator->assignConditionalTask(input, contact_task);
-      trajopt_task.precede(ompl_task, contact_task);
+      trajopt_task.precede(ompl_entry_task, contact_task);
       trajopt_second_task.precede(error_task, contact_task);
       container.generators.push_back(std::move(contact_check_generator));
 
@@ -191,16 +302,16 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
       time_parameterization_generator->assignConditionalTask(input, time_task);
       container.generators.push_back(std::move(time_parameterization_generator));
       contact_task.precede(error_task, time_task);
-      time_task.precede(error_task, done_task);
+      time_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(time_parameterization_generator));
     }
     else if (has_contact_check && !params_.enable_time_parameterization)
     {
       tf::Task contact_task = container.taskflow->placeholder();
       contact_check_generator->assignConditionalTask(input, contact_task);
-      trajopt_task.precede(ompl_task, contact_task);
+      trajopt_task.precede(ompl_entry_task, contact_task);
       trajopt_second_task.precede(error_task, contact_task);
-      contact_task.precede(error_task, done_task);
+      contact_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(contact_check_generator));
     }
     else if (!has_contact_check && params_.enable_time_parameterization)
@@ -210,19 +321,77 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
       container.generators.push_back(std::move(time_parameterization_generator));
       trajopt_task.precede(error_task, time_task);
       trajopt_second_task.precede(error_task, time_task);
-      time_task.precede(error_task, done_task);
+      time_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(time_parameterization_generator));
     }
     else
     {
-      trajopt_task.precede(ompl_task, done_task);
-      trajopt_second_task.precede(error_task, done_task);
+      trajopt_task.precede(ompl_entry_task, finish_task);
+      trajopt_second_task.precede(error_task, finish_task);
+    }
+  }
+  else if (params_.type == FreespaceTaskflowType::RACE)
+  {
+    tf::Task race_task = container.taskflow->emplace([race, input]() { race->start(input); }).name("Race Start");
+    seed_min_length_task.precede(race_task);
+
+    // Branch running trajopt from the interpolated seed
+    TaskInput trajopt_input = race->createBranch(input, 0);
+    tf::Task trajopt_race_task = container.taskflow->placeholder();
+    TaskGenerator::UPtr trajopt_race_generator = createTrajOptGenerator(trajopt_input);
+    trajopt_race_generator->assignConditionalTask(trajopt_input, trajopt_race_task);
+    container.generators.push_back(std::move(trajopt_race_generator));
+
+    // Branch running ompl followed by trajopt
+    ompl_task.precede(trajopt_task);
+    if (params_.experience_library != nullptr)
+      ompl_entry_task.precede(ompl_task, trajopt_task);
+
+    race_task.precede(trajopt_race_task, ompl_entry_task);
+
+    // The first branch passing the contact check wins and continues on the results of the process
+    tf::Task winner_task = finish_task;
+    if (params_.enable_time_parameterization)
+    {
+      winner_task = container.taskflow->placeholder();
+      time_parameterization_generator->assignConditionalTask(input, winner_task);
+      container.generators.push_back(std::move(time_parameterization_generator));
+      winner_task.precede(error_task, finish_task);
+    }
+
+    tf::Task lost_task = container.taskflow->emplace([]() {}).name("Race Lost");
+    std::vector<std::pair<TaskInput, tf::Task>> branches{ { trajopt_input, trajopt_race_task },
+                                                          { ompl_input, trajopt_task } };
+    for (std::size_t i = 0; i < branches.size(); ++i)
+    {
+      tf::Task accept_task = container.taskflow->emplace([race, input, i]() { return race->finish(input, i, true); })
+                                 .name("Race Branch Succeeded");
+      tf::Task reject_task = container.taskflow->emplace([race, input, i]() { return race->finish(input, i, false); })
+                                 .name("Race Branch Failed");
+      accept_task.precede(winner_task, lost_task, error_task);
+      reject_task.precede(winner_task, lost_task, error_task);
+
+      if (has_contact_check)
+      {
+        tf::Task contact_task = container.taskflow->placeholder();
+        TaskGenerator::UPtr branch_contact_check_generator = createContactCheckGenerator(params_);
+        branch_contact_check_generator->assignConditionalTask(branches[i].first, contact_task);
+        container.generators.push_back(std::move(branch_contact_check_generator));
+        branches[i].second.precede(reject_task, contact_task);
+        contact_task.precede(reject_task, accept_task);
+      }
+      else
+      {
+        branches[i].second.precede(reject_task, accept_task);
+      }
     }
   }
   else
   {
-    seed_min_length_task.precede(ompl_task);
+    seed_min_length_task.precede(ompl_entry_task);
     ompl_task.precede(trajopt_task);
+    if (params_.experience_library != nullptr)
+      ompl_entry_task.precede(ompl_task, trajopt_task);
 
     // Add Final Continuous Contact Check of trajectory and Time parameterization trajectory
     if (has_contact_check && params_.enable_time_parameterization)
@@ -236,7 +405,7 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
       time_parameterization_generator->assignConditionalTask(input, time_task);
       container.generators.push_back(std::move(time_parameterization_generator));
       contact_task.precede(error_task, time_task);
-      time_task.precede(error_task, done_task);
+      time_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(time_parameterization_generator));
     }
     else if (has_contact_check && !params_.enable_time_parameterization)
@@ -244,7 +413,7 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
       tf::Task contact_task = container.taskflow->placeholder();
       contact_check_generator->assignConditionalTask(input, contact_task);
       trajopt_task.precede(ompl_task, contact_task);
-      contact_task.precede(error_task, done_task);
+      contact_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(contact_check_generator));
     }
     else if (!has_contact_check && params_.enable_time_parameterization)
@@ -253,12 +422,12 @@ TaskflowContainer FreespaceTaskflow::generateTaskflow(TaskInput input, TaskflowV
       time_parameterization_generator->assignConditionalTask(input, time_task);
       container.generators.push_back(std::move(time_parameterization_generator));
       trajopt_task.precede(error_task, time_task);
-      time_task.precede(error_task, done_task);
+      time_task.precede(error_task, finish_task);
       container.generators.push_back(std::move(time_parameterization_generator));
     }
     else
     {
-      trajopt_task.precede(error_task, done_task);
+      trajopt_task.precede(error_task, finish_task);
     }
   }
 
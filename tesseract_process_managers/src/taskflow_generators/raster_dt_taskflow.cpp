@@ -65,6 +65,10 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   container.input = container.taskflow->emplace([]() {}).name(name_ + ": Input Task");
   std::vector<tf::Task> tasks;
 
@@ -72,37 +76,20 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
   std::size_t raster_idx = 0;
   for (std::size_t idx = 1; idx < input.size() - 1; idx += 2)
   {
-    // Get Start Plan Instruction
-    Instruction start_instruction = NullInstruction();
+    // The start is the last plan instruction of the from_start or previous transition from end
+    TaskInput raster_input = input[idx];
     if (idx == 1)
-    {
-      assert(isCompositeInstruction(*(input[0].getInstruction())));
-      const auto* ci = input[0].getInstruction()->cast_const<CompositeInstruction>();
-      const auto* li = getLastPlanInstruction(*ci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
+      raster_input.setStartInstructionFromInput(std::vector<std::size_t>({ 0 }));
     else
-    {
-      assert(isCompositeInstruction(*(input[idx - 1].getInstruction())));
-      const auto* tci = input[idx - 1].getInstruction()->cast_const<CompositeInstruction>();
-      assert(isCompositeInstruction((*tci)[0]));
-      const auto* ci = (*tci)[0].cast_const<CompositeInstruction>();
-      auto* li = getLastPlanInstruction(*ci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-
-    start_instruction.cast<PlanInstruction>()->setPlanType(PlanInstructionType::START);
-    TaskInput raster_input = input[idx];
-    raster_input.setStartInstruction(start_instruction);
+      raster_input.setStartInstructionFromInput(std::vector<std::size_t>({ idx - 1, 0 }));
     TaskflowContainer sub_container = raster_taskflow_generator_->generateTaskflow(
         raster_input,
-        [=]() { successTask(input, name_, raster_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 1, name_, raster_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, raster_input.getInstruction()->getDescription(), error_cb); });
 
     auto raster_step =
         container.taskflow->composed_of(*(sub_container.taskflow)).name("raster_" + std::to_string(raster_idx + 1));
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
     container.input.precede(raster_step);
     tasks.push_back(raster_step);
@@ -123,11 +110,15 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
     transition_from_end_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1 }));
     TaskflowContainer sub_container1 = transition_taskflow_generator_->generateTaskflow(
         transition_from_end_input,
-        [=]() { successTask(input, name_, transition_from_end_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(
+              input, input_idx, 2, name_, transition_from_end_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_from_end_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_from_end_step = container.taskflow->composed_of(*(sub_container1.taskflow))
                                         .name("transition_from_end_" + std::to_string(transition_idx + 1));
+    gate->add(*(sub_container1.taskflow), sub_container1.input);
     container.containers.push_back(std::move(sub_container1));
 
     // Each transition is independent and thus depends only on the adjacent rasters
@@ -139,11 +130,15 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
     transition_to_start_input.setEndInstruction(std::vector<std::size_t>({ input_idx - 1 }));
     TaskflowContainer sub_container2 = transition_taskflow_generator_->generateTaskflow(
         transition_to_start_input,
-        [=]() { successTask(input, name_, transition_to_start_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(
+              input, input_idx, 2, name_, transition_to_start_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_to_start_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_to_start_step = container.taskflow->composed_of(*(sub_container2.taskflow))
                                         .name("transition_to_start" + std::to_string(transition_idx + 1));
+    gate->add(*(sub_container2.taskflow), sub_container2.input);
     container.containers.push_back(std::move(sub_container2));
 
     // Each transition is independent and thus depends only on the adjacent rasters
@@ -155,15 +150,15 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
 
   // Plan from_start - preceded by the first raster
   TaskInput from_start_input = input[0];
-  from_start_input.setStartInstruction(
-      input.getInstruction()->cast_const<CompositeInstruction>()->getStartInstruction());
+  from_start_input.setStartInstructionFromInput(std::vector<std::size_t>());
   from_start_input.setEndInstruction(std::vector<std::size_t>({ 1 }));
   TaskflowContainer sub_container1 = freespace_taskflow_generator_->generateTaskflow(
       from_start_input,
-      [=]() { successTask(input, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
+      [=]() { successTask(input, 0, 1, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
       [=]() { failureTask(input, name_, from_start_input.getInstruction()->getDescription(), error_cb); });
 
   auto from_start = container.taskflow->composed_of(*(sub_container1.taskflow)).name("from_start");
+  gate->add(*(sub_container1.taskflow), sub_container1.input);
   container.containers.push_back(std::move(sub_container1));
   tasks[0].precede(from_start);
 
@@ -172,10 +167,13 @@ TaskflowContainer RasterDTTaskflow::generateTaskflow(TaskInput input, TaskflowVo
   to_end_input.setStartInstruction(std::vector<std::size_t>({ input.size() - 2 }));
   TaskflowContainer sub_container2 = freespace_taskflow_generator_->generateTaskflow(
       to_end_input,
-      [=]() { successTask(input, name_, to_end_input.getInstruction()->getDescription(), done_cb); },
+      [=]() {
+        successTask(input, input.size() - 1, 1, name_, to_end_input.getInstruction()->getDescription(), done_cb);
+      },
       [=]() { failureTask(input, name_, to_end_input.getInstruction()->getDescription(), error_cb); });
 
   auto to_end = container.taskflow->composed_of(*(sub_container2.taskflow)).name("to_end");
+  gate->add(*(sub_container2.taskflow), sub_container2.input);
   container.containers.push_back(std::move(sub_container2));
   tasks.back().precede(to_end);
 
@@ -69,6 +69,10 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   std::vector<tf::Task> tasks;
 
   const Instruction* input_instruction = input.getInstruction();
@@ -78,6 +82,7 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
       [=]() { failureTask(input, name_, input_instruction->getDescription(), error_cb); });
 
   auto global_task = container.taskflow->composed_of(*(sub_container.taskflow)).name("global");
+  gate->add(*(sub_container.taskflow), sub_container.input);
   container.containers.push_back(std::move(sub_container));
   container.input = global_task;
 
@@ -93,12 +98,13 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
     raster_input.setEndInstruction(std::vector<std::size_t>({ idx + 1 }));
     TaskflowContainer sub_container = raster_taskflow_generator_->generateTaskflow(
         raster_input,
-        [=]() { successTask(input, name_, raster_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 1, name_, raster_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, raster_input.getInstruction()->getDescription(), error_cb); });
 
     auto raster_step =
         container.taskflow->composed_of(*(sub_container.taskflow))
             .name("Raster #" + std::to_string(raster_idx + 1) + ": " + raster_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
     global_post_task.precede(raster_step);
     tasks.push_back(raster_step);
@@ -119,12 +125,15 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
     transition_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1 }));
     TaskflowContainer sub_container = transition_taskflow_generator_->generateTaskflow(
         transition_input,
-        [=]() { successTask(input, name_, transition_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(input, input_idx, 1, name_, transition_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_step = container.taskflow->composed_of(*(sub_container.taskflow))
                                .name("Transition #" + std::to_string(transition_idx + 1) + ": " +
                                      transition_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
 
     // Each transition is independent and thus depends only on the adjacent rasters
@@ -136,16 +145,17 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
 
   // Plan from_start - preceded by the first raster
   TaskInput from_start_input = input[0];
-  from_start_input.setStartInstruction(input_instruction->cast_const<CompositeInstruction>()->getStartInstruction());
+  from_start_input.setStartInstructionFromInput(std::vector<std::size_t>());
   from_start_input.setEndInstruction(std::vector<std::size_t>({ 1 }));
 
   TaskflowContainer sub_container1 = freespace_taskflow_generator_->generateTaskflow(
       from_start_input,
-      [=]() { successTask(input, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
+      [=]() { successTask(input, 0, 1, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
       [=]() { failureTask(input, name_, from_start_input.getInstruction()->getDescription(), error_cb); });
 
   auto from_start = container.taskflow->composed_of(*(sub_container1.taskflow))
                         .name("From Start: " + from_start_input.getInstruction()->getDescription());
+  gate->add(*(sub_container1.taskflow), sub_container1.input);
   container.containers.push_back(std::move(sub_container1));
   tasks[0].precede(from_start);
 
@@ -154,11 +164,14 @@ TaskflowContainer RasterGlobalTaskflow::generateTaskflow(TaskInput input,
   to_end_input.setStartInstruction(std::vector<std::size_t>({ input.size() - 2 }));
   TaskflowContainer sub_container2 = freespace_taskflow_generator_->generateTaskflow(
       to_end_input,
-      [=]() { successTask(input, name_, to_end_input.getInstruction()->getDescription(), done_cb); },
+      [=]() {
+        successTask(input, input.size() - 1, 1, name_, to_end_input.getInstruction()->getDescription(), done_cb);
+      },
       [=]() { failureTask(input, name_, to_end_input.getInstruction()->getDescription(), error_cb); });
 
   auto to_end = container.taskflow->composed_of(*(sub_container2.taskflow))
                     .name("To End: " + to_end_input.getInstruction()->getDescription());
+  gate->add(*(sub_container2.taskflow), sub_container2.input);
   container.containers.push_back(std::move(sub_container2));
   tasks.back().precede(to_end);
 
@@ -67,6 +67,10 @@ TaskflowContainer RasterOnlyGlobalTaskflow::generateTaskflow(TaskInput input,
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   std::vector<tf::Task> tasks;
 
   const Instruction* input_instruction = input.getInstruction();
@@ -76,6 +80,7 @@ TaskflowContainer RasterOnlyGlobalTaskflow::generateTaskflow(TaskInput input,
       [=]() { failureTask(input, name_, input_instruction->getDescription(), error_cb); });
 
   container.input = container.taskflow->composed_of(*(sub_container.taskflow)).name("global");
+  gate->add(*(sub_container.taskflow), sub_container.input);
   container.containers.push_back(std::move(sub_container));
 
   auto global_post_task =
@@ -88,7 +93,7 @@ TaskflowContainer RasterOnlyGlobalTaskflow::generateTaskflow(TaskInput input,
   {
     TaskInput raster_input = input[idx];
     if (idx == 0)
-      raster_input.setStartInstruction(input_instruction->cast_const<CompositeInstruction>()->getStartInstruction());
+      raster_input.setStartInstructionFromInput(std::vector<std::size_t>());
     else
       raster_input.setStartInstruction(std::vector<std::size_t>({ idx - 1 }));
 
@@ -97,12 +102,13 @@ TaskflowContainer RasterOnlyGlobalTaskflow::generateTaskflow(TaskInput input,
 
     TaskflowContainer sub_container = raster_taskflow_generator_->generateTaskflow(
         raster_input,
-        [=]() { successTask(input, name_, raster_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 1, name_, raster_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, raster_input.getInstruction()->getDescription(), error_cb); });
 
     auto raster_step =
         container.taskflow->composed_of(*(sub_container.taskflow))
             .name("Raster #" + std::to_string(raster_idx + 1) + ": " + raster_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
     global_post_task.precede(raster_step);
     tasks.push_back(raster_step);
@@ -123,12 +129,15 @@ TaskflowContainer RasterOnlyGlobalTaskflow::generateTaskflow(TaskInput input,
     transition_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1 }));
     TaskflowContainer sub_container = transition_taskflow_generator_->generateTaskflow(
         transition_input,
-        [=]() { successTask(input, name_, transition_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(input, input_idx, 1, name_, transition_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_step = container.taskflow->composed_of(*(sub_container.taskflow))
                                .name("Transition #" + std::to_string(transition_idx + 1) + ": " +
                                      transition_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
 
     // Each transition is independent and thus depends only on the adjacent rasters
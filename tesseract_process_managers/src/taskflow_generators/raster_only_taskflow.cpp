@@ -63,43 +63,32 @@ TaskflowContainer RasterOnlyTaskflow::generateTaskflow(TaskInput input, Taskflow
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   container.input = container.taskflow->emplace([]() {}).name(name_ + ": Input Task");
   std::vector<tf::Task> tasks;
 
   // Generate all of the raster tasks. They don't depend on anything
   std::size_t raster_idx = 0;
-  const Instruction* input_instruction = input.getInstruction();
   for (std::size_t idx = 0; idx < input.size(); idx += 2)
   {
-    // Get Start Plan Instruction
-    Instruction start_instruction = NullInstruction();
+    // The start is the program start or the last plan instruction of the previous transition
+    TaskInput raster_input = input[idx];
     if (idx == 0)
-    {
-      assert(isCompositeInstruction(*input_instruction));
-      start_instruction = input_instruction->cast_const<CompositeInstruction>()->getStartInstruction();
-    }
+      raster_input.setStartInstructionFromInput(std::vector<std::size_t>());
     else
-    {
-      TaskInput pre_input = input[idx - 1];
-      const Instruction* pre_input_instruction = pre_input.getInstruction();
-      assert(isCompositeInstruction(*pre_input_instruction));
-      const auto* tci = pre_input_instruction->cast_const<CompositeInstruction>();
-      auto* li = getLastPlanInstruction(*tci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-
-    start_instruction.cast<PlanInstruction>()->setPlanType(PlanInstructionType::START);
-    TaskInput raster_input = input[idx];
-    raster_input.setStartInstruction(start_instruction);
+      raster_input.setStartInstructionFromInput(std::vector<std::size_t>({ idx - 1 }));
     TaskflowContainer sub_container = raster_taskflow_generator_->generateTaskflow(
         raster_input,
-        [=]() { successTask(input, name_, raster_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 1, name_, raster_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, raster_input.getInstruction()->getDescription(), error_cb); });
 
     auto raster_step =
         container.taskflow->composed_of(*(sub_container.taskflow))
             .name("Raster #" + std::to_string(raster_idx + 1) + ": " + raster_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
     container.input.precede(raster_step);
     tasks.push_back(raster_step);
@@ -120,12 +109,15 @@ TaskflowContainer RasterOnlyTaskflow::generateTaskflow(TaskInput input, Taskflow
     transition_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1 }));
     TaskflowContainer sub_container = transition_taskflow_generator_->generateTaskflow(
         transition_input,
-        [=]() { successTask(input, name_, transition_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(input, input_idx, 1, name_, transition_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_step = container.taskflow->composed_of(*(sub_container.taskflow))
                                .name("Transition #" + std::to_string(transition_idx + 1) + ": " +
                                      transition_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
 
     // Each transition is independent and thus depends only on the adjacent rasters
@@ -65,48 +65,29 @@ TaskflowContainer RasterTaskflow::generateTaskflow(TaskInput input, TaskflowVoid
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   container.input = container.taskflow->emplace([]() {}).name(name_ + ": Input Task");
   std::vector<tf::Task> tasks;
 
   // Generate all of the raster tasks. They don't depend on anything
   std::size_t raster_idx = 0;
-  const Instruction* input_instruction = input.getInstruction();
   for (std::size_t idx = 1; idx < input.size() - 1; idx += 2)
   {
-    // Get Start Plan Instruction
-    Instruction start_instruction = NullInstruction();
-    if (idx == 1)
-    {
-      TaskInput from_start_input = input[0];
-      const Instruction* from_start_input_instruction = from_start_input.getInstruction();
-      assert(isCompositeInstruction(*from_start_input_instruction));
-      const auto* ci = from_start_input_instruction->cast_const<CompositeInstruction>();
-      const auto* li = getLastPlanInstruction(*ci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-    else
-    {
-      TaskInput pre_input = input[idx - 1];
-      const Instruction* pre_input_instruction = pre_input.getInstruction();
-      assert(isCompositeInstruction(*pre_input_instruction));
-      const auto* tci = pre_input_instruction->cast_const<CompositeInstruction>();
-      auto* li = getLastPlanInstruction(*tci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-
-    start_instruction.cast<PlanInstruction>()->setPlanType(PlanInstructionType::START);
+    // The start is the last plan instruction of the from_start or previous transition
     TaskInput raster_input = input[idx];
-    raster_input.setStartInstruction(start_instruction);
+    raster_input.setStartInstructionFromInput(std::vector<std::size_t>({ idx - 1 }));
     TaskflowContainer sub_container = raster_taskflow_generator_->generateTaskflow(
         raster_input,
-        [=]() { successTask(input, name_, raster_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 1, name_, raster_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, raster_input.getInstruction()->getDescription(), error_cb); });
 
     auto raster_step =
         container.taskflow->composed_of(*(sub_container.taskflow))
             .name("Raster #" + std::to_string(raster_idx + 1) + ": " + raster_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
     container.input.precede(raster_step);
     tasks.push_back(raster_step);
@@ -127,12 +108,15 @@ TaskflowContainer RasterTaskflow::generateTaskflow(TaskInput input, TaskflowVoid
     transition_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1 }));
     TaskflowContainer sub_container = transition_taskflow_generator_->generateTaskflow(
         transition_input,
-        [=]() { successTask(input, name_, transition_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(input, input_idx, 1, name_, transition_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_step = container.taskflow->composed_of(*(sub_container.taskflow))
                                .name("Transition #" + std::to_string(transition_idx + 1) + ": " +
                                      transition_input.getInstruction()->getDescription());
+    gate->add(*(sub_container.taskflow), sub_container.input);
     container.containers.push_back(std::move(sub_container));
 
     // Each transition is independent and thus depends only on the adjacent rasters
@@ -144,15 +128,16 @@ TaskflowContainer RasterTaskflow::generateTaskflow(TaskInput input, TaskflowVoid
 
   // Plan from_start - preceded by the first raster
   TaskInput from_start_input = input[0];
-  from_start_input.setStartInstruction(input_instruction->cast_const<CompositeInstruction>()->getStartInstruction());
+  from_start_input.setStartInstructionFromInput(std::vector<std::size_t>());
   from_start_input.setEndInstruction(std::vector<std::size_t>({ 1 }));
   TaskflowContainer sub_container1 = freespace_taskflow_generator_->generateTaskflow(
       from_start_input,
-      [=]() { successTask(input, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
+      [=]() { successTask(input, 0, 1, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
       [=]() { failureTask(input, name_, from_start_input.getInstruction()->getDescription(), error_cb); });
 
   auto from_start = container.taskflow->composed_of(*(sub_container1.taskflow))
                         .name("From Start: " + from_start_input.getInstruction()->getDescription());
+  gate->add(*(sub_container1.taskflow), sub_container1.input);
   container.containers.push_back(std::move(sub_container1));
   tasks[0].precede(from_start);
 
@@ -161,11 +146,14 @@ TaskflowContainer RasterTaskflow::generateTaskflow(TaskInput input, TaskflowVoid
   to_end_input.setStartInstruction(std::vector<std::size_t>({ input.size() - 2 }));
   TaskflowContainer sub_container2 = freespace_taskflow_generator_->generateTaskflow(
       to_end_input,
-      [=]() { successTask(input, name_, to_end_input.getInstruction()->getDescription(), done_cb); },
+      [=]() {
+        successTask(input, input.size() - 1, 1, name_, to_end_input.getInstruction()->getDescription(), done_cb);
+      },
       [=]() { failureTask(input, name_, to_end_input.getInstruction()->getDescription(), error_cb); });
 
   auto to_end = container.taskflow->composed_of(*(sub_container2.taskflow))
                     .name("To End: " + to_end_input.getInstruction()->getDescription());
+  gate->add(*(sub_container2.taskflow), sub_container2.input);
   container.containers.push_back(std::move(sub_container2));
   tasks.back().precede(to_end);
 
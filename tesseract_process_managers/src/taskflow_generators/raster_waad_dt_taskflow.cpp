@@ -67,6 +67,10 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
 
   TaskflowContainer container;
   container.taskflow = std::make_unique<tf::Taskflow>(name_);
+
+  // Each sub-taskflow waits at the preemption gate of the process before it starts, see PreemptionGate
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
   container.input = container.taskflow->emplace([]() {}).name(name_ + ": Input Task");
   std::vector<std::array<tf::Task, 3>> raster_tasks;
 
@@ -74,22 +78,17 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
   std::size_t raster_idx = 0;
   for (std::size_t idx = 1; idx < input.size() - 1; idx += 2)
   {
-    // Get the last plan instruction of the approach
-    assert(isCompositeInstruction(*(input[idx][0].getInstruction())));
-    const auto* aci = input[idx][0].getInstruction()->cast_const<CompositeInstruction>();
-    auto* ali = getLastPlanInstruction(*aci);
-    assert(ali != nullptr);
-
-    // Create the process taskflow
+    // Create the process taskflow, the start is the last plan instruction of the approach
     TaskInput task_input = input[idx][1];
-    task_input.setStartInstruction(*ali);
+    task_input.setStartInstructionFromInput(std::vector<std::size_t>({ idx, 0 }));
     TaskflowContainer sub_container1 = raster_taskflow_generator_->generateTaskflow(
         task_input,
-        [=]() { successTask(input, name_, task_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 3, name_, task_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, task_input.getInstruction()->getDescription(), error_cb); });
 
     auto process_step =
         container.taskflow->composed_of(*(sub_container1.taskflow)).name("raster_" + std::to_string(raster_idx + 1));
+    gate->add(*(sub_container1.taskflow), sub_container1.input);
     container.containers.push_back(std::move(sub_container1));
 
     // Create Departure Taskflow
@@ -97,44 +96,26 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
     departure_input.setStartInstruction(std::vector<std::size_t>({ idx, 1 }));
     TaskflowContainer sub_container2 = raster_taskflow_generator_->generateTaskflow(
         departure_input,
-        [=]() { successTask(input, name_, departure_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 3, name_, departure_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, departure_input.getInstruction()->getDescription(), error_cb); });
 
     auto departure_step =
         container.taskflow->composed_of(*(sub_container2.taskflow)).name("departure_" + std::to_string(raster_idx + 1));
+    gate->add(*(sub_container2.taskflow), sub_container2.input);
     container.containers.push_back(std::move(sub_container2));
 
-    // Get Start Plan Instruction for approach
-    Instruction start_instruction = NullInstruction();
-    if (idx == 1)
-    {
-      assert(isCompositeInstruction(*(input[0].getInstruction())));
-      const auto* ci = input[0].getInstruction()->cast_const<CompositeInstruction>();
-      const auto* li = getLastPlanInstruction(*ci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-    else
-    {
-      assert(isCompositeInstruction(*(input[idx - 1].getInstruction())));
-      const auto* tci = input[idx - 1].getInstruction()->cast_const<CompositeInstruction>();
-      auto* li = getLastPlanInstruction(*tci);
-      assert(li != nullptr);
-      start_instruction = *li;
-    }
-
-    // Create the departure taskflow
-    start_instruction.cast<PlanInstruction>()->setPlanType(PlanInstructionType::START);
+    // Create the approach taskflow, the start is the last plan instruction of the from_start or previous transition
     TaskInput approach_input = input[idx][0];
-    approach_input.setStartInstruction(start_instruction);
+    approach_input.setStartInstructionFromInput(std::vector<std::size_t>({ idx - 1 }));
     approach_input.setEndInstruction(std::vector<std::size_t>({ idx, 1 }));
     TaskflowContainer sub_container0 = raster_taskflow_generator_->generateTaskflow(
         approach_input,
-        [=]() { successTask(input, name_, approach_input.getInstruction()->getDescription(), done_cb); },
+        [=]() { successTask(input, idx, 3, name_, approach_input.getInstruction()->getDescription(), done_cb); },
         [=]() { failureTask(input, name_, approach_input.getInstruction()->getDescription(), error_cb); });
 
     auto approach_step =
         container.taskflow->composed_of(*(sub_container0.taskflow)).name("approach_" + std::to_string(raster_idx + 1));
+    gate->add(*(sub_container0.taskflow), sub_container0.input);
     container.containers.push_back(std::move(sub_container0));
 
     // Each approach and departure depend on raster
@@ -160,11 +141,15 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
     transition_from_end_input.setEndInstruction(std::vector<std::size_t>({ input_idx + 1, 0 }));
     TaskflowContainer sub_container1 = transition_taskflow_generator_->generateTaskflow(
         transition_from_end_input,
-        [=]() { successTask(input, name_, transition_from_end_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(
+              input, input_idx, 2, name_, transition_from_end_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_from_end_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_from_end_step = container.taskflow->composed_of(*(sub_container1.taskflow))
                                         .name("transition_" + std::to_string(transition_idx + 1));
+    gate->add(*(sub_container1.taskflow), sub_container1.input);
     container.containers.push_back(std::move(sub_container1));
 
     // Each transition is independent and thus depends only on the adjacent rasters approach and departure
@@ -176,11 +161,15 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
     transition_to_start_input.setEndInstruction(std::vector<std::size_t>({ input_idx - 1, 0 }));
     TaskflowContainer sub_container2 = transition_taskflow_generator_->generateTaskflow(
         transition_to_start_input,
-        [=]() { successTask(input, name_, transition_to_start_input.getInstruction()->getDescription(), done_cb); },
+        [=]() {
+          successTask(
+              input, input_idx, 2, name_, transition_to_start_input.getInstruction()->getDescription(), done_cb);
+        },
         [=]() { failureTask(input, name_, transition_to_start_input.getInstruction()->getDescription(), error_cb); });
 
     auto transition_to_start_step = container.taskflow->composed_of(*(sub_container2.taskflow))
                                         .name("transition_" + std::to_string(transition_idx + 1));
+    gate->add(*(sub_container2.taskflow), sub_container2.input);
 
     // Each transition is independent and thus depends only on the adjacent rasters approach and departure
     transition_to_start_step.succeed(raster_tasks[transition_idx][2]);
@@ -191,15 +180,15 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
 
   // Plan from_start - preceded by the first raster
   TaskInput from_start_input = input[0];
-  from_start_input.setStartInstruction(
-      input.getInstruction()->cast_const<CompositeInstruction>()->getStartInstruction());
+  from_start_input.setStartInstructionFromInput(std::vector<std::size_t>());
   from_start_input.setEndInstruction(std::vector<std::size_t>({ 1, 0 }));
   TaskflowContainer sub_container1 = freespace_taskflow_generator_->generateTaskflow(
       from_start_input,
-      [=]() { successTask(input, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
+      [=]() { successTask(input, 0, 1, name_, from_start_input.getInstruction()->getDescription(), done_cb); },
       [=]() { failureTask(input, name_, from_start_input.getInstruction()->getDescription(), error_cb); });
 
   auto from_start = container.taskflow->composed_of(*(sub_container1.taskflow)).name("from_start");
+  gate->add(*(sub_container1.taskflow), sub_container1.input);
   container.containers.push_back(std::move(sub_container1));
   raster_tasks[0][0].precede(from_start);
 
@@ -208,10 +197,13 @@ TaskflowContainer RasterWAADDTTaskflow::generateTaskflow(TaskInput input,
   to_end_input.setStartInstruction(std::vector<std::size_t>({ input.size() - 2, 2 }));
   TaskflowContainer sub_container2 = freespace_taskflow_generator_->generateTaskflow(
       to_end_input,
-      [=]() { successTask(input, name_, to_end_input.getInstruction()->getDescription(), done_cb); },
+      [=]() {
+        successTask(input, input.size() - 1, 1, name_, to_end_input.getInstruction()->getDescription(), done_cb);
+      },
       [=]() { failureTask(input, name_, to_end_input.getInstruction()->getDescription(), error_cb); });
 
   auto to_end = container.taskflow->composed_of(*(sub_container2.taskflow)).name("to_end");
+  gate->add(*(sub_container2.taskflow), sub_container2.input);
   container.containers.push_back(std::move(sub_container2));
   raster_tasks.back()[2].precede(to_end);
 
@@ -87,11 +87,8 @@ TaskflowContainer TrajOptTaskflow::generateTaskflow(TaskInput input, TaskflowVoi
   auto interpolator = std::make_shared<SimpleMotionPlanner>("Interpolator");
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<SimplePlannerPlanProfile>())
-      interpolator->plan_profiles = input.profiles->getProfileEntry<SimplePlannerPlanProfile>();
-
-    if (input.profiles->hasProfileEntry<SimplePlannerCompositeProfile>())
-      interpolator->composite_profiles = input.profiles->getProfileEntry<SimplePlannerCompositeProfile>();
+    interpolator->shared_plan_profiles = input.profiles->getProfileEntryPtr<SimplePlannerPlanProfile>();
+    interpolator->shared_composite_profiles = input.profiles->getProfileEntryPtr<SimplePlannerCompositeProfile>();
   }
   TaskGenerator::UPtr interpolator_generator = std::make_unique<MotionPlannerTaskGenerator>(interpolator);
   interpolator_generator->assignConditionalTask(input, interpolator_task);
@@ -109,14 +106,9 @@ TaskflowContainer TrajOptTaskflow::generateTaskflow(TaskInput input, TaskflowVoi
   trajopt_planner->problem_generator = &DefaultTrajoptProblemGenerator;
   if (input.profiles)
   {
-    if (input.profiles->hasProfileEntry<TrajOptPlanProfile>())
-      trajopt_planner->plan_profiles = input.profiles->getProfileEntry<TrajOptPlanProfile>();
-
-    if (input.profiles->hasProfileEntry<TrajOptCompositeProfile>())
-      trajopt_planner->composite_profiles = input.profiles->getProfileEntry<TrajOptCompositeProfile>();
-
-    if (input.profiles->hasProfileEntry<TrajOptSolverProfile>())
-      trajopt_planner->solver_profiles = input.profiles->getProfileEntry<TrajOptSolverProfile>();
+    trajopt_planner->shared_plan_profiles = input.profiles->getProfileEntryPtr<TrajOptPlanProfile>();
+    trajopt_planner->shared_composite_profiles = input.profiles->getProfileEntryPtr<TrajOptCompositeProfile>();
+    trajopt_planner->shared_solver_profiles = input.profiles->getProfileEntryPtr<TrajOptSolverProfile>();
   }
   TaskGenerator::UPtr trajopt_generator = std::make_unique<MotionPlannerTaskGenerator>(trajopt_planner);
   trajopt_generator->assignConditionalTask(input, trajopt_task);
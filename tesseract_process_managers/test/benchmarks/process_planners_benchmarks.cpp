@@ -0,0 +1,441 @@
+/**
+ * @file process_planners_benchmarks.cpp
+ * @brief End to end benchmarks of the default process planners over parameterized scenes
+ *
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2020, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+#include <tesseract_motion_planners/simple/profile/simple_planner_default_plan_profile.h>
+#include <tesseract_process_managers/core/process_planning_server.h>
+
+#include "freespace_example_program.h"
+
+using namespace tesseract_planning;
+using namespace tesseract_scene_graph;
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+/** @brief The structure of the program expected by a process planner */
+enum class BenchmarkProgramType
+{
+  FREESPACE,
+  RASTER,
+  RASTER_ONLY,
+  RASTER_DT,
+  RASTER_WAAD,
+  RASTER_WAAD_DT
+};
+
+/** @brief The profiles used by the programs */
+static const std::string PROCESS_PROFILE = "PROCESS";
+static const std::string APPROACH_PROFILE = "APPROACH";
+static const std::string DEPARTURE_PROFILE = "DEPARTURE";
+
+/** @brief The process planners which are benchmarked with the program they expect */
+static const std::vector<std::pair<std::string, BenchmarkProgramType>> BENCHMARK_PLANNERS = {
+  { process_planner_names::TRAJOPT_PLANNER_NAME, BenchmarkProgramType::FREESPACE },
+  { process_planner_names::OMPL_PLANNER_NAME, BenchmarkProgramType::FREESPACE },
+  { process_planner_names::FREESPACE_PLANNER_NAME, BenchmarkProgramType::FREESPACE },
+  { process_planner_names::RASTER_FT_PLANNER_NAME, BenchmarkProgramType::RASTER },
+  { process_planner_names::RASTER_CT_PLANNER_NAME, BenchmarkProgramType::RASTER },
+  { process_planner_names::RASTER_G_FT_PLANNER_NAME, BenchmarkProgramType::RASTER },
+  { process_planner_names::RASTER_G_CT_PLANNER_NAME, BenchmarkProgramType::RASTER },
+  { process_planner_names::RASTER_O_FT_PLANNER_NAME, BenchmarkProgramType::RASTER_ONLY },
+  { process_planner_names::RASTER_O_CT_PLANNER_NAME, BenchmarkProgramType::RASTER_ONLY },
+  { process_planner_names::RASTER_O_G_FT_PLANNER_NAME, BenchmarkProgramType::RASTER_ONLY },
+  { process_planner_names::RASTER_O_G_CT_PLANNER_NAME, BenchmarkProgramType::RASTER_ONLY },
+  { process_planner_names::RASTER_FT_DT_PLANNER_NAME, BenchmarkProgramType::RASTER_DT },
+  { process_planner_names::RASTER_CT_DT_PLANNER_NAME, BenchmarkProgramType::RASTER_DT },
+  { process_planner_names::RASTER_FT_WAAD_PLANNER_NAME, BenchmarkProgramType::RASTER_WAAD },
+  { process_planner_names::RASTER_CT_WAAD_PLANNER_NAME, BenchmarkProgramType::RASTER_WAAD },
+  { process_planner_names::RASTER_FT_WAAD_DT_PLANNER_NAME, BenchmarkProgramType::RASTER_WAAD_DT },
+  { process_planner_names::RASTER_CT_WAAD_DT_PLANNER_NAME, BenchmarkProgramType::RASTER_WAAD_DT }
+};
+
+/**
+ * @brief Create the environment of a scene
+ * @details The obstacles are small boxes behind the robot and below the rasters, placed by a fixed seed so every run
+ * uses the same scene. They add to the cost of contact checking without blocking the programs.
+ * @param obstacles The number of obstacles
+ * @return The environment
+ */
+static tesseract_environment::Environment::Ptr createBenchmarkEnvironment(long obstacles)
+{
+  ResourceLocator::Ptr locator = std::make_shared<SimpleResourceLocator>(locateResource);
+  auto env = std::make_shared<tesseract_environment::Environment>();
+  boost::filesystem::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.urdf");
+  boost::filesystem::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.srdf");
+  env->init<tesseract_environment::OFKTStateSolver>(urdf_path, srdf_path, locator);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> unit(0, 1);
+  for (long i = 0; i < obstacles; ++i)
+  {
+    Eigen::Vector3d position;
+    if (i % 2 == 0)
+      position = Eigen::Vector3d(-0.6 - 0.6 * unit(generator), -1 + 2 * unit(generator), 0.2 + unit(generator));
+    else
+      position = Eigen::Vector3d(0.7 + 0.5 * unit(generator), -0.5 + unit(generator), 0.2 + 0.4 * unit(generator));
+
+    Link link("benchmark_obstacle_" + std::to_string(i));
+    Visual::Ptr visual = std::make_shared<Visual>();
+    visual->origin = Eigen::Isometry3d::Identity();
+    visual->origin.translation() = position;
+    visual->geometry = std::make_shared<tesseract_geometry::Box>(0.05, 0.05, 0.05);
+    link.visual.push_back(visual);
+
+    Collision::Ptr collision = std::make_shared<Collision>();
+    collision->origin = visual->origin;
+    collision->geometry = visual->geometry;
+    link.collision.push_back(collision);
+
+    Joint joint("benchmark_obstacle_joint_" + std::to_string(i));
+    joint.parent_link_name = "base_link";
+    joint.child_link_name = link.getName();
+    joint.type = JointType::FIXED;
+
+    env->addLink(std::move(link), std::move(joint));
+  }
+
+  return env;
+}
+
+static Waypoint rasterWaypoint(double x, double y, double z)
+{
+  return CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(x, y, z) *
+                           Eigen::Quaterniond(0, 0, -1.0, 0));
+}
+
+static CompositeInstruction freespaceComposite(const Waypoint& waypoint, const std::string& description)
+{
+  PlanInstruction plan(waypoint, PlanInstructionType::FREESPACE, DEFAULT_PROFILE_KEY);
+  plan.setDescription(description + "_plan");
+  CompositeInstruction composite(DEFAULT_PROFILE_KEY);
+  composite.setDescription(description);
+  composite.push_back(plan);
+  return composite;
+}
+
+/**
+ * @brief Create the program of a scene, following the structure of the raster example programs
+ * @details The rasters are spread over the same area of the workspace regardless of their number
+ * @param type The structure of the program
+ * @param rasters The number of rasters
+ * @param waypoints The number of waypoints per raster, including its start
+ * @return The program
+ */
+static CompositeInstruction createBenchmarkProgram(BenchmarkProgramType type, long rasters, long waypoints)
+{
+  if (type == BenchmarkProgramType::FREESPACE)
+    return freespaceExampleProgramABB();
+
+  const bool raster_only = (type == BenchmarkProgramType::RASTER_ONLY);
+  const bool dual_transitions =
+      (type == BenchmarkProgramType::RASTER_DT || type == BenchmarkProgramType::RASTER_WAAD_DT);
+  const bool approach_departure =
+      (type == BenchmarkProgramType::RASTER_WAAD || type == BenchmarkProgramType::RASTER_WAAD_DT);
+  const double z = 0.8;
+  const double transition_z = approach_departure ? 0.85 : z;
+  auto raster_x = [rasters](long i) {
+    return 0.8 + 0.3 * static_cast<double>(i) / static_cast<double>(std::max(rasters - 1, 1L));
+  };
+  auto raster_start_y = [](long i) { return (i % 2 == 0) ? -0.3 : 0.3; };
+
+  CompositeInstruction program(DEFAULT_PROFILE_KEY, CompositeInstructionOrder::ORDERED, ManipulatorInfo("manipulator"));
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  StateWaypoint home(joint_names, Eigen::VectorXd::Zero(6));
+  if (raster_only)
+  {
+    program.setStartInstruction(PlanInstruction(rasterWaypoint(raster_x(0), -0.3, z), PlanInstructionType::START));
+  }
+  else
+  {
+    program.setStartInstruction(PlanInstruction(home, PlanInstructionType::START));
+    program.push_back(freespaceComposite(rasterWaypoint(raster_x(0), -0.3, transition_z), "from_start"));
+  }
+
+  for (long i = 0; i < rasters; ++i)
+  {
+    const double x = raster_x(i);
+    const double start_y = raster_start_y(i);
+    const double end_y = -start_y;
+
+    CompositeInstruction process_segment(PROCESS_PROFILE);
+    process_segment.setDescription("Raster #" + std::to_string(i + 1));
+    for (long j = 1; j < waypoints; ++j)
+    {
+      double y = start_y + (end_y - start_y) * static_cast<double>(j) / static_cast<double>(waypoints - 1);
+      process_segment.push_back(PlanInstruction(rasterWaypoint(x, y, z), PlanInstructionType::LINEAR, PROCESS_PROFILE));
+    }
+
+    if (approach_departure)
+    {
+      CompositeInstruction approach_segment(APPROACH_PROFILE);
+      approach_segment.setDescription("Raster Approach #" + std::to_string(i + 1));
+      approach_segment.push_back(
+          PlanInstruction(rasterWaypoint(x, start_y, z), PlanInstructionType::LINEAR, APPROACH_PROFILE));
+
+      CompositeInstruction departure_segment(DEPARTURE_PROFILE);
+      departure_segment.setDescription("Raster Departure #" + std::to_string(i + 1));
+      departure_segment.push_back(
+          PlanInstruction(rasterWaypoint(x, end_y, transition_z), PlanInstructionType::LINEAR, DEPARTURE_PROFILE));
+
+      CompositeInstruction raster_segment;
+      raster_segment.push_back(approach_segment);
+      raster_segment.push_back(process_segment);
+      raster_segment.push_back(departure_segment);
+      program.push_back(raster_segment);
+    }
+    else
+    {
+      program.push_back(process_segment);
+    }
+
+    if (i + 1 == rasters)
+      break;
+
+    // The next raster starts where this one ended
+    CompositeInstruction transition_from_end =
+        freespaceComposite(rasterWaypoint(raster_x(i + 1), end_y, transition_z), "transition_from_end");
+    if (dual_transitions)
+    {
+      CompositeInstruction transition("transition dual", CompositeInstructionOrder::UNORDERED);
+      transition.push_back(transition_from_end);
+      transition.push_back(freespaceComposite(rasterWaypoint(x, start_y, transition_z), "transition_to_start"));
+      program.push_back(transition);
+    }
+    else
+    {
+      program.push_back(transition_from_end);
+    }
+  }
+
+  if (!raster_only)
+    program.push_back(freespaceComposite(home, "to_end"));
+
+  return program;
+}
+
+/** @brief Create a planning server of a scene with the default process planners */
+static std::unique_ptr<ProcessPlanningServer> createBenchmarkServer(long obstacles, std::size_t threads)
+{
+  auto cache = std::make_shared<ProcessEnvironmentCache>(createBenchmarkEnvironment(obstacles));
+  auto server = std::make_unique<ProcessPlanningServer>(cache, threads);
+  server->loadDefaultProcessPlanners();
+
+  auto simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = server->getProfiles();
+  for (const auto& profile : { DEFAULT_PROFILE_KEY, PROCESS_PROFILE, APPROACH_PROFILE, DEPARTURE_PROFILE })
+    profiles->addProfile<SimplePlannerPlanProfile>(profile, simple_plan_profile);
+
+  return server;
+}
+
+/** @brief Get the peak resident set size of the process in megabytes, zero if not supported */
+static double getPeakRSS()
+{
+#ifndef _WIN32
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+#ifdef __APPLE__
+  return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+#else
+  return 0;
+#endif
+}
+
+/** @brief Get a percentile of sorted values using the nearest rank */
+static double getPercentile(const std::vector<double>& sorted, double percentile)
+{
+  if (sorted.empty())
+    return 0;
+
+  auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+  return sorted[std::min(std::max(rank, std::size_t(1)), sorted.size()) - 1];
+}
+
+/**
+ * @brief The latency of a single request, the arguments are the number of rasters, waypoints per raster and obstacles
+ * @details Each iteration submits one request and waits for it. The latency percentiles are reported in milliseconds
+ * over the iterations, so the minimum time should allow for several iterations.
+ */
+static void BM_PROCESS_PLANNER_LATENCY(benchmark::State& state, const std::string& name, BenchmarkProgramType type)
+{
+  std::unique_ptr<ProcessPlanningServer> server = createBenchmarkServer(state.range(2), 1);
+
+  ProcessPlanningRequest request;
+  request.name = name;
+  request.instructions = Instruction(createBenchmarkProgram(type, state.range(0), state.range(1)));
+
+  std::vector<double> latencies;
+  long failures = 0;
+  for (auto _ : state)
+  {
+    auto start = std::chrono::steady_clock::now();
+    ProcessPlanningFuture response = server->run(request);
+    response.wait();
+    latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+    if (!response.interface->isSuccessful())
+      ++failures;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_ms"] = getPercentile(latencies, 50);
+  state.counters["p90_ms"] = getPercentile(latencies, 90);
+  state.counters["p99_ms"] = getPercentile(latencies, 99);
+  state.counters["failures"] = static_cast<double>(failures);
+  state.counters["peak_rss_mb"] = getPeakRSS();
+}
+
+/**
+ * @brief The throughput of concurrent requests, the arguments are the number of rasters, waypoints per raster,
+ * obstacles and concurrent requests
+ * @details Each iteration submits the concurrent requests to a server with one thread per request and waits for all
+ * of them. The throughput is reported in requests per second of wall clock time.
+ */
+static void BM_PROCESS_PLANNER_THROUGHPUT(benchmark::State& state, const std::string& name, BenchmarkProgramType type)
+{
+  const auto concurrency = static_cast<std::size_t>(state.range(3));
+  std::unique_ptr<ProcessPlanningServer> server = createBenchmarkServer(state.range(2), concurrency);
+
+  ProcessPlanningRequest request;
+  request.name = name;
+  request.instructions = Instruction(createBenchmarkProgram(type, state.range(0), state.range(1)));
+
+  long failures = 0;
+  for (auto _ : state)
+  {
+    std::vector<ProcessPlanningFuture> responses;
+    responses.reserve(concurrency);
+    for (std::size_t i = 0; i < concurrency; ++i)
+      responses.push_back(server->run(request));
+
+    for (const auto& response : responses)
+    {
+      response.wait();
+      if (!response.interface->isSuccessful())
+        ++failures;
+    }
+  }
+
+  state.counters["requests_per_second"] =
+      benchmark::Counter(static_cast<double>(concurrency), benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["failures"] = static_cast<double>(failures);
+  state.counters["peak_rss_mb"] = getPeakRSS();
+}
+
+/**
+ * @brief Register the benchmarks of every process planner
+ * @details Individual planners and scenes are selected with --benchmark_filter, for example
+ * --benchmark_filter=RasterFTPlanner/LATENCY/rasters:4. Freespace planners only use the obstacles of a scene. The
+ * peak RSS is the peak of the process so far, so run a single benchmark per process to compare it.
+ */
+int main(int argc, char** argv)
+{
+  const std::vector<long> rasters = { 2, 4, 8 };
+  const std::vector<long> waypoints = { 7, 15 };
+  const std::vector<long> obstacles = { 0, 32 };
+  const std::vector<long> concurrency = { 1, 2, 4 };
+
+  for (const auto& planner : BENCHMARK_PLANNERS)
+  {
+    const bool freespace = (planner.second == BenchmarkProgramType::FREESPACE);
+
+    auto* latency = benchmark::RegisterBenchmark(
+        (planner.first + "/LATENCY").c_str(), BM_PROCESS_PLANNER_LATENCY, planner.first, planner.second);
+    latency->ArgNames({ "rasters", "waypoints", "obstacles" })->UseRealTime()->Unit(benchmark::kMillisecond);
+    latency->MinTime(10);
+    for (long o : obstacles)
+    {
+      if (freespace)
+      {
+        latency->Args({ 0, 0, o });
+        continue;
+      }
+
+      for (long r : rasters)
+        for (long w : waypoints)
+          latency->Args({ r, w, o });
+    }
+
+    auto* throughput = benchmark::RegisterBenchmark(
+        (planner.first + "/THROUGHPUT").c_str(), BM_PROCESS_PLANNER_THROUGHPUT, planner.first, planner.second);
+    throughput->ArgNames({ "rasters", "waypoints", "obstacles", "concurrency" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+    for (long c : concurrency)
+      throughput->Args({ freespace ? 0 : 4, freespace ? 0 : 7, 0, c });
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -1,18 +1,36 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/core/environment.h>
 #include <tesseract_environment/ofkt/ofkt_state_solver.h>
 
+#include <tesseract_command_language/utils/utils.h>
+
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_default_plan_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
 #include <tesseract_motion_planners/interface_utils.h>
+#include <tesseract_motion_planners/trajopt/profile/trajopt_default_plan_profile.h>
+#include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
 
 #include <tesseract_process_managers/core/task_input.h>
+#include <tesseract_process_managers/core/segment_stream.h>
+#include <tesseract_process_managers/core/request_queue.h>
+#include <tesseract_process_managers/core/result_cache.h>
+#include <tesseract_process_managers/core/request_bundle.h>
+#include <tesseract_process_managers/core/utils.h>
 #include <tesseract_process_managers/core/process_planning_server.h>
 #include <tesseract_process_managers/taskflow_generators/raster_taskflow.h>
 #include <tesseract_process_managers/taskflow_generators/raster_global_taskflow.h>
@@ -26,6 +44,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_process_managers/taskflow_generators/descartes_taskflow.h>
 #include <tesseract_process_managers/taskflow_generators/trajopt_taskflow.h>
 #include <tesseract_process_managers/task_generators/seed_min_length_task_generator.h>
+#include <tesseract_process_managers/task_generators/experience_seed_task_generator.h>
+#include <tesseract_process_managers/task_generators/experience_record_task_generator.h>
 
 #include "raster_example_program.h"
 #include "raster_dt_example_program.h"
@@ -87,6 +107,29 @@ protected:
   }
 };
 
+/** @brief Generates a sub-taskflow of a single task which calls the callback */
+class CallbackTaskflowGenerator : public TaskflowGenerator
+{
+public:
+  CallbackTaskflowGenerator(std::function<void()> callback) : callback_(std::move(callback)) {}
+
+  const std::string& getName() const override { return name_; }
+
+  TaskflowContainer generateTaskflow(TaskInput /*instruction*/,
+                                     TaskflowVoidFn /*done_cb*/,
+                                     TaskflowVoidFn /*error_cb*/) override
+  {
+    TaskflowContainer container;
+    container.taskflow = std::make_unique<tf::Taskflow>(name_);
+    container.input = container.taskflow->emplace(callback_).name(name_);
+    return container;
+  }
+
+private:
+  std::string name_{ "CallbackTaskflow" };
+  std::function<void()> callback_;
+};
+
 TEST_F(TesseractProcessManagerUnit, SeedMinLengthTaskGeneratorTest)
 {
   tesseract_planning::CompositeInstruction program = freespaceExampleProgramABB();
@@ -125,6 +168,752 @@ TEST_F(TesseractProcessManagerUnit, SeedMinLengthTaskGeneratorTest)
   EXPECT_TRUE(final_length3 >= (3 * current_length));
 }
 
+/** @brief The number of lines of a file */
+static std::size_t getLineCount(const std::string& file_path)
+{
+  std::ifstream is(file_path);
+  std::size_t lines{ 0 };
+  std::string line;
+  while (std::getline(is, line))
+    ++lines;
+  return lines;
+}
+
+TEST_F(TesseractProcessManagerUnit, ExperienceLibraryTest)
+{
+  std::string file_path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+  auto library = std::make_shared<ExperienceLibrary>(file_path);
+  EXPECT_EQ(library->size(), 0UL);
+
+  Experience experience;
+  experience.manipulator = "manipulator";
+  experience.joint_names = { "joint_1", "joint_2" };
+  experience.revision = 1;
+  experience.trajectory.resize(3, 2);
+  experience.trajectory << 0, 0, 0.5, 1, 1, 1;
+  EXPECT_TRUE(library->add(experience));
+
+  // Adding an experience with the same start and goal replaces it
+  EXPECT_TRUE(library->add(experience));
+  EXPECT_EQ(library->size(), 1UL);
+
+  Experience invalid = experience;
+  invalid.trajectory.resize(1, 2);
+  EXPECT_FALSE(library->add(invalid));
+
+  Experience found;
+  Eigen::Vector2d start(0.05, 0);
+  Eigen::Vector2d goal(1, 0.95);
+  EXPECT_TRUE(library->lookup(found, "manipulator", experience.joint_names, start, goal, 2, 0.1));
+  EXPECT_TRUE(found.trajectory.isApprox(experience.trajectory));
+  EXPECT_FALSE(library->lookup(found, "manipulator", experience.joint_names, start, goal, 2, 0.01));
+  EXPECT_FALSE(library->lookup(found, "other", experience.joint_names, start, goal, 2, 0.1));
+
+  // Experiences of the same environment revision are preferred
+  Experience nearer = experience;
+  nearer.revision = 2;
+  nearer.trajectory.row(0) << 0.04, 0;
+  EXPECT_TRUE(library->add(nearer));
+  EXPECT_TRUE(library->lookup(found, "manipulator", experience.joint_names, start, goal, 1, 0.1));
+  EXPECT_EQ(found.revision, 1);
+  EXPECT_TRUE(library->lookup(found, "manipulator", experience.joint_names, start, goal, 2, 0.1));
+  EXPECT_EQ(found.revision, 2);
+
+  // The experiences are restored from the file
+  ExperienceLibrary restored(file_path);
+  EXPECT_EQ(restored.size(), 2UL);
+  EXPECT_TRUE(restored.lookup(found, "manipulator", experience.joint_names, start, goal, 1, 0.1));
+  EXPECT_TRUE(found.trajectory.isApprox(experience.trajectory));
+  EXPECT_EQ(found.joint_names, experience.joint_names);
+
+  // The replaced experience is dropped from the file when it is loaded
+  EXPECT_EQ(getLineCount(file_path), 2UL);
+
+  boost::filesystem::remove(file_path);
+}
+
+TEST_F(TesseractProcessManagerUnit, ExperienceLibraryFileTest)
+{
+  std::string file_path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+
+  // Names containing whitespace, quotes and backslashes are restored from the file
+  Experience experience;
+  experience.manipulator = "left arm";
+  experience.joint_names = { "joint \"1\"", "joint\\2\n" };
+  experience.trajectory.resize(2, 2);
+  experience.trajectory << 0, 0, 1, 1;
+  {
+    ExperienceLibrary library(file_path);
+    EXPECT_TRUE(library.add(experience));
+  }
+  {
+    ExperienceLibrary restored(file_path);
+    Experience found;
+    EXPECT_TRUE(restored.lookup(found, "left arm", experience.joint_names, Eigen::Vector2d(0, 0),
+                                Eigen::Vector2d(1, 1), -1, 0.1));
+    EXPECT_EQ(found.joint_names, experience.joint_names);
+  }
+  boost::filesystem::remove(file_path);
+
+  // The file is compacted when it has more than twice the maximum number of experiences
+  ExperienceLibrary library(file_path, 2);
+  for (int i = 0; i < 10; ++i)
+  {
+    experience.trajectory(1, 0) = i;
+    EXPECT_TRUE(library.add(experience));
+    EXPECT_LE(getLineCount(file_path), 4UL);
+  }
+  EXPECT_EQ(library.size(), 2UL);
+  EXPECT_EQ(ExperienceLibrary(file_path, 2).size(), 2UL);
+
+  boost::filesystem::remove(file_path);
+}
+
+TEST_F(TesseractProcessManagerUnit, ExperienceSeedTaskGeneratorTest)
+{
+  tesseract_planning::CompositeInstruction program = freespaceExampleProgramABB();
+  program.setManipulatorInfo(manip);
+
+  auto cur_state = env_->getCurrentState();
+  CompositeInstruction seed = generateSeed(program, cur_state, env_);
+
+  Instruction program_instruction = program;
+  Instruction seed_instruction = seed;
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, true, nullptr);
+
+  auto library = std::make_shared<ExperienceLibrary>();
+  ExperienceSeedTaskGenerator seed_generator(library);
+  EXPECT_GT(seed_generator.config.collision_margin_data.getMaxCollisionMargin(), 0);
+  EXPECT_EQ(seed_generator.conditionalProcess(input, 1), 0);
+
+  // The seed is recorded and used to seed the same motion
+  ExperienceRecordTaskGenerator record_generator(library);
+  EXPECT_EQ(record_generator.conditionalProcess(input, 2), 1);
+  EXPECT_EQ(library->size(), 1UL);
+
+  long seed_length = getMoveInstructionCount(seed);
+  EXPECT_EQ(seed_generator.conditionalProcess(input, 3), 1);
+  EXPECT_EQ(getMoveInstructionCount(*(input.getResults()->cast_const<CompositeInstruction>())), seed_length);
+}
+
+/** @brief Add a fixed box link to an environment */
+static void addBoxLink(Environment& env, const std::string& name)
+{
+  Link link(name);
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(-1, 0, 0.5);
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1);
+  link.collision.push_back(collision);
+
+  Joint joint(name + "_joint");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = name;
+  joint.type = JointType::FIXED;
+
+  EXPECT_TRUE(env.addLink(std::move(link), std::move(joint)));
+}
+
+TEST_F(TesseractProcessManagerUnit, ProcessEnvironmentCacheTest)
+{
+  Environment::Ptr env = env_->clone();
+  auto cache = std::make_shared<ProcessEnvironmentCache>(env, 2);
+  EXPECT_EQ(cache->getCacheSize(), 2);
+
+  // A released environment is returned to the cache and leased next
+  Environment* returned{ nullptr };
+  {
+    Environment::Ptr leased = cache->getCachedEnvironment();
+    ASSERT_TRUE(leased != nullptr);
+    EXPECT_EQ(leased->getRevision(), env->getRevision());
+    returned = leased.get();
+  }
+  {
+    Environment::Ptr leased = cache->getCachedEnvironment();
+    EXPECT_EQ(leased.get(), returned);
+  }
+
+  // After a revision change the cached environment is updated by replaying the new commands instead of cloning
+  addBoxLink(*env, "cache_test_box");
+  {
+    Environment::Ptr leased = cache->getCachedEnvironment();
+    EXPECT_EQ(leased.get(), returned);
+    EXPECT_EQ(leased->getRevision(), env->getRevision());
+    EXPECT_TRUE(leased->getLink("cache_test_box") != nullptr);
+  }
+
+  // An environment which had commands applied while leased is discarded
+  {
+    Environment::Ptr leased = cache->getCachedEnvironment();
+    addBoxLink(*leased, "leased_box");
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    Environment::Ptr leased = cache->getCachedEnvironment();
+    EXPECT_TRUE(leased->getLink("leased_box") == nullptr);
+    EXPECT_EQ(leased->getRevision(), env->getRevision());
+  }
+
+  // Leased environments must remain valid after the cache is destroyed
+  Environment::Ptr leased1 = cache->getCachedEnvironment();
+  Environment::Ptr leased2 = cache->getCachedEnvironment();
+  cache = nullptr;
+  EXPECT_EQ(leased1->getRevision(), env->getRevision());
+  EXPECT_EQ(leased2->getRevision(), env->getRevision());
+}
+
+TEST_F(TesseractProcessManagerUnit, TaskInputTest)
+{
+  CompositeInstruction program = rasterExampleProgram();
+  Instruction program_instruction = program;
+  Instruction seed_instruction = generateSkeletonSeed(program);
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, false, nullptr);
+  EXPECT_EQ(input.size(), program.size());
+
+  TaskInput raster_input = input[1];
+  EXPECT_EQ(raster_input.getInstruction(), &(program_instruction.cast_const<CompositeInstruction>()->at(1)));
+  EXPECT_EQ(raster_input.getResults(), &(seed_instruction.cast<CompositeInstruction>()->at(1)));
+  EXPECT_EQ(raster_input.size(), program.at(1).cast_const<CompositeInstruction>()->size());
+  EXPECT_TRUE(isNullInstruction(raster_input.getStartInstruction()));
+
+  // Copies share the start instruction which is returned by reference
+  raster_input.setStartInstructionFromInput(std::vector<std::size_t>({ 0 }));
+  TaskInput raster_copy = raster_input;
+  EXPECT_TRUE(isPlanInstruction(raster_input.getStartInstruction()));
+  EXPECT_EQ(&raster_input.getStartInstruction(), &raster_copy.getStartInstruction());
+  EXPECT_TRUE(raster_input.getStartInstruction().cast_const<PlanInstruction>()->isStart());
+
+  // Replacing the content of the program is picked up once the interface is reset
+  program_instruction = Instruction(rasterExampleProgram());
+  raster_input.getTaskInterface()->reset();
+  EXPECT_EQ(raster_input.getInstruction(), &(program_instruction.cast_const<CompositeInstruction>()->at(1)));
+  EXPECT_EQ(raster_copy.getInstruction(), raster_input.getInstruction());
+
+  // Tasks resolving the instruction concurrently after a reset agree on it
+  program_instruction = Instruction(rasterExampleProgram());
+  raster_input.getTaskInterface()->reset();
+  std::vector<const Instruction*> resolved(4, nullptr);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < resolved.size(); ++i)
+    threads.emplace_back([&resolved, &raster_input, i]() { resolved[i] = raster_input[0].getInstruction(); });
+  for (auto& thread : threads)
+    thread.join();
+  const auto* raster = program_instruction.cast_const<CompositeInstruction>()->at(1).cast_const<CompositeInstruction>();
+  for (const Instruction* instruction : resolved)
+    EXPECT_EQ(instruction, &(raster->at(0)));
+}
+
+TEST_F(TesseractProcessManagerUnit, TimingHistogramTest)
+{
+  TimingHistogram histogram;
+  EXPECT_EQ(histogram.getCount(), 0UL);
+  EXPECT_DOUBLE_EQ(histogram.getPercentile(50), 0);
+
+  for (int i = 1; i <= 100; ++i)
+    histogram.add(i * 1e-3);
+
+  EXPECT_EQ(histogram.getCount(), 100UL);
+  EXPECT_DOUBLE_EQ(histogram.getMin(), 1e-3);
+  EXPECT_DOUBLE_EQ(histogram.getMax(), 0.1);
+  EXPECT_NEAR(histogram.getMean(), 0.0505, 1e-9);
+
+  // Percentiles are estimated by the upper bound of the bucket which is at most twice the exact value
+  EXPECT_GE(histogram.getPercentile(50), 0.05);
+  EXPECT_LE(histogram.getPercentile(50), 0.1);
+  EXPECT_DOUBLE_EQ(histogram.getPercentile(100), 0.1);
+
+  TimingHistogram merged;
+  merged.add(1.0);
+  merged.merge(histogram);
+  EXPECT_EQ(merged.getCount(), 101UL);
+  EXPECT_DOUBLE_EQ(merged.getMin(), 1e-3);
+  EXPECT_DOUBLE_EQ(merged.getMax(), 1.0);
+}
+
+TEST_F(TesseractProcessManagerUnit, TaskflowInterfaceDeadlineTest)
+{
+  TaskflowInterface interface;
+  EXPECT_EQ(interface.getDeadline(), std::chrono::steady_clock::time_point::max());
+  EXPECT_FALSE(interface.isAborted());
+
+  interface.setDeadline(std::chrono::steady_clock::now() + std::chrono::hours(1));
+  EXPECT_FALSE(interface.isAborted());
+  EXPECT_FALSE(interface.isTimedOut());
+
+  // Passing the deadline aborts the process and cancels its planners
+  interface.setDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+  EXPECT_TRUE(interface.isAborted());
+  EXPECT_TRUE(interface.isTimedOut());
+  EXPECT_FALSE(interface.isSuccessful());
+  EXPECT_TRUE(interface.getCancellationToken()->isCancelled());
+
+  interface.reset();
+  EXPECT_EQ(interface.getDeadline(), std::chrono::steady_clock::time_point::max());
+  EXPECT_FALSE(interface.isAborted());
+  EXPECT_FALSE(interface.isTimedOut());
+}
+
+TEST_F(TesseractProcessManagerUnit, TaskflowInterfaceBranchTest)
+{
+  auto interface = std::make_shared<TaskflowInterface>();
+  TaskflowInterface::Ptr branch1 = interface->createBranch();
+  TaskflowInterface::Ptr branch2 = interface->createBranch();
+  EXPECT_EQ(branch1->getGeneration(), interface->getGeneration());
+
+  // Aborting a branch does not abort the process or the other branches
+  branch1->abort();
+  EXPECT_TRUE(branch1->isAborted());
+  EXPECT_TRUE(branch1->getCancellationToken()->isCancelled());
+  EXPECT_FALSE(branch2->isAborted());
+  EXPECT_FALSE(interface->isAborted());
+
+  branch1->reset();
+  EXPECT_FALSE(branch1->isAborted());
+  EXPECT_EQ(branch1->getGeneration(), interface->getGeneration());
+
+  // Aborting the process aborts every branch
+  interface->abort();
+  EXPECT_TRUE(branch1->isAborted());
+  EXPECT_TRUE(branch2->getCancellationToken()->isCancelled());
+
+  // Branches share the deadline of the process
+  interface->reset();
+  EXPECT_FALSE(branch2->isAborted());
+  interface->setDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+  EXPECT_EQ(branch2->getDeadline(), interface->getDeadline());
+  EXPECT_TRUE(branch2->isAborted());
+  EXPECT_TRUE(branch2->isTimedOut());
+
+  // A branch of a TaskInput works on its own results
+  CompositeInstruction program = freespaceExampleProgramABB();
+  Instruction program_instruction = program;
+  Instruction seed_instruction = generateSkeletonSeed(program);
+  Instruction branch_instruction = seed_instruction;
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, false, nullptr);
+  TaskInput branch_input = input.createBranch(&branch_instruction);
+  EXPECT_EQ(branch_input.getResults(), &branch_instruction);
+  EXPECT_EQ(branch_input.getInstruction(), input.getInstruction());
+  branch_input.abort();
+  EXPECT_TRUE(branch_input.isAborted());
+  EXPECT_FALSE(input.isAborted());
+}
+
+TEST_F(TesseractProcessManagerUnit, SegmentStreamTest)
+{
+  SegmentStream stream;
+  std::vector<std::size_t> indices;
+  std::size_t id = stream.subscribe([&indices](std::size_t index, const Instruction&) { indices.push_back(index); });
+
+  // Segments are only streamed once every previous segment is complete
+  stream.complete(1, NullInstruction());
+  EXPECT_TRUE(indices.empty());
+  stream.complete(2, NullInstruction(), 2);
+  stream.complete(0, NullInstruction());
+  EXPECT_EQ(indices, std::vector<std::size_t>({ 0, 1 }));
+  stream.complete(2, NullInstruction(), 2);
+  EXPECT_EQ(indices, std::vector<std::size_t>({ 0, 1, 2 }));
+
+  // Repeated reports are ignored
+  stream.complete(1, NullInstruction());
+  EXPECT_EQ(stream.size(), 3UL);
+
+  // A late subscriber receives the segments already streamed
+  std::vector<std::size_t> late_indices;
+  stream.subscribe([&late_indices](std::size_t index, const Instruction&) { late_indices.push_back(index); });
+  EXPECT_EQ(late_indices, indices);
+
+  stream.unsubscribe(id);
+  stream.complete(3, NullInstruction());
+  EXPECT_EQ(indices.size(), 3UL);
+  EXPECT_EQ(late_indices.size(), 4UL);
+
+  stream.reset();
+  EXPECT_EQ(stream.size(), 0UL);
+
+  // Callbacks may use the stream, segments completed from a callback are passed after it returns
+  std::vector<std::size_t> reentrant_indices;
+  std::size_t reentrant_id{ 0 };
+  reentrant_id = stream.subscribe([&](std::size_t index, const Instruction&) {
+    reentrant_indices.push_back(index);
+    EXPECT_EQ(stream.size(), index + 2);
+    EXPECT_EQ(stream.getSegments().size(), index + 2);
+    if (index == 0)
+    {
+      stream.complete(2, NullInstruction());
+      EXPECT_EQ(reentrant_indices.size(), 1UL);
+    }
+    else if (index == 1)
+    {
+      stream.unsubscribe(reentrant_id);
+    }
+  });
+  stream.complete(1, NullInstruction());
+  stream.complete(0, NullInstruction());
+  EXPECT_EQ(reentrant_indices, std::vector<std::size_t>({ 0, 1 }));
+
+  // A callback which unsubscribed is not called again, a subscriber added from a callback receives every segment
+  std::vector<std::size_t> nested_indices;
+  std::size_t outer_id = stream.subscribe([&](std::size_t index, const Instruction&) {
+    if (index == 0)
+      stream.subscribe([&nested_indices](std::size_t i, const Instruction&) { nested_indices.push_back(i); });
+  });
+  stream.complete(3, NullInstruction());
+  EXPECT_EQ(reentrant_indices.size(), 2UL);
+  EXPECT_EQ(nested_indices, std::vector<std::size_t>({ 0, 1, 2, 3 }));
+  stream.unsubscribe(outer_id);
+
+  stream.reset();
+
+  // Only the segments of the program are streamed
+  CompositeInstruction program = rasterExampleProgram();
+  Instruction program_instruction = program;
+  Instruction seed_instruction = generateSkeletonSeed(program);
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, false, nullptr);
+  SegmentStream::Ptr input_stream = input.getTaskInterface()->getSegmentStream();
+  input[1].completeSegment(0);
+  EXPECT_EQ(input_stream->size(), 0UL);
+  input.completeSegment(0);
+  ASSERT_EQ(input_stream->size(), 1UL);
+  EXPECT_TRUE(isCompositeInstruction(input_stream->getSegments().front()));
+
+  input.getTaskInterface()->reset();
+  EXPECT_EQ(input_stream->size(), 0UL);
+}
+
+TEST_F(TesseractProcessManagerUnit, RequestQueueTest)
+{
+  auto executor = std::make_shared<tf::Executor>(2);
+  RequestQueue queue(executor);
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+
+  auto record = [&order_mutex, &order](const std::string& name) {
+    std::lock_guard<std::mutex> lock(order_mutex);
+    order.push_back(name);
+  };
+
+  // The blocking taskflows run until their promise is set
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  tf::Taskflow blocking;
+  blocking.emplace([released, &record]() {
+    released.wait();
+    record("blocking");
+  });
+  tf::Taskflow low;
+  low.emplace([&record]() { record("low"); });
+  tf::Taskflow high;
+  high.emplace([&record]() { record("high"); });
+
+  // Requests wait while the maximum number of requests is in flight and then start by priority
+  queue.setMaxInFlight(1);
+  std::future<void> blocking_future = queue.submit(blocking, nullptr, ProcessPlanningPriority::LOW);
+  std::future<void> low_future = queue.submit(low, nullptr, ProcessPlanningPriority::LOW);
+  std::future<void> high_future = queue.submit(high, nullptr, ProcessPlanningPriority::HIGH);
+  EXPECT_EQ(queue.getInFlight(), 1UL);
+  EXPECT_EQ(queue.getInFlight(ProcessPlanningPriority::LOW), 1UL);
+  EXPECT_EQ(queue.getQueueDepth(), 2UL);
+  EXPECT_EQ(queue.getQueueDepth(ProcessPlanningPriority::LOW), 1UL);
+  EXPECT_EQ(queue.getQueueDepth(ProcessPlanningPriority::HIGH), 1UL);
+
+  release.set_value();
+  queue.waitForAll();
+  blocking_future.wait();
+  low_future.wait();
+  high_future.wait();
+  EXPECT_EQ(order, std::vector<std::string>({ "blocking", "high", "low" }));
+  EXPECT_EQ(queue.getInFlight(), 0UL);
+  EXPECT_EQ(queue.getQueueDepth(), 0UL);
+
+  // Preemptible requests are held in the queue while a request of a higher priority is in flight
+  queue.setMaxInFlight(0);
+  order.clear();
+  std::promise<void> release_high;
+  std::shared_future<void> released_high = release_high.get_future().share();
+  tf::Taskflow blocking_high;
+  blocking_high.emplace([released_high, &record]() {
+    released_high.wait();
+    record("blocking");
+  });
+  tf::Taskflow preempted;
+  preempted.emplace([&record]() { record("preempted"); });
+  tf::Taskflow not_preemptible;
+  not_preemptible.emplace([&record]() { record("not preemptible"); });
+
+  blocking_future = queue.submit(blocking_high, nullptr, ProcessPlanningPriority::HIGH);
+  std::future<void> preempted_future = queue.submit(preempted, nullptr, ProcessPlanningPriority::NORMAL);
+  EXPECT_EQ(queue.getInFlight(), 1UL);
+  EXPECT_EQ(queue.getQueueDepth(ProcessPlanningPriority::NORMAL), 1UL);
+  EXPECT_EQ(queue.getPreempted(), 1UL);
+
+  // A request which is not preemptible starts while the higher priority request is in flight
+  std::future<void> not_preemptible_future =
+      queue.submit(not_preemptible, nullptr, ProcessPlanningPriority::LOW, false);
+  not_preemptible_future.wait();
+  EXPECT_EQ(queue.getPreempted(), 1UL);
+
+  release_high.set_value();
+  preempted_future.wait();
+  EXPECT_EQ(order, std::vector<std::string>({ "not preemptible", "blocking", "preempted" }));
+  EXPECT_EQ(queue.getPreempted(), 0UL);
+  queue.waitForAll();
+}
+
+TEST_F(TesseractProcessManagerUnit, RequestQueuePreemptionGateTest)
+{
+  // With a single worker the high priority request can only run before the remaining sub-taskflows of the raster if
+  // they are parked at the preemption gate
+  auto executor = std::make_shared<tf::Executor>(1);
+  RequestQueue queue(executor);
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+
+  auto record = [&order_mutex, &order](const std::string& name) {
+    std::lock_guard<std::mutex> lock(order_mutex);
+    order.push_back(name);
+  };
+
+  // The first sub-taskflow of the raster to run blocks the worker until its promise is set
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<bool> first{ true };
+  auto callback = [&started, released, &first, &record]() {
+    if (first.exchange(false))
+    {
+      started.set_value();
+      released.wait();
+    }
+    record("low");
+  };
+
+  RasterTaskflow raster(std::make_unique<CallbackTaskflowGenerator>(callback),
+                        std::make_unique<CallbackTaskflowGenerator>(callback),
+                        std::make_unique<CallbackTaskflowGenerator>(callback));
+  CompositeInstruction program = rasterExampleProgram();
+  Instruction program_instruction = program;
+  Instruction seed_instruction = generateSkeletonSeed(program);
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, false, nullptr);
+  TaskflowContainer container = raster.generateTaskflow(input, nullptr, nullptr);
+  PreemptionGate::Ptr gate = input.getTaskInterface()->getPreemptionGate();
+
+  std::future<void> low_future =
+      queue.submit(*container.taskflow, input.getTaskInterface(), ProcessPlanningPriority::LOW);
+  started.get_future().wait();
+  EXPECT_FALSE(gate->isClosed());
+
+  // Submitting the high priority request closes the gate of the running raster
+  tf::Taskflow high;
+  high.emplace([&record]() { record("high"); });
+  std::future<void> high_future = queue.submit(high, nullptr, ProcessPlanningPriority::HIGH);
+  EXPECT_TRUE(gate->isClosed());
+  EXPECT_EQ(queue.getPreempted(), 1UL);
+
+  release.set_value();
+  high_future.wait();
+  low_future.wait();
+  queue.waitForAll();
+  EXPECT_FALSE(gate->isClosed());
+  EXPECT_EQ(gate->getParked(), 0UL);
+  EXPECT_EQ(queue.getPreempted(), 0UL);
+
+  // The raster was started first, and its sub-taskflows which had not started yielded to the high priority request
+  ASSERT_EQ(order.size(), container.containers.size() + 1);
+  auto high_it = std::find(order.begin(), order.end(), "high");
+  ASSERT_NE(high_it, order.end());
+  EXPECT_NE(high_it, order.begin());
+  EXPECT_NE(std::next(high_it), order.end());
+}
+
+TEST_F(TesseractProcessManagerUnit, ResultCacheTest)
+{
+  Instruction results = freespaceExampleProgramABB();
+  Instruction other_results = rasterExampleProgram();
+  std::string content_key, other_content_key;
+  EXPECT_TRUE(getProgramContentKey(content_key, results));
+  EXPECT_TRUE(getProgramContentKey(other_content_key, other_results));
+  EXPECT_NE(content_key, other_content_key);
+
+  // The key changes with the environment state
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::FREESPACE_PLANNER_NAME;
+  request.instructions = results;
+  ProfileDictionary profiles;
+  std::string key, state_key;
+  bool persistent = true;
+  EXPECT_TRUE(getResultCacheKey(key, persistent, request, results, results, *env_, profiles));
+  EXPECT_TRUE(persistent);
+  Environment::Ptr env = env_->clone();
+  std::unordered_map<std::string, double> joints;
+  joints["joint_1"] = 0.5;
+  env->setState(joints);
+  EXPECT_TRUE(getResultCacheKey(state_key, persistent, request, results, results, *env, profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_NE(key, state_key);
+
+  // A persistent key depends on the content of the profiles, not the revision of the dictionary
+  auto trajopt_profile = std::make_shared<TrajOptDefaultPlanProfile>();
+  ProfileDictionary trajopt_profiles;
+  trajopt_profiles.addProfile<TrajOptPlanProfile>("FREESPACE", trajopt_profile);
+  std::string trajopt_key, same_trajopt_key, other_trajopt_key;
+  EXPECT_TRUE(getResultCacheKey(trajopt_key, persistent, request, results, results, *env_, trajopt_profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_NE(trajopt_key, key);
+
+  ProfileDictionary same_trajopt_profiles;
+  same_trajopt_profiles.addProfile<TrajOptPlanProfile>("FREESPACE", std::make_shared<TrajOptDefaultPlanProfile>());
+  same_trajopt_profiles.removeProfile<TrajOptPlanProfile>("FREESPACE");
+  same_trajopt_profiles.addProfile<TrajOptPlanProfile>("FREESPACE", std::make_shared<TrajOptDefaultPlanProfile>());
+  EXPECT_NE(same_trajopt_profiles.getRevision(), trajopt_profiles.getRevision());
+  EXPECT_TRUE(getResultCacheKey(same_trajopt_key, persistent, request, results, results, *env_, same_trajopt_profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_EQ(same_trajopt_key, trajopt_key);
+
+  auto other_trajopt_profile = std::make_shared<TrajOptDefaultPlanProfile>();
+  other_trajopt_profile->cartesian_coeff = Eigen::VectorXd::Constant(6, 1, 3);
+  ProfileDictionary other_trajopt_profiles;
+  other_trajopt_profiles.addProfile<TrajOptPlanProfile>("FREESPACE", other_trajopt_profile);
+  EXPECT_TRUE(
+      getResultCacheKey(other_trajopt_key, persistent, request, results, results, *env_, other_trajopt_profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_NE(other_trajopt_key, trajopt_key);
+
+  // A persistent key depends on the content of the environment, not its revision
+  std::string clone_key;
+  Environment::Ptr clone = env_->clone();
+  EXPECT_TRUE(getResultCacheKey(clone_key, persistent, request, results, results, *clone, profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_EQ(clone_key, key);
+  std::string acm_key;
+  clone->addAllowedCollision("base_link", "tool0", "Test");
+  EXPECT_TRUE(getResultCacheKey(acm_key, persistent, request, results, results, *clone, profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_NE(acm_key, key);
+  std::string box_key;
+  addBoxLink(*clone, "box");
+  EXPECT_TRUE(getResultCacheKey(box_key, persistent, request, results, results, *clone, profiles));
+  EXPECT_TRUE(persistent);
+  EXPECT_NE(box_key, acm_key);
+
+  // Profiles which can not be serialized only give a key valid in this process
+  std::string simple_key;
+  ProfileDictionary simple_profiles;
+  simple_profiles.addProfile<SimplePlannerPlanProfile>("FREESPACE",
+                                                       std::make_shared<SimplePlannerDefaultPlanProfile>());
+  EXPECT_TRUE(getResultCacheKey(simple_key, persistent, request, results, results, *env_, simple_profiles));
+  EXPECT_FALSE(persistent);
+  EXPECT_NE(simple_key, key);
+
+  // Results are found by their full key
+  boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  boost::filesystem::create_directories(directory);
+  ResultCache cache(1024 * 1024, directory.string());
+  Instruction found{ NullInstruction() };
+  EXPECT_FALSE(cache.get(found, key));
+  EXPECT_TRUE(cache.put(key, results));
+  EXPECT_FALSE(cache.get(found, state_key));
+  EXPECT_TRUE(cache.get(found, key));
+  std::string found_key;
+  EXPECT_TRUE(getProgramContentKey(found_key, found));
+  EXPECT_EQ(found_key, content_key);
+  EXPECT_EQ(cache.getHits(), 1UL);
+  EXPECT_EQ(cache.getMisses(), 2UL);
+
+  // The least recently used results are removed once the memory bound is exceeded
+  EXPECT_TRUE(cache.put(state_key, other_results));
+  EXPECT_EQ(cache.size(), 2UL);
+  cache.setMaxBytes(cache.getBytes() - 1);
+  EXPECT_EQ(cache.size(), 1UL);
+  EXPECT_TRUE(cache.get(found, state_key));
+  EXPECT_TRUE(getProgramContentKey(found_key, found));
+  EXPECT_EQ(found_key, other_content_key);
+
+  // Results not in memory are read from the directory
+  cache.clear();
+  EXPECT_EQ(cache.getBytes(), 0UL);
+  ResultCache disk_cache(1024 * 1024, directory.string());
+  EXPECT_TRUE(disk_cache.get(found, key));
+  EXPECT_TRUE(getProgramContentKey(found_key, found));
+  EXPECT_EQ(found_key, content_key);
+  EXPECT_EQ(disk_cache.size(), 1UL);
+
+  // Keys which are not persistent never use the directory
+  auto countFiles = [&directory]() {
+    return std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator());
+  };
+  const auto file_count = countFiles();
+  EXPECT_TRUE(disk_cache.put(simple_key, results, false));
+  EXPECT_EQ(countFiles(), file_count);
+  ResultCache other_disk_cache(1024 * 1024, directory.string());
+  EXPECT_FALSE(other_disk_cache.get(found, simple_key, false));
+  EXPECT_FALSE(other_disk_cache.get(found, key, false));
+  EXPECT_TRUE(other_disk_cache.get(found, key));
+
+  boost::filesystem::remove_all(directory);
+}
+
+TEST_F(TesseractProcessManagerUnit, RequestBundleTest)
+{
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::FREESPACE_PLANNER_NAME;
+  request.instructions = freespaceExampleProgramABB();
+  request.plan_profile_remapping[process_planner_names::TRAJOPT_PLANNER_NAME]["FREESPACE"] = "SLOW";
+  request.timeout = 0.1;
+  request.priority = ProcessPlanningPriority::HIGH;
+  auto env_state = std::make_shared<tesseract_environment::EnvState>();
+  env_state->joints["joint_1"] = 0.5;
+  request.env_state = env_state;
+
+  auto trajopt_profile = std::make_shared<TrajOptDefaultPlanProfile>();
+  trajopt_profile->cartesian_coeff = Eigen::VectorXd::Constant(6, 1, 3);
+  ProfileDictionary profiles;
+  profiles.addProfile<TrajOptPlanProfile>("SLOW", trajopt_profile);
+
+  RequestBundle bundle = captureRequestBundle(request, *env_, profiles);
+  EXPECT_EQ(bundle.scene_graph_name, env_->getSceneGraph()->getName());
+  EXPECT_EQ(bundle.trajopt_plan_profiles.size(), 1UL);
+  bundle.duration = 2;
+
+  // A bundle is only recorded if the request took at least the minimum duration
+  boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  boost::filesystem::create_directories(directory);
+  RequestRecorder recorder(directory.string(), 1);
+  std::string file_path = recorder.record(bundle);
+  EXPECT_FALSE(file_path.empty());
+  bundle.duration = 0.5;
+  EXPECT_TRUE(recorder.record(bundle).empty());
+  EXPECT_EQ(recorder.getCount(), 1UL);
+
+  RequestBundle loaded;
+  EXPECT_FALSE(loadRequestBundle(loaded, (directory / "missing.bundle").string()));
+  EXPECT_TRUE(loadRequestBundle(loaded, file_path));
+  EXPECT_EQ(loaded.request.name, request.name);
+  std::string content_key, loaded_content_key;
+  EXPECT_TRUE(getProgramContentKey(content_key, request.instructions));
+  EXPECT_TRUE(getProgramContentKey(loaded_content_key, loaded.request.instructions));
+  EXPECT_EQ(loaded_content_key, content_key);
+  EXPECT_TRUE(isNullInstruction(loaded.request.seed));
+  ASSERT_TRUE(loaded.request.env_state != nullptr);
+  EXPECT_EQ(loaded.request.env_state->joints, env_state->joints);
+  EXPECT_EQ(loaded.request.plan_profile_remapping, request.plan_profile_remapping);
+  EXPECT_DOUBLE_EQ(loaded.request.timeout, request.timeout);
+  EXPECT_EQ(loaded.request.priority, ProcessPlanningPriority::HIGH);
+  EXPECT_EQ(loaded.environment_state, bundle.environment_state);
+  EXPECT_EQ(loaded.environment_revision, bundle.environment_revision);
+  EXPECT_EQ(loaded.ompl_seed, bundle.ompl_seed);
+  EXPECT_DOUBLE_EQ(loaded.duration, 2);
+
+  // The profiles are restored as the default profile types
+  ProfileDictionary loaded_profiles;
+  EXPECT_TRUE(addRequestBundleProfiles(loaded_profiles, loaded));
+  auto loaded_profile = std::dynamic_pointer_cast<const TrajOptDefaultPlanProfile>(
+      loaded_profiles.getProfile<TrajOptPlanProfile>("SLOW"));
+  ASSERT_TRUE(loaded_profile != nullptr);
+  EXPECT_TRUE(loaded_profile->cartesian_coeff.isApprox(trajopt_profile->cartesian_coeff));
+
+  boost::filesystem::remove_all(directory);
+}
+
 TEST_F(TesseractProcessManagerUnit, RasterSimpleMotionPlannerDefaultPlanProfileTest)
 {
   // Define the program
@@ -229,6 +1018,35 @@ TEST_F(TesseractProcessManagerUnit, FreespaceSimpleMotionPlannerDefaultPlanProfi
   EXPECT_FALSE(response.results.getManipulatorInfo().empty());
 }
 
+TEST_F(TesseractProcessManagerUnit, FreespaceSimpleMotionPlannerSharedPlanProfileTest)
+{
+  CompositeInstruction program = freespaceExampleProgramABB(DEFAULT_PROFILE_KEY, DEFAULT_PROFILE_KEY);
+  program.setManipulatorInfo(manip);
+
+  // The profiles of the dictionary are referenced without copying and take precedence over plan_profiles
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<SimplePlannerPlanProfile>(DEFAULT_PROFILE_KEY,
+                                                 std::make_shared<SimplePlannerDefaultPlanProfile>());
+  auto interpolator = std::make_shared<SimpleMotionPlanner>("INTERPOLATOR");
+  interpolator->shared_plan_profiles = profiles->getProfileEntryPtr<SimplePlannerPlanProfile>();
+  EXPECT_EQ(interpolator->shared_plan_profiles, profiles->getProfileEntryPtr<SimplePlannerPlanProfile>());
+
+  // Create Planning Request
+  PlannerRequest request;
+  request.instructions = program;
+  request.env = env_;
+  request.env_state = env_->getCurrentState();
+
+  PlannerResponse response;
+  auto status = interpolator->solve(request, response);
+  EXPECT_TRUE(status);
+
+  // The fixed size profile of the dictionary is used instead of the default lvs profile of the planner
+  auto pcnt = getPlanInstructionCount(request.instructions);
+  auto mcnt = getMoveInstructionCount(response.results);
+  EXPECT_EQ(((pcnt - 1) * 10) + 1, mcnt);
+}
+
 TEST_F(TesseractProcessManagerUnit, FreespaceSimpleMotionPlannerDefaultLVSPlanProfileTest)
 {
   CompositeInstruction program = freespaceExampleProgramABB(DEFAULT_PROFILE_KEY, DEFAULT_PROFILE_KEY);
@@ -260,6 +1078,72 @@ TEST_F(TesseractProcessManagerUnit, FreespaceSimpleMotionPlannerDefaultLVSPlanPr
   EXPECT_FALSE(response.results.getManipulatorInfo().empty());
 }
 
+TEST_F(TesseractProcessManagerUnit, FreespaceRaceTaskflowTest)
+{
+  CompositeInstruction program = freespaceExampleProgramABB(DEFAULT_PROFILE_KEY, DEFAULT_PROFILE_KEY);
+  program.setManipulatorInfo(manip);
+
+  // Ompl uses all of its planning time when optimizing, so it only finishes early if its branch is aborted
+  const double ompl_planning_time = 30;
+  auto ompl_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  ompl_profile->planning_time = ompl_planning_time;
+  ompl_profile->optimize = true;
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(DEFAULT_PROFILE_KEY, ompl_profile);
+
+  // Perturb a state of the seed, trajopt smooths it so the results show which branch won
+  CompositeInstruction seed = generateSeed(program, env_->getCurrentState(), env_);
+  std::vector<std::reference_wrapper<Instruction>> seed_moves = flatten(seed, moveFilter);
+  ASSERT_GT(seed_moves.size(), 2UL);
+  const std::size_t perturbed_index = seed_moves.size() / 2;
+  Eigen::VectorXd& perturbed_position =
+      seed_moves[perturbed_index].get().cast<MoveInstruction>()->getWaypoint().cast<StateWaypoint>()->position;
+  perturbed_position[0] += 0.2;
+  const Eigen::VectorXd perturbed = perturbed_position;
+
+  Instruction program_instruction = program;
+  Instruction seed_instruction = seed;
+  TaskInput input(env_, &program_instruction, program.getManipulatorInfo(), &seed_instruction, true, profiles);
+
+  FreespaceTaskflowParams params;
+  params.type = FreespaceTaskflowType::RACE;
+  FreespaceTaskflow generator(params);
+
+  bool done{ false };
+  bool error{ false };
+  TaskflowContainer container =
+      generator.generateTaskflow(input, [&done]() { done = true; }, [&error]() { error = true; });
+
+  tf::Executor executor(2);
+  auto start_time = std::chrono::steady_clock::now();
+  executor.run(*container.taskflow).wait();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+  // Trajopt from the interpolated seed wins and its results are kept
+  EXPECT_TRUE(done);
+  EXPECT_FALSE(error);
+  EXPECT_FALSE(input.isAborted());
+  auto* results = input.getResults()->cast<CompositeInstruction>();
+  std::vector<std::reference_wrapper<Instruction>> result_moves = flatten(*results, moveFilter);
+  ASSERT_EQ(result_moves.size(), seed_moves.size());
+  const Waypoint& result_waypoint = result_moves[perturbed_index].get().cast_const<MoveInstruction>()->getWaypoint();
+  ASSERT_TRUE(isStateWaypoint(result_waypoint));
+  EXPECT_FALSE(result_waypoint.cast_const<StateWaypoint>()->position.isApprox(perturbed, 1e-3));
+
+  bool trajopt_succeeded{ false };
+  for (const auto& task_info : input.getTaskInfoMap())
+  {
+    if (task_info.second->task_name == "TRAJOPT" && task_info.second->return_value == 1)
+      trajopt_succeeded = true;
+
+    // The losing branch is aborted, so ompl is either skipped or cancelled
+    if (task_info.second->task_name == "OMPL")
+      EXPECT_EQ(task_info.second->return_value, 0);
+  }
+  EXPECT_TRUE(trajopt_succeeded);
+  EXPECT_LT(elapsed.count(), ompl_planning_time);
+}
+
 TEST_F(TesseractProcessManagerUnit, RasterProcessManagerDefaultPlanProfileTest)
 {
   // Create Process Planning Server
@@ -294,6 +1178,258 @@ TEST_F(TesseractProcessManagerUnit, RasterProcessManagerDefaultPlanProfileTest)
   EXPECT_TRUE(response.interface->isSuccessful());
 }
 
+TEST_F(TesseractProcessManagerUnit, RasterProcessManagerSegmentStreamTest)
+{
+  // Create Process Planning Server
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env_), 2);
+  planning_server.loadDefaultProcessPlanners();
+
+  // Create Process Planning Request
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::RASTER_FT_PLANNER_NAME;
+
+  // Define the program
+  std::string freespace_profile = DEFAULT_PROFILE_KEY;
+  std::string process_profile = "PROCESS";
+
+  CompositeInstruction program = rasterExampleProgram(freespace_profile, process_profile);
+  request.instructions = Instruction(program);
+
+  // Add profiles to planning server
+  auto default_simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = planning_server.getProfiles();
+  profiles->addProfile<SimplePlannerPlanProfile>(freespace_profile, default_simple_plan_profile);
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+
+  // Subscribe while the process is running, the stream is queried from the callback
+  ProcessPlanningFuture response = planning_server.run(request);
+  const SegmentStream* stream = response.interface->getSegmentStream().get();
+  std::mutex indices_mutex;
+  std::vector<std::size_t> indices;
+  response.subscribe([&indices_mutex, &indices, stream](std::size_t index, const Instruction& segment) {
+    EXPECT_GT(stream->size(), index);
+    EXPECT_TRUE(isCompositeInstruction(segment));
+    std::lock_guard<std::mutex> lock(indices_mutex);
+    indices.push_back(index);
+  });
+  planning_server.waitForAll();
+  EXPECT_TRUE(response.interface->isSuccessful());
+
+  // Every segment of the program was streamed in order
+  std::lock_guard<std::mutex> lock(indices_mutex);
+  ASSERT_EQ(indices.size(), program.size());
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    EXPECT_EQ(indices[i], i);
+}
+
+TEST_F(TesseractProcessManagerUnit, RasterProcessManagerMetricsTest)
+{
+  // Create Process Planning Server
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env_), 1);
+  planning_server.loadDefaultProcessPlanners();
+  planning_server.setTaskflowCacheSize(1);
+
+  // Create Process Planning Request
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::RASTER_FT_PLANNER_NAME;
+  request.profile = true;
+
+  // Define the program
+  std::string freespace_profile = DEFAULT_PROFILE_KEY;
+  std::string process_profile = "PROCESS";
+
+  CompositeInstruction program = rasterExampleProgram(freespace_profile, process_profile);
+  request.instructions = Instruction(program);
+
+  // Add profiles to planning server
+  auto default_simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = planning_server.getProfiles();
+  profiles->addProfile<SimplePlannerPlanProfile>(freespace_profile, default_simple_plan_profile);
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+
+  // Solve process plan
+  ProcessPlanningFuture response = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(response.ready());
+  EXPECT_TRUE(response.interface->isSuccessful());
+  EXPECT_TRUE(response.cached_taskflow != nullptr);
+
+  // Every task of the request was timed
+  ASSERT_TRUE(response.metrics != nullptr);
+  ProcessMetrics::Ptr metrics = response.metrics;
+  std::vector<TaskExecutionMetrics> executions = metrics->getExecutions();
+  EXPECT_FALSE(executions.empty());
+  std::size_t execution_count = 0;
+  for (const auto& histograms : metrics->getHistograms())
+    execution_count += histograms.second.wall_time.getCount();
+  EXPECT_EQ(execution_count, executions.size());
+
+  // The histograms of the server merge the histograms of every worker
+  std::size_t server_count = 0;
+  for (const auto& histograms : planning_server.getTaskflowMetrics()->getHistograms())
+    server_count += histograms.second.wall_time.getCount();
+  EXPECT_GE(server_count, executions.size());
+
+  std::stringstream json;
+  metrics->dump(json);
+  EXPECT_EQ(json.str().front(), '{');
+  EXPECT_EQ(json.str().back(), '}');
+  response.clear();
+
+  // Solve the same process plan again without profiling which reuses the cached taskflow and its tasks, these must not
+  // be attributed to the first request
+  request.profile = false;
+  ProcessPlanningFuture response2 = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(response2.ready());
+  EXPECT_TRUE(response2.interface->isSuccessful());
+  EXPECT_TRUE(response2.metrics == nullptr);
+  EXPECT_EQ(metrics->getExecutions().size(), executions.size());
+
+  std::size_t server_count2 = 0;
+  for (const auto& histograms : planning_server.getTaskflowMetrics()->getHistograms())
+    server_count2 += histograms.second.wall_time.getCount();
+  EXPECT_GT(server_count2, server_count);
+}
+
+TEST_F(TesseractProcessManagerUnit, RasterProcessManagerBatchTest)
+{
+  // Create Process Planning Server
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env_), 1);
+  planning_server.loadDefaultProcessPlanners();
+
+  // Define the program
+  std::string freespace_profile = DEFAULT_PROFILE_KEY;
+  std::string process_profile = "PROCESS";
+  CompositeInstruction program = rasterExampleProgram(freespace_profile, process_profile);
+
+  // Add profiles to planning server
+  auto default_simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = planning_server.getProfiles();
+  profiles->addProfile<SimplePlannerPlanProfile>(freespace_profile, default_simple_plan_profile);
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+
+  // Create Process Planning Requests, the last one uses a process planner which does not exist
+  std::vector<ProcessPlanningRequest> requests(3);
+  requests[0].name = process_planner_names::RASTER_FT_PLANNER_NAME;
+  requests[1].name = process_planner_names::RASTER_FT_PLANNER_NAME;
+  requests[2].name = "Missing";
+  for (auto& request : requests)
+    request.instructions = Instruction(program);
+
+  // Solve process plans
+  std::vector<ProcessPlanningFuture> responses = planning_server.runBatch(requests);
+  ASSERT_EQ(responses.size(), requests.size());
+  EXPECT_TRUE(responses[2].interface == nullptr);
+  ASSERT_TRUE(responses[0].interface != nullptr);
+  ASSERT_TRUE(responses[1].interface != nullptr);
+  EXPECT_NE(responses[0].interface, responses[1].interface);
+
+  responses[0].wait();
+  responses[1].wait();
+  EXPECT_TRUE(responses[0].interface->isSuccessful());
+  EXPECT_TRUE(responses[1].interface->isSuccessful());
+  EXPECT_EQ(getMoveInstructionCount(*responses[0].results->cast_const<CompositeInstruction>()),
+            getMoveInstructionCount(*responses[1].results->cast_const<CompositeInstruction>()));
+  planning_server.waitForAll();
+  EXPECT_EQ(planning_server.getRequestQueue()->getInFlight(), 0UL);
+}
+
+TEST_F(TesseractProcessManagerUnit, RasterProcessManagerResultCacheTest)
+{
+  // Create Process Planning Server
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env_), 1);
+  planning_server.loadDefaultProcessPlanners();
+  planning_server.setResultCache(std::make_shared<ResultCache>());
+
+  // Create Process Planning Request
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::RASTER_FT_PLANNER_NAME;
+
+  // Define the program
+  std::string freespace_profile = DEFAULT_PROFILE_KEY;
+  std::string process_profile = "PROCESS";
+
+  CompositeInstruction program = rasterExampleProgram(freespace_profile, process_profile);
+  request.instructions = Instruction(program);
+
+  // Add profiles to planning server
+  auto default_simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = planning_server.getProfiles();
+  profiles->addProfile<SimplePlannerPlanProfile>(freespace_profile, default_simple_plan_profile);
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+
+  // Solve process plan
+  ProcessPlanningFuture response = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(response.interface->isSuccessful());
+  EXPECT_EQ(planning_server.getResultCache()->size(), 1UL);
+
+  // The same request returns the cached results without planning
+  ProcessPlanningFuture cached_response = planning_server.run(request);
+  EXPECT_TRUE(cached_response.ready());
+  EXPECT_TRUE(cached_response.interface->isSuccessful());
+  EXPECT_EQ(planning_server.getResultCache()->getHits(), 1UL);
+  std::string key, cached_key;
+  EXPECT_TRUE(getProgramContentKey(key, *response.results));
+  EXPECT_TRUE(getProgramContentKey(cached_key, *cached_response.results));
+  EXPECT_EQ(key, cached_key);
+
+  // Updating the profiles invalidates the cached results
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+  ProcessPlanningFuture new_response = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(new_response.interface->isSuccessful());
+  EXPECT_EQ(planning_server.getResultCache()->getHits(), 1UL);
+  EXPECT_EQ(planning_server.getResultCache()->size(), 2UL);
+}
+
+TEST_F(TesseractProcessManagerUnit, RasterProcessManagerTaskflowCacheTest)
+{
+  // Create Process Planning Server
+  ProcessPlanningServer planning_server(std::make_shared<ProcessEnvironmentCache>(env_), 1);
+  planning_server.loadDefaultProcessPlanners();
+  planning_server.setTaskflowCacheSize(1);
+  EXPECT_EQ(planning_server.getTaskflowCacheSize(), 1);
+
+  // Create Process Planning Request
+  ProcessPlanningRequest request;
+  request.name = process_planner_names::RASTER_FT_PLANNER_NAME;
+
+  // Define the program
+  std::string freespace_profile = DEFAULT_PROFILE_KEY;
+  std::string process_profile = "PROCESS";
+
+  CompositeInstruction program = rasterExampleProgram(freespace_profile, process_profile);
+  request.instructions = Instruction(program);
+
+  // Add profiles to planning server
+  auto default_simple_plan_profile = std::make_shared<SimplePlannerDefaultPlanProfile>();
+  ProfileDictionary::Ptr profiles = planning_server.getProfiles();
+  profiles->addProfile<SimplePlannerPlanProfile>(freespace_profile, default_simple_plan_profile);
+  profiles->addProfile<SimplePlannerPlanProfile>(process_profile, default_simple_plan_profile);
+
+  // Solve process plan
+  ProcessPlanningFuture response = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(response.ready());
+  EXPECT_TRUE(response.interface->isSuccessful());
+  EXPECT_TRUE(response.cached_taskflow != nullptr);
+  const tf::Taskflow* taskflow = response.cached_taskflow->taskflow_container.taskflow.get();
+  Instruction results = *(response.results);
+  response.clear();
+
+  // Solve the same process plan again which should reuse the cached taskflow
+  ProcessPlanningFuture response2 = planning_server.run(request);
+  planning_server.waitForAll();
+  EXPECT_TRUE(response2.ready());
+  EXPECT_TRUE(response2.interface->isSuccessful());
+  EXPECT_TRUE(response2.cached_taskflow != nullptr);
+  EXPECT_EQ(response2.cached_taskflow->taskflow_container.taskflow.get(), taskflow);
+  EXPECT_EQ(getMoveInstructionCount(*(response2.results->cast_const<CompositeInstruction>())),
+            getMoveInstructionCount(*(results.cast_const<CompositeInstruction>())));
+}
+
 TEST_F(TesseractProcessManagerUnit, RasterProcessManagerDefaultLVSPlanProfileTest)
 {
   // Create Process Planning Server